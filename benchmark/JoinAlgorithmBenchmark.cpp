@@ -52,6 +52,7 @@
 #include "util/Forward.h"
 #include "util/HashMap.h"
 #include "util/HashSet.h"
+#include "util/JoinAlgorithms/SimdJoin.h"
 #include "util/Log.h"
 #include "util/MemorySize/MemorySize.h"
 #include "util/Random.h"
@@ -353,6 +354,9 @@ following information:
 - Time needed for the hash join.
 - How many rows the result of joining the tables has.
 - How much faster the hash join is. For example: Two times faster.
+- Time needed for the merge/galloping join with the SIMD join algorithms (see
+  `SimdJoin.h`), which are used if the inputs contain no local vocab entries.
+- How much faster the SIMD merge/galloping join is.
 
 The following enum exists, in order to make the information about the order of
 columns explicit.
@@ -364,7 +368,9 @@ enum struct GeneratedTableColumn : unsigned long {
   TimeForSortingAndMergeGallopingJoin,
   TimeForHashJoin,
   NumRowsOfJoinResult,
-  JoinAlgorithmSpeedup
+  JoinAlgorithmSpeedup,
+  TimeForSimdMergeGallopingJoin,
+  SimdJoinSpeedup
 };
 
 // TODO<c++23> Replace usage with `std::to_underlying`.
@@ -1305,7 +1311,12 @@ class GeneralInterfaceImplementation : public BenchmarkInterface {
         tableDescriptor, {},
         {std::move(changingParameterColumnDesc), "Time for sorting",
          "Merge/Galloping join", "Sorting + merge/galloping join", "Hash join",
-         "Number of rows in resulting IdTable", "Speedup of hash join"});
+         "Number of rows in resulting IdTable", "Speedup of hash join",
+         absl::StrCat("Merge/Galloping join (",
+                      ad_utility::toString(
+                          ad_utility::simdJoin::bestSupportedInstructionSet()),
+                      ")"),
+         "Speedup of SIMD merge/galloping join"});
   };
 
   /*
@@ -1333,6 +1344,12 @@ class GeneralInterfaceImplementation : public BenchmarkInterface {
         table, {toUnderlying(JoinAlgorithmSpeedup)},
         {toUnderlying(TimeForHashJoin)},
         {toUnderlying(TimeForSortingAndMergeGallopingJoin)});
+
+    // Calculate, how much of a speedup the SIMD join algorithms have in
+    // comparison to the generic ones.
+    calculateSpeedupOfColumn(table, {toUnderlying(SimdJoinSpeedup)},
+                             {toUnderlying(TimeForSimdMergeGallopingJoin)},
+                             {toUnderlying(TimeForMergeGallopingJoin)});
   }
 
   /*
@@ -1403,6 +1420,7 @@ class GeneralInterfaceImplementation : public BenchmarkInterface {
     // The lambdas for the join algorithms.
     auto hashJoinLambda = makeHashJoinLambda();
     auto joinLambda = makeJoinLambda();
+    auto simdJoinLambda = makeJoinLambda(false);
 
     /*
     Create new `IdTable`s.
@@ -1631,6 +1649,18 @@ class GeneralInterfaceImplementation : public BenchmarkInterface {
       return false;
     }
 
+    // The merge/galloping join with the SIMD join algorithms.
+    table->addMeasurement(
+        rowIdx,
+        toUnderlying(GeneratedTableColumn::TimeForSimdMergeGallopingJoin),
+        [&smallerTable, &biggerTable, &simdJoinLambda]() {
+          useJoinFunctionOnIdTables(smallerTable, biggerTable, simdJoinLambda);
+        });
+    if (isOverMaxTime(GeneratedTableColumn::TimeForSimdMergeGallopingJoin)) {
+      table->deleteRow(rowIdx);
+      return false;
+    }
+
     // Adding the number of rows of the result.
     table->setEntry(rowIdx,
                     toUnderlying(GeneratedTableColumn::NumRowsOfJoinResult),
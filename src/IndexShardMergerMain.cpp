@@ -0,0 +1,92 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+//
+// Only performs the final step of a sharded index build: Build the complete
+// index from shards that have previously been built (possibly on different
+// machines) via `qlever-index --shard-index`.
+
+#include <boost/program_options.hpp>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "CompilationInfo.h"
+#include "global/RuntimeParameters.h"
+#include "libqlever/Qlever.h"
+#include "util/ProgramOptionsHelpers.h"
+#include "util/ReadableNumberFacet.h"
+
+namespace po = boost::program_options;
+
+// ____________________________________________________________________________
+int main(int argc, char** argv) {
+  qlever::version::copyVersionInfo();
+  setlocale(LC_CTYPE, "");
+
+  std::locale loc;
+  ad_utility::ReadableNumberFacet facet(1);
+  std::locale locWithNumberGrouping(loc, &facet);
+  ad_utility::Log::imbue(locWithNumberGrouping);
+
+  qlever::IndexBuilderConfig config;
+
+  po::options_description boostOptions("Options for IndexShardMergerMain");
+  auto add = [&boostOptions](auto&&... args) {
+    boostOptions.add_options()(AD_FWD(args)...);
+  };
+  add("help,h", "Produce this help message.");
+  add("index-basename,i", po::value(&config.baseName_)->required(),
+      "The basename of the output files (required).");
+  add("shard",
+      po::value(&config.shardsToMerge_)->required()->composing()->multitoken(),
+      "The basenames of the shards from which the index is built (required).");
+  add("kg-index-name,K", po::value(&config.kbIndexName_),
+      "The name of the knowledge graph index.");
+  add("settings-file,s", po::value(&config.settingsFile_),
+      "A JSON file with settings for the index build. Must be the same file "
+      "that was used for building the shards.");
+  add("no-patterns", po::bool_switch(&config.noPatterns_),
+      "Disable the precomputation for `ql:has-predicate`.");
+  add("only-pso-and-pos-permutations,o",
+      po::bool_switch(&config.onlyPsoAndPos_),
+      "Only build the PSO and POS permutations.");
+  auto msg = absl::StrCat(
+      "The vocabulary implementation for strings in qlever, can be any of ",
+      ad_utility::VocabularyType::getListOfSupportedValues());
+  add("vocabulary-type", po::value(&config.vocabType_), msg.c_str());
+  add("encode-as-id",
+      po::value(&config.prefixesForIdEncodedIris_)->composing()->multitoken(),
+      "Space-separated list of IRI prefixes (without angle brackets), the same "
+      "as for building the shards.");
+  add("stxxl-memory,m", po::value(&config.memoryLimit_),
+      "The amount of memory to use for sorting during the index build.");
+  add("keep-temporary-files,k", po::bool_switch(&config.keepTemporaryFiles_),
+      "Do not delete temporary files from index creation for debugging.");
+
+  po::variables_map optionsMap;
+  try {
+    po::store(po::parse_command_line(argc, argv, boostOptions), optionsMap);
+    if (optionsMap.count("help")) {
+      std::cout << boostOptions << std::endl;
+      return EXIT_SUCCESS;
+    }
+    po::notify(optionsMap);
+  } catch (const std::exception& e) {
+    std::cerr << "Error in command-line argument: " << e.what() << std::endl;
+    std::cerr << boostOptions << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  try {
+    config.validate();
+    setRuntimeParameter<&RuntimeParameters::permutationWriterNumThreads_>(5);
+    qlever::Qlever::buildIndex(config);
+  } catch (std::exception& e) {
+    AD_LOG_ERROR << "Merging the shards of the index failed with the following "
+                    "exception: "
+                 << e.what() << std::endl;
+    return 2;
+  }
+  return 0;
+}
@@ -204,6 +204,17 @@ class QleverCliContext {
                                logFileName);
   }
 
+  // Build a new index at `outputBaseName` that consists of the current index
+  // (including the delta triples) and the triples from the `files`, without a
+  // full index build. See `qlever::appendToIndex` for details.
+  void appendToIndex(const std::vector<qlever::InputFileSpecification>& files,
+                     const std::string& outputBaseName) {
+    auto handle = std::make_shared<ad_utility::CancellationHandle<>>();
+    auto logFileName = outputBaseName + ".append-index-log.txt";
+    qlever::appendToIndex(index_.getImpl(), outputBaseName, files, handle,
+                          logFileName);
+  }
+
   // Return the current delta triple counts (inserted, deleted).
   // Used by executeBinaryRebuild to skip the rebuild when there are no changes.
   DeltaTriplesCount getDeltaCounts() {
@@ -160,6 +160,14 @@ void printUsage(const char* programName, std::ostream& out = std::cerr) {
          "writes to a temp basename,\n";
   out << "                 replaces the original index files atomically, and "
          "clears <index_basename>.update-triples.\n";
+  out << "  append      <index_basename> <output_basename> <format> "
+         "<input_file>... [--graph <uri>]\n";
+  out << "                 Build a new index from the index (including delta "
+         "triples) and the\n";
+  out << "                 triples from the input files, without a full index "
+         "build.\n";
+  out << "                 The output_basename must differ from the "
+         "index_basename.\n";
   out << "  build-index <json_input>                      Build index "
          "from RDF files\n";
   out << "  serialize   <index_basename> <format> [output_file]  Dump "
@@ -570,6 +578,69 @@ int executeBinaryRebuild(const std::string& indexBasename,
   }
 }
 
+int executeAppend(const std::string& indexBasename,
+                  const std::string& outputBasename, const std::string& format,
+                  const std::vector<std::string>& inputFiles,
+                  ad_utility::MemorySize memLimit,
+                  const std::string& defaultGraph = "") {
+  try {
+    // The source index is read while the new index is written, so they must
+    // not have the same basename (an in-place append is not supported).
+    namespace fs = std::filesystem;
+    if (fs::absolute(indexBasename).lexically_normal() ==
+        fs::absolute(outputBasename).lexically_normal()) {
+      throw std::runtime_error(
+          "The output basename of append must be different from the index "
+          "basename: " +
+          outputBasename);
+    }
+    // The source index is only read, but its `.update-triples` must not be
+    // swapped by a concurrent `binary-rebuild` while we read it.
+    IndexCLILock lock(indexBasename, IndexCLILock::Mode::Shared);
+
+    qlever::Filetype filetype;
+    if (format == "ttl" || format == "turtle" || format == "nt") {
+      filetype = qlever::Filetype::Turtle;
+    } else if (format == "nq") {
+      filetype = qlever::Filetype::NQuad;
+    } else {
+      throw std::runtime_error("Unsupported format for append: " + format +
+                               ". Use ttl, nt, or nq.");
+    }
+    // All input files have the same format and default graph.
+    std::vector<qlever::InputFileSpecification> files;
+    for (const auto& inputFile : inputFiles) {
+      auto& file = files.emplace_back();
+      file.source_ = inputFile;
+      file.filetype_ = filetype;
+      // N-Triples and N-Quads can always be parsed in parallel.
+      file.parseInParallel_ = format == "nt" || format == "nq";
+      if (!defaultGraph.empty() && defaultGraph != "-") {
+        file.defaultGraph_ = defaultGraph;
+      }
+    }
+
+    qlever::EngineConfig config;
+    config.baseName_ = indexBasename;
+    config.memoryLimit_ = memLimit;
+
+    auto qlever = std::make_shared<qlever::QleverCliContext>(config);
+    qlever->appendToIndex(std::move(files), outputBasename);
+
+    json response = createSuccessResponse("Append completed successfully.");
+    response["indexBasename"] = indexBasename;
+    response["outputBasename"] = outputBasename;
+    std::cout << response.dump() << std::endl;
+    flushAndExit(0);
+  } catch (const std::exception& e) {
+    json errorResponse = createErrorResponse(e.what());
+    errorResponse["command"] = "append";
+    errorResponse["indexBasename"] = indexBasename;
+    std::cerr << errorResponse.dump() << std::endl;
+    flushAndExit(1);
+  }
+}
+
 int serializeDatabase(const std::string& indexBasename,
                       const std::string& format,
                       ad_utility::MemorySize memLimit,
@@ -1056,6 +1127,23 @@ int main(int argc, char* argv[]) {
       // atomic in-place rebuild (temp name → swap → clear update-triples).
       std::string outputBasename = (nargs == 4) ? args[3] : "";
       return executeBinaryRebuild(args[2], outputBasename, memLimit);
+    } else if (command == "append" && nargs >= 6) {
+      // append <index_basename> <output_basename> <format> <input_file>...
+      //        [--graph <uri>]
+      std::vector<std::string> inputFiles(args.begin() + 5, args.end());
+      std::string defaultGraph;
+      if (inputFiles.size() >= 3 &&
+          inputFiles[inputFiles.size() - 2] == "--graph") {
+        defaultGraph = inputFiles.back();
+        inputFiles.resize(inputFiles.size() - 2);
+      }
+      if (std::find(inputFiles.begin(), inputFiles.end(), "--graph") !=
+          inputFiles.end()) {
+        printUsage(argv[0]);
+        return 1;
+      }
+      return executeAppend(args[2], args[3], args[4], inputFiles, memLimit,
+                           defaultGraph);
     } else if (command == "serialize" && (nargs == 4 || nargs == 5)) {
       std::string outputFile = (nargs == 5) ? args[4] : "";
       return serializeDatabase(args[2], args[3], memLimit, outputFile);
@@ -197,6 +197,31 @@ int main(int argc, char** argv) {
       "prefix are rejected. To disable all federated queries, set this option "
       "to an invalid IRI prefix like `-`. Magic services (for example spatial "
       "search or materialized views) are never affected.");
+  add("index-warmup-budget",
+      optionFactory.getProgramOption<&RuntimeParameters::indexWarmupBudget_>(),
+      "The amount of the index (metadata, vocabulary offsets, and blocks of "
+      "the permutations) that is prefetched into memory when the server is "
+      "started, to avoid high latencies of the first queries after a restart. "
+      "The default is 0 (no warm-up).");
+  add("join-max-num-threads",
+      optionFactory.getProgramOption<&RuntimeParameters::joinMaxNumThreads_>(),
+      "The maximal number of threads that are used to compute a single join "
+      "of two large inputs. The default is 8, a value of 1 disables the "
+      "parallel join.");
+  add("join-parallel-min-num-rows",
+      optionFactory
+          .getProgramOption<&RuntimeParameters::joinParallelMinNumRows_>(),
+      "Joins of inputs with fewer rows (in total) are computed by a single "
+      "thread. The default is 1000000.");
+  add("hash-join-min-num-rows-to-sort",
+      optionFactory
+          .getProgramOption<&RuntimeParameters::hashJoinMinNumRowsToSort_>(),
+      "The query planner only considers a hash join if a sort-based join "
+      "would have to sort at least this many rows. The default is 100000.");
+  add("sort-num-threads",
+      optionFactory.getProgramOption<&RuntimeParameters::sortNumThreads_>(),
+      "The number of threads that are used to sort a single intermediate "
+      "result in memory. The default is 4.");
   add("log-level",
       optionFactory.getProgramOption<&RuntimeParameters::logLevel_>(),
       "Runtime log level: FATAL, ERROR, WARN, INFO, DEBUG, TIMING, or TRACE. "
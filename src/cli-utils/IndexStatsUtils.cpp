@@ -5,6 +5,7 @@
 #include <fstream>
 #include <iostream>
 
+#include "index/BlockAccessHistogram.h"
 #include "util/Timer.h"
 
 namespace cli_utils {
@@ -46,6 +47,11 @@ nlohmann::json IndexStatsCollector::collectStats(
   std::cerr << "Gathering index statistics for " << indexBasename << "..."
             << std::endl;
 
+  // Block access statistics (persisted by the server). They are collected
+  // before running the queries below, because these also access blocks.
+  response["blockAccessStatistics"] =
+      BlockAccessHistogram::getStatistics(qlever_->index_.getImpl(), 20);
+
   // Basic triple count
   runStatsQuery(response, "tripleCount",
                 "SELECT (COUNT(*) AS ?count) WHERE { ?s ?p ?o }");
@@ -0,0 +1,112 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#include "engine/AdaptiveReplanning.h"
+
+#include "backports/algorithm.h"
+#include "engine/Join.h"
+#include "util/Log.h"
+
+namespace qlever::adaptiveReplanning {
+
+// _____________________________________________________________________________
+bool isEstimateOff(size_t estimate, size_t actualSize, double threshold) {
+  // Add one to both sizes, s.t. empty results and estimates of zero are
+  // handled gracefully.
+  double ratio = (static_cast<double>(actualSize) + 1.0) /
+                 (static_cast<double>(estimate) + 1.0);
+  return ratio > threshold || ratio * threshold < 1.0;
+}
+
+namespace {
+// Append the lowest joins of the tree rooted at `qet` (including `qet` itself)
+// to `result` and return true iff the tree contains a `Join`.
+bool collectLowestJoins(QueryExecutionTree& qet,
+                        std::vector<QueryExecutionTree*>& result) {
+  bool childContainsJoin = false;
+  for (QueryExecutionTree* child : qet.getRootOperation()->getChildren()) {
+    childContainsJoin |= collectLowestJoins(*child, result);
+  }
+  bool isJoin =
+      dynamic_cast<const Join*>(qet.getRootOperation().get()) != nullptr;
+  if (isJoin && !childContainsJoin) {
+    result.push_back(&qet);
+  }
+  return isJoin || childContainsJoin;
+}
+}  // namespace
+
+// _____________________________________________________________________________
+std::vector<QueryExecutionTree*> getLowestJoins(QueryExecutionTree& qet) {
+  std::vector<QueryExecutionTree*> result;
+  collectLowestJoins(qet, result);
+  ql::erase(result, &qet);
+  return result;
+}
+
+// _____________________________________________________________________________
+size_t observeResultSize(QueryExecutionTree& qet, size_t estimate,
+                         double threshold) {
+  // A result that is materialized anyway is stored in the cache (if it fits),
+  // from where it is read when the query is executed or planned again.
+  auto result = qet.getRootOperation()->getResult(true);
+  if (result->isFullyMaterialized()) {
+    return result->idTable().size();
+  }
+  // A lazy result is only counted, one block at a time. As soon as the size is
+  // known to be off, there is no need to compute the rest of the result.
+  size_t size = 0;
+  for (const Result::IdTableVocabPair& pair : result->idTables()) {
+    size += pair.idTable_.size();
+    if (size > estimate && isEstimateOff(estimate, size, threshold)) {
+      break;
+    }
+  }
+  return size;
+}
+
+// _____________________________________________________________________________
+bool computeLowestJoinsAndObserveSizes(
+    QueryExecutionTree& qet, QueryExecutionContext& qec, double threshold,
+    ad_utility::HashSet<std::string>& checkedCacheKeys) {
+  bool foundEstimateThatIsOff = false;
+  for (QueryExecutionTree* join : getLowestJoins(qet)) {
+    if (!checkedCacheKeys.insert(join->getCacheKey()).second) {
+      continue;
+    }
+    size_t estimate = join->getSizeEstimate();
+    size_t actualSize = observeResultSize(*join, estimate, threshold);
+    if (isEstimateOff(estimate, actualSize, threshold)) {
+      AD_LOG_INFO << "Actual result size " << actualSize
+                  << " differs strongly from the estimate " << estimate
+                  << " for " << join->getRootOperation()->getDescriptor()
+                  << std::endl;
+      qec.observedResultSizes()[join->getCacheKey()] = actualSize;
+      foundEstimateThatIsOff = true;
+    }
+  }
+  return foundEstimateThatIsOff;
+}
+
+// _____________________________________________________________________________
+QueryExecutionTree createExecutionTreeWithAdaptiveReplanning(
+    QueryExecutionContext& qec,
+    const std::function<QueryExecutionTree()>& createExecutionTree,
+    const std::function<void(QueryExecutionTree&)>& prepareForComputation,
+    size_t maxNumReplans, double threshold) {
+  ad_utility::HashSet<std::string> checkedCacheKeys;
+  auto qet = createExecutionTree();
+  for (size_t numReplans = 0; numReplans < maxNumReplans; ++numReplans) {
+    prepareForComputation(qet);
+    if (!computeLowestJoinsAndObserveSizes(qet, qec, threshold,
+                                           checkedCacheKeys)) {
+      break;
+    }
+    AD_LOG_INFO << "Planning the query again with the actual result sizes"
+                << std::endl;
+    qet = createExecutionTree();
+  }
+  return qet;
+}
+
+}  // namespace qlever::adaptiveReplanning
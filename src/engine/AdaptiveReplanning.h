@@ -0,0 +1,67 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#ifndef QLEVER_SRC_ENGINE_ADAPTIVEREPLANNING_H
+#define QLEVER_SRC_ENGINE_ADAPTIVEREPLANNING_H
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "engine/QueryExecutionContext.h"
+#include "engine/QueryExecutionTree.h"
+#include "util/HashSet.h"
+
+// Adaptive re-planning: The query planner only knows the size estimates of the
+// subtrees, which can be wrong by orders of magnitude for correlated patterns
+// and then lead to very bad join orders. To avoid this, the results of the
+// lowest joins of a plan are computed before the rest of the query (lazily, if
+// the operation supports it, in which case they are only counted). If the
+// actual size of such a result differs strongly from its estimate, the actual
+// size is stored in `QueryExecutionContext::observedResultSizes()`, where
+// `QueryExecutionTree::getSizeEstimate` picks it up, and the query is planned
+// again. Fully materialized results are then reused via the cache, lazy
+// results are computed again.
+namespace qlever::adaptiveReplanning {
+
+// Return true iff `actualSize` differs from `estimate` by more than a factor of
+// `threshold` (in either direction).
+bool isEstimateOff(size_t estimate, size_t actualSize, double threshold);
+
+// Return the lowest joins in the tree rooted at `qet`, i.e. the subtrees whose
+// root is a `Join` and which don't contain another `Join`. The `qet` itself is
+// never returned, because there is nothing to re-plan after its result has been
+// computed.
+std::vector<QueryExecutionTree*> getLowestJoins(QueryExecutionTree& qet);
+
+// Return the size of the result of `qet`, which has the size `estimate`. The
+// result is computed lazily if the operation supports it, in which case only
+// one block of the result is kept in memory at a time. As soon as the size is
+// larger than the `estimate` by more than a factor of `threshold` (see
+// `isEstimateOff` below), the computation is stopped and the size so far
+// (which then is a lower bound of the actual size) is returned.
+size_t observeResultSize(QueryExecutionTree& qet, size_t estimate,
+                         double threshold);
+
+// Compute the results of the lowest joins of `qet` the cache keys of which are
+// not yet contained in `checkedCacheKeys` (and add them). Store the sizes that
+// are off according to `isEstimateOff` in `qec.observedResultSizes()` and
+// return true iff there was at least one such size.
+bool computeLowestJoinsAndObserveSizes(
+    QueryExecutionTree& qet, QueryExecutionContext& qec, double threshold,
+    ad_utility::HashSet<std::string>& checkedCacheKeys);
+
+// Create an execution tree using `createExecutionTree`. Then repeatedly compute
+// the lowest joins (see above) and create a new execution tree if one of their
+// sizes is off, but at most `maxNumReplans` times. Each tree is passed to
+// `prepareForComputation` before any of its results is computed (e.g. to set
+// the cancellation handle and the time limit).
+QueryExecutionTree createExecutionTreeWithAdaptiveReplanning(
+    QueryExecutionContext& qec,
+    const std::function<QueryExecutionTree()>& createExecutionTree,
+    const std::function<void(QueryExecutionTree&)>& prepareForComputation,
+    size_t maxNumReplans, double threshold);
+
+}  // namespace qlever::adaptiveReplanning
+
+#endif  // QLEVER_SRC_ENGINE_ADAPTIVEREPLANNING_H
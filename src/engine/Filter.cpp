@@ -35,6 +35,8 @@ Filter::Filter(QueryExecutionContext* qec,
   if (getRuntimeParameter<&RuntimeParameters::enablePrefilterOnIndexScans_>()) {
     setPrefilterExpressionForChildren();
   }
+  compiledFilter_ = _expression.compileForFilter(_subtree->getVariableColumns(),
+                                                 *getExecutionContext());
 }
 
 // _____________________________________________________________________________
@@ -147,6 +149,34 @@ CPP_template_def(int WIDTH, typename Table)(
   evaluationContext._columnsByWhichResultIsSorted = std::move(sortedBy);
   const auto input =
       evaluationContext._inputTable.asStaticView<static_cast<size_t>(WIDTH)>();
+
+  // Use the compiled filter if there is one, unless the input is sorted by a
+  // column that is read by the filter. In the latter case, the evaluation of
+  // the expression can use binary search, which is even faster.
+  const auto& sortedColumns = evaluationContext._columnsByWhichResultIsSorted;
+  if (compiledFilter_.has_value() &&
+      (sortedColumns.empty() ||
+       !compiledFilter_->readsColumn(sortedColumns.at(0)))) {
+    auto mask = compiledFilter_->evaluate(evaluationContext);
+    checkCancellation();
+    size_t numKept = ql::ranges::count(mask, uint8_t{1});
+    if (resultTable.empty() && numKept == input.size()) {
+      // All rows pass the filter and there are no previous results, so we can
+      // simply copy or move the complete table.
+      dynamicResultTable = AD_FWD(inputTable).moveOrClone();
+      return;
+    }
+    resultTable.reserve(resultTable.size() + numKept);
+    for (size_t i = 0; i < mask.size(); ++i) {
+      if (mask[i]) {
+        resultTable.push_back(input[i]);
+      }
+    }
+    dynamicResultTable = std::move(resultTable).toDynamic();
+    checkCancellation();
+    return;
+  }
+
   sparqlExpression::ExpressionResult expressionResult =
       _expression.getPimpl()->evaluate(&evaluationContext);
 
@@ -12,6 +12,7 @@
 
 #include "engine/Operation.h"
 #include "engine/QueryExecutionTree.h"
+#include "engine/sparqlExpressions/CompiledFilter.h"
 
 class Filter : public Operation {
   using PrefilterVariablePair = sparqlExpression::PrefilterExprVariablePair;
@@ -19,6 +20,10 @@ class Filter : public Operation {
  private:
   std::shared_ptr<QueryExecutionTree> _subtree;
   sparqlExpression::SparqlExpressionPimpl _expression;
+  // The `_expression` compiled for the columns of the `_subtree`, if it has
+  // one of the supported forms (see `SparqlExpression::compileForFilter`). It
+  // is set once in the constructor, after the `_subtree` has its final form.
+  std::optional<sparqlExpression::CompiledFilter> compiledFilter_;
 
  public:
   size_t getResultWidth() const override;
@@ -62,6 +67,13 @@ class Filter : public Operation {
     return _subtree->getVariableColumns();
   }
 
+  // A `Filter` only removes rows, so the summary can be passed on.
+  bool applyJoinColumnSummaryImpl(const Variable& variable,
+                                  const JoinColumnSummary& summary) override {
+    return _subtree->getRootOperation()->applyJoinColumnSummary(variable,
+                                                                summary);
+  }
+
   // The method is directly invoked with the construction of this `Filter`
   // object. Its implementation retrieves <PrefilterExpression, Variable> pairs
   // from the corresponding `SparqlExpression` and uses them to call
@@ -7,8 +7,13 @@
 
 #include "engine/GroupByImpl.h"
 
+#include <absl/hash/hash.h>
+#include <absl/strings/str_cat.h>
 #include <absl/strings/str_join.h>
 
+#include <future>
+#include <numeric>
+
 #include "backports/algorithm.h"
 #include "engine/CallFixedSize.h"
 #include "engine/ExistsJoin.h"
@@ -26,10 +31,13 @@
 #include "engine/sparqlExpressions/SparqlExpressionGenerators.h"
 #include "engine/sparqlExpressions/StdevExpression.h"
 #include "global/RuntimeParameters.h"
+#include "index/IdTableUtils.h"
 #include "index/Index.h"
 #include "index/IndexImpl.h"
 #include "parser/Alias.h"
 #include "util/HashSet.h"
+#include "util/ParallelExecutor.h"
+#include "util/Random.h"
 #include "util/Timer.h"
 
 namespace groupBy::detail {
@@ -1398,17 +1406,17 @@ GroupByImpl::substituteAllAggregates(
 template <size_t NUM_GROUP_COLUMNS>
 std::vector<size_t>
 GroupByImpl::HashMapAggregationData<NUM_GROUP_COLUMNS>::getHashEntries(
-    const ArrayOrVector<ql::span<const Id>>& groupByCols) {
+    const ArrayOrVector<ql::span<const Id>>& groupByCols,
+    ql::span<const size_t> rows, bool insertNewGroups) {
   AD_CONTRACT_CHECK(groupByCols.size() > 0);
 
   std::vector<size_t> hashEntries;
-  size_t numberOfEntries = groupByCols.at(0).size();
-  hashEntries.reserve(numberOfEntries);
+  hashEntries.reserve(rows.size());
 
   // TODO: We pass the `Id`s column-wise into this function, and then handle
   //       them row-wise. Is there any advantage to this, or should we transform
   //       the data into a row-wise format before passing it?
-  for (size_t i = 0; i < numberOfEntries; ++i) {
+  for (size_t i : rows) {
     ArrayOrVector<Id> row;
     resizeIfVector(row, numOfGroupedColumns_);
 
@@ -1419,8 +1427,14 @@ GroupByImpl::HashMapAggregationData<NUM_GROUP_COLUMNS>::getHashEntries(
       ++idx;
     }
 
-    auto [iterator, wasAdded] = map_.try_emplace(row, getNumberOfGroups());
-    hashEntries.push_back(iterator->second);
+    if (insertNewGroups) {
+      auto [iterator, wasAdded] = map_.try_emplace(row, getNumberOfGroups());
+      hashEntries.push_back(iterator->second);
+    } else {
+      auto iterator = map_.find(row);
+      hashEntries.push_back(iterator == map_.end() ? notFound
+                                                   : iterator->second);
+    }
   }
 
   // CPP_template_lambda(capture)(typenames...)(arg)(requires ...)`
@@ -1454,6 +1468,44 @@ GroupByImpl::HashMapAggregationData<NUM_GROUP_COLUMNS>::getHashEntries(
   return hashEntries;
 }
 
+// _____________________________________________________________________________
+template <size_t NUM_GROUP_COLUMNS>
+size_t GroupByImpl::HashMapAggregationData<
+    NUM_GROUP_COLUMNS>::getNumBytesPerGroup() const {
+  // A node of the map stores the key, the value, the hash, and a pointer to the
+  // next node. The buckets of the map store another pointer per node.
+  size_t numBytes =
+      sizeof(typename decltype(map_)::value_type) + 3 * sizeof(void*);
+  if constexpr (NUM_GROUP_COLUMNS == 0) {
+    numBytes += numOfGroupedColumns_ * sizeof(Id);
+  }
+  for (const auto& aggregation : aggregationData_) {
+    numBytes += std::visit(
+        [](const auto& vector) {
+          using T = std::decay_t<decltype(vector.front())>;
+          size_t numBytesOfAggregate = sizeof(T);
+          // The strings of a `GROUP_CONCAT` grow with every value, so their
+          // average size is estimated from a sample of the groups.
+          if constexpr (std::is_same_v<T, GroupConcatAggregationData>) {
+            static constexpr size_t maxNumSamples = 100;
+            size_t step = std::max(vector.size() / maxNumSamples, size_t{1});
+            size_t numBytesOfSamples = 0;
+            size_t numSamples = 0;
+            for (size_t i = 0; i < vector.size(); i += step) {
+              numBytesOfSamples += vector[i].currentValue_.capacity();
+              ++numSamples;
+            }
+            if (numSamples > 0) {
+              numBytesOfAggregate += numBytesOfSamples / numSamples;
+            }
+          }
+          return numBytesOfAggregate;
+        },
+        aggregation);
+  }
+  return numBytes;
+}
+
 // _____________________________________________________________________________
 template <size_t NUM_GROUP_COLUMNS>
 [[nodiscard]] GroupByImpl::HashMapAggregationData<
@@ -1688,32 +1740,110 @@ IdTable GroupByImpl::createResultFromHashMap(
 }
 
 // _____________________________________________________________________________
-// Visitor function to extract values from the result of an evaluation of
-// the child expression of an aggregate, and subsequently processing the
-// values by calling the `addValue` function of the corresponding aggregate.
-static constexpr auto makeProcessGroupsVisitor =
-    [](size_t blockSize,
-       const sparqlExpression::EvaluationContext* evaluationContext,
-       const std::vector<size_t>& hashEntries) {
-      return CPP_template_lambda(blockSize, evaluationContext, &hashEntries)(
-          typename T, typename A)(T && singleResult, A & aggregationDataVector)(
-          requires sparqlExpression::SingleExpressionResult<T> &&
-          VectorOfAggregationData<A>) {
-        auto generator = sparqlExpression::detail::makeGenerator(
-            std::forward<T>(singleResult), blockSize, evaluationContext);
-
-        auto hashEntryIndex = 0;
-
-        for (const auto& val : generator) {
-          auto vectorOffset = hashEntries[hashEntryIndex];
-          auto& aggregateData = aggregationDataVector.at(vectorOffset);
-
-          aggregateData.addValue(val, evaluationContext);
-
-          ++hashEntryIndex;
-        }
-      };
-    };
+namespace {
+// Blocks with fewer rows are aggregated by a single thread, because the
+// overhead of starting the threads doesn't pay off.
+constexpr size_t minNumRowsForParallelAggregation = 1 << 14;
+
+// The memory that is used for buffering the rows of a single spill file.
+constexpr auto spillFileMemory = ad_utility::MemorySize::megabytes(16);
+
+// One `T` for each of the hash partitions.
+template <typename T>
+using PerPartition = std::array<T, GROUP_BY_HASH_MAP_NUM_PARTITIONS>;
+
+// Return the partition of the group of the `row`-th row of the `groupValues`
+// (which is a range of columns).
+template <typename GroupValues>
+size_t getHashPartition(const GroupValues& groupValues, size_t row) {
+  uint64_t hash = 0;
+  for (const auto& column : groupValues) {
+    hash = absl::HashOf(hash, column[row]);
+  }
+  return hash >> (64 - GROUP_BY_HASH_MAP_NUM_PARTITION_BITS);
+}
+
+// Call `function(partition)` for each of the hash partitions. The partitions
+// are distributed round-robin to `numThreads` threads.
+template <typename F>
+void forEachHashPartition(size_t numThreads, const F& function) {
+  numThreads = std::clamp(numThreads, size_t{1},
+                          GROUP_BY_HASH_MAP_NUM_PARTITIONS);
+  auto processPartitions = [numThreads, &function](size_t thread) {
+    for (size_t partition = thread;
+         partition < GROUP_BY_HASH_MAP_NUM_PARTITIONS;
+         partition += numThreads) {
+      function(partition);
+    }
+  };
+  if (numThreads == 1) {
+    processPartitions(0);
+    return;
+  }
+  std::vector<std::packaged_task<void()>> tasks;
+  for (size_t thread = 0; thread < numThreads; ++thread) {
+    tasks.emplace_back(
+        [&processPartitions, thread]() { processPartitions(thread); });
+  }
+  ad_utility::runTasksInParallel(std::move(tasks));
+}
+}  // namespace
+
+// _____________________________________________________________________________
+template <size_t NUM_GROUP_COLUMNS>
+void GroupByImpl::aggregateSpilledRows(
+    SpillFile& spillFile,
+    HashMapAggregationData<NUM_GROUP_COLUMNS>& aggregationData,
+    size_t numAggregates, LocalVocab& localVocab) const {
+  size_t numGroupColumns = aggregationData.numOfGroupedColumns_;
+  IdTable block{numGroupColumns + numAggregates, allocator()};
+  block.reserve(GROUP_BY_HASH_MAP_BLOCK_SIZE);
+  // The children of the aggregates have already been evaluated, so the
+  // `EvaluationContext` is only needed for accessing the vocabulary.
+  VariableToColumnMap noVariables;
+  std::vector<size_t> rows;
+
+  auto aggregateBlock = [&]() {
+    checkCancellation();
+    typename HashMapAggregationData<
+        NUM_GROUP_COLUMNS>::template ArrayOrVector<ql::span<const Id>>
+        groupValues;
+    resizeIfVector(groupValues, numGroupColumns);
+    for (size_t i = 0; i < numGroupColumns; ++i) {
+      groupValues[i] = block.getColumn(i);
+    }
+    rows.resize(block.numRows());
+    std::iota(rows.begin(), rows.end(), size_t{0});
+    auto hashEntries = aggregationData.getHashEntries(groupValues, rows);
+
+    sparqlExpression::EvaluationContext evaluationContext(
+        *getExecutionContext(), noVariables, block, allocator(), localVocab,
+        cancellationHandle_, deadline_);
+    for (size_t i = 0; i < numAggregates; ++i) {
+      ql::span<const Id> values = block.getColumn(numGroupColumns + i);
+      std::visit(
+          [&values, &hashEntries,
+           &evaluationContext](auto& aggregationDataVector) {
+            for (size_t row = 0; row < values.size(); ++row) {
+              aggregationDataVector.at(hashEntries[row])
+                  .addValue(values[row], &evaluationContext);
+            }
+          },
+          aggregationData.getAggregationDataVariant(i));
+    }
+    block.clear();
+  };
+
+  for (const auto& row : spillFile.getRows()) {
+    block.push_back(row);
+    if (block.numRows() == GROUP_BY_HASH_MAP_BLOCK_SIZE) {
+      aggregateBlock();
+    }
+  }
+  if (!block.empty()) {
+    aggregateBlock();
+  }
+}
 
 // _____________________________________________________________________________
 template <size_t NUM_GROUP_COLUMNS, typename SubResults>
@@ -1722,12 +1852,38 @@ Result GroupByImpl::computeGroupByForHashMapOptimization(
     SubResults subresults, const std::vector<size_t>& columnIndices) const {
   AD_CORRECTNESS_CHECK(columnIndices.size() == NUM_GROUP_COLUMNS ||
                        NUM_GROUP_COLUMNS == 0);
+  using AggregationData = HashMapAggregationData<NUM_GROUP_COLUMNS>;
   LocalVocab localVocab;
-
-  // Initialize the data for the aggregates of the GROUP BY operation.
-  HashMapAggregationData<NUM_GROUP_COLUMNS> aggregationData(
-      getExecutionContext()->getAllocator(), aggregateAliases,
-      columnIndices.size());
+  size_t numGroupColumns = columnIndices.size();
+  size_t numAggregates = 0;
+  for (const auto& alias : aggregateAliases) {
+    numAggregates += alias.aggregateInfo_.size();
+  }
+  size_t numThreads =
+      getRuntimeParameter<&RuntimeParameters::groupByHashMapNumThreads_>();
+  // The hash maps may use at most half of the memory that is left for the
+  // query, s.t. there is enough memory left for the result.
+  size_t inMemoryThreshold = std::min(
+      getRuntimeParameter<
+          &RuntimeParameters::groupByHashMapInMemoryThreshold_>()
+          .getBytes(),
+      allocator().amountMemoryLeft().getBytes() / 2);
+
+  // Initialize the data for the aggregates of the GROUP BY operation, one
+  // instance per partition.
+  std::vector<AggregationData> partitions;
+  partitions.reserve(GROUP_BY_HASH_MAP_NUM_PARTITIONS);
+  for (size_t i = 0; i < GROUP_BY_HASH_MAP_NUM_PARTITIONS; ++i) {
+    partitions.emplace_back(getExecutionContext()->getAllocator(),
+                            aggregateAliases, numGroupColumns);
+  }
+
+  // The spill files of the partitions, which are only created when needed.
+  PerPartition<std::unique_ptr<SpillFile>> spillFiles;
+  std::string spillFilePrefix = absl::StrCat(
+      getExecutionContext()->getIndex().getOnDiskBase(), ".group-by.",
+      ad_utility::UuidGenerator{}(), ".");
+  bool isSpilling = false;
 
   // Process the input blocks (pairs of `IdTable` and `LocalVocab`) one after
   // the other.
@@ -1762,12 +1918,15 @@ Result GroupByImpl::computeGroupByForHashMapOptimization(
           std::min(i + GROUP_BY_HASH_MAP_BLOCK_SIZE, inputTable.size());
 
       auto currentBlockSize = evaluationContext.size();
+      size_t numThreadsForBlock =
+          currentBlockSize >= minNumRowsForParallelAggregation ? numThreads
+                                                               : 1;
 
       // Perform HashMap lookup once for all groups in current block
-      using U = typename HashMapAggregationData<
-          NUM_GROUP_COLUMNS>::template ArrayOrVector<ql::span<const Id>>;
+      using U = typename AggregationData::template ArrayOrVector<
+          ql::span<const Id>>;
       U groupValues;
-      resizeIfVector(groupValues, columnIndices.size());
+      resizeIfVector(groupValues, numGroupColumns);
 
       // TODO<C++23> use views::enumerate
       size_t j = 0;
@@ -1777,9 +1936,48 @@ Result GroupByImpl::computeGroupByForHashMapOptimization(
         ++j;
       }
       lookupTimer.cont();
-      auto hashEntries = aggregationData.getHashEntries(groupValues);
+      PerPartition<std::vector<size_t>> rowsOfPartition;
+      for (size_t row = 0; row < currentBlockSize; ++row) {
+        rowsOfPartition[getHashPartition(groupValues, row)].push_back(row);
+      }
+      PerPartition<std::vector<size_t>> hashEntries;
+      forEachHashPartition(numThreadsForBlock, [&](size_t partition) {
+        hashEntries[partition] = partitions[partition].getHashEntries(
+            groupValues, rowsOfPartition[partition], !isSpilling);
+      });
       lookupTimer.stop();
 
+      // The rows (wrt the current block) of the groups that are not contained
+      // in the hash map of their partition, and the rows that will be written
+      // to the spill file of the partition for them.
+      PerPartition<std::vector<size_t>> spilledRows;
+      PerPartition<std::optional<IdTable>> rowsToSpill;
+      if (isSpilling) {
+        for (size_t partition = 0; partition < spilledRows.size();
+             ++partition) {
+          const auto& rows = rowsOfPartition[partition];
+          const auto& entries = hashEntries[partition];
+          for (size_t k = 0; k < rows.size(); ++k) {
+            if (entries[k] == AggregationData::notFound) {
+              spilledRows[partition].push_back(rows[k]);
+            }
+          }
+          if (spilledRows[partition].empty()) {
+            continue;
+          }
+          auto& table = rowsToSpill[partition].emplace(
+              numGroupColumns + numAggregates, allocator());
+          table.resize(spilledRows[partition].size());
+          for (size_t col = 0; col < numGroupColumns; ++col) {
+            ql::ranges::transform(
+                spilledRows[partition], table.getColumn(col).begin(),
+                [&column = groupValues[col]](size_t row) {
+                  return column[row];
+                });
+          }
+        }
+      }
+
       aggregationTimer.cont();
       for (auto& aggregateAlias : aggregateAliases) {
         for (auto& aggregate : aggregateAlias.aggregateInfo_) {
@@ -1787,23 +1985,130 @@ Result GroupByImpl::computeGroupByForHashMapOptimization(
               GroupByImpl::evaluateChildExpressionOfAggregateFunction(
                   aggregate, evaluationContext);
 
-          auto& aggregationDataVariant =
-              aggregationData.getAggregationDataVariant(
-                  aggregate.aggregateDataIndex_);
-
-          std::visit(makeProcessGroupsVisitor(currentBlockSize,
-                                              &evaluationContext, hashEntries),
-                     std::move(expressionResult), aggregationDataVariant);
+          // Materialize the values of the child expression, s.t. they can be
+          // processed by multiple threads.
+          auto processValues = [&](auto&& singleResult) {
+            auto generator = sparqlExpression::detail::makeGenerator(
+                AD_FWD(singleResult), currentBlockSize, &evaluationContext);
+            using Value = std::decay_t<decltype(*generator.begin())>;
+            std::vector<Value> values;
+            values.reserve(currentBlockSize);
+            for (auto&& value : generator) {
+              values.emplace_back(AD_FWD(value));
+            }
+
+            forEachHashPartition(numThreadsForBlock, [&](size_t partition) {
+              const auto& rows = rowsOfPartition[partition];
+              const auto& entries = hashEntries[partition];
+              auto processPartition = [&](auto& aggregationDataVector) {
+                for (size_t k = 0; k < rows.size(); ++k) {
+                  if (entries[k] != AggregationData::notFound) {
+                    aggregationDataVector.at(entries[k])
+                        .addValue(values[rows[k]], &evaluationContext);
+                  }
+                }
+              };
+              std::visit(processPartition,
+                         partitions[partition].getAggregationDataVariant(
+                             aggregate.aggregateDataIndex_));
+            });
+
+            for (size_t partition = 0; partition < rowsToSpill.size();
+                 ++partition) {
+              if (!rowsToSpill[partition].has_value()) {
+                continue;
+              }
+              ql::ranges::transform(
+                  spilledRows[partition],
+                  rowsToSpill[partition]
+                      ->getColumn(numGroupColumns +
+                                  aggregate.aggregateDataIndex_)
+                      .begin(),
+                  [&values, &localVocab](size_t row) {
+                    return sparqlExpression::detail::
+                        constantExpressionResultToId(
+                            sparqlExpression::IdOrLocalVocabEntry{values[row]},
+                            localVocab);
+                  });
+            }
+          };
+          std::visit(processValues, std::move(expressionResult));
         }
       }
       aggregationTimer.stop();
+
+      for (size_t partition = 0; partition < rowsToSpill.size(); ++partition) {
+        if (!rowsToSpill[partition].has_value()) {
+          continue;
+        }
+        auto& spillFile = spillFiles[partition];
+        if (!spillFile) {
+          spillFile = std::make_unique<SpillFile>(
+              absl::StrCat(spillFilePrefix, partition, ".dat"),
+              numGroupColumns + numAggregates, spillFileMemory, allocator());
+        }
+        for (const auto& row : rowsToSpill[partition].value()) {
+          spillFile->push(row);
+        }
+      }
+
+      // From now on spill the rows of new groups if the hash maps have become
+      // too large.
+      if (!isSpilling) {
+        size_t numBytes = 0;
+        for (const auto& partition : partitions) {
+          numBytes +=
+              partition.getNumberOfGroups() * partition.getNumBytesPerGroup();
+        }
+        isSpilling = numBytes > inMemoryThreshold;
+      }
     }
   }
 
   runtimeInfo().addDetail("timeMapLookup", lookupTimer.msecs());
   runtimeInfo().addDetail("timeAggregation", aggregationTimer.msecs());
-  IdTable resultTable =
-      createResultFromHashMap(aggregationData, aggregateAliases, &localVocab);
+
+  // Create the result for each partition, first for the groups in memory,
+  // then for the spilled groups (one partition at a time).
+  IdTable resultTable{getResultWidth(), allocator()};
+  size_t numNonEmptyPartitions = 0;
+  auto addResultOfPartition = [&](const AggregationData& aggregationData) {
+    if (aggregationData.getNumberOfGroups() == 0) {
+      return;
+    }
+    ++numNonEmptyPartitions;
+    resultTable.insertAtEnd(createResultFromHashMap(
+        aggregationData, aggregateAliases, &localVocab));
+  };
+  ql::ranges::for_each(partitions, addResultOfPartition);
+  partitions.clear();
+
+  size_t numSpilledRows = 0;
+  for (auto& spillFile : spillFiles) {
+    if (!spillFile) {
+      continue;
+    }
+    numSpilledRows += spillFile->size();
+    AggregationData aggregationData(getExecutionContext()->getAllocator(),
+                                    aggregateAliases, numGroupColumns);
+    aggregateSpilledRows(*spillFile, aggregationData, numAggregates,
+                         localVocab);
+    spillFile.reset();
+    addResultOfPartition(aggregationData);
+  }
+  if (numSpilledRows > 0) {
+    runtimeInfo().addDetail("numSpilledRows", numSpilledRows);
+  }
+
+  // Each partition is sorted, but the result has to be sorted as a whole.
+  if (numNonEmptyPartitions > 1) {
+    std::vector<ColumnIndex> groupColumns(numGroupColumns);
+    std::iota(groupColumns.begin(), groupColumns.end(), ColumnIndex{0});
+    IdTableUtils::sort(resultTable, groupColumns);
+    // The sort is not cancellable, so reset the watchdog.
+    cancellationHandle_->resetWatchDogState();
+    checkCancellation();
+  }
   return {std::move(resultTable), resultSortedOn(), std::move(localVocab)};
 }
 
@@ -10,6 +10,7 @@
 
 #include <gtest/gtest_prod.h>
 
+#include <limits>
 #include <memory>
 #include <string>
 #include <utility>
@@ -20,6 +21,7 @@
 #include "engine/Join.h"
 #include "engine/Operation.h"
 #include "engine/QueryExecutionTree.h"
+#include "engine/idTable/CompressedExternalIdTable.h"
 #include "engine/sparqlExpressions/SparqlExpressionPimpl.h"
 #include "engine/sparqlExpressions/SparqlExpressionValueGetters.h"
 #include "parser/Alias.h"
@@ -27,6 +29,12 @@
 
 // Block size for when using the hash map optimization
 static constexpr size_t GROUP_BY_HASH_MAP_BLOCK_SIZE = 262144;
+// The groups of the hash map optimization are split into `2^k` partitions by
+// their hash, where `k` is this number. The partitions are processed in
+// parallel and are the unit of spilling to disk.
+static constexpr size_t GROUP_BY_HASH_MAP_NUM_PARTITION_BITS = 4;
+static constexpr size_t GROUP_BY_HASH_MAP_NUM_PARTITIONS =
+    size_t{1} << GROUP_BY_HASH_MAP_NUM_PARTITION_BITS;
 
 namespace groupBy::detail {
 template <size_t IN_WIDTH, size_t OUT_WIDTH>
@@ -328,12 +336,26 @@ class GroupByImpl : public Operation {
   };
 
   // Create result IdTable by using a HashMap mapping groups to aggregation data
-  // and subsequently calling `createResultFromHashMap`.
+  // and subsequently calling `createResultFromHashMap`. The groups are split
+  // into `GROUP_BY_HASH_MAP_NUM_PARTITIONS` partitions by their hash, each with
+  // its own `HashMapAggregationData`, and the rows of each input block are
+  // aggregated by up to `group-by-hash-map-num-threads` threads, each of which
+  // handles a fixed set of partitions. When the estimated size of the
+  // aggregation data exceeds the `group-by-hash-map-in-memory-threshold`, no
+  // more groups are added to the hash maps. The rows of new groups are then
+  // written to a spill file of their partition (see `SpillFile`) and
+  // aggregated one partition at a time after the complete input has been
+  // consumed.
   template <size_t NUM_GROUP_COLUMNS, typename SubResults>
   Result computeGroupByForHashMapOptimization(
       std::vector<HashMapAliasInformation>& aggregateAliases,
       SubResults subresults, const std::vector<size_t>& columnIndices) const;
 
+  // A spill file of the hash map optimization. Each row consists of the values
+  // of the grouped columns, followed by the values of the children of the
+  // aggregates (ordered by their `aggregateDataIndex_`).
+  using SpillFile = ad_utility::CompressedExternalIdTable<0>;
+
   using AggregationData =
       std::variant<AvgAggregationData, CountAggregationData, MinAggregationData,
                    MaxAggregationData, SumAggregationData,
@@ -390,10 +412,16 @@ class GroupByImpl : public Operation {
       }
     }
 
-    // Returns a vector containing the offsets for all ids of `groupByCols`,
-    // inserting entries if necessary.
+    // Returned by `getHashEntries` for groups that are not contained.
+    static constexpr size_t notFound = std::numeric_limits<size_t>::max();
+
+    // Returns a vector containing the offsets for the ids of `groupByCols` in
+    // the given `rows`. If `insertNewGroups` is true, entries are inserted if
+    // necessary, else `notFound` is returned for groups that are not yet
+    // contained.
     std::vector<size_t> getHashEntries(
-        const ArrayOrVector<ql::span<const Id>>& groupByCols);
+        const ArrayOrVector<ql::span<const Id>>& groupByCols,
+        ql::span<const size_t> rows, bool insertNewGroups = true);
 
     // Return the index of `id`.
     [[nodiscard]] size_t getIndex(const ArrayOrVector<Id>& ids) const {
@@ -419,6 +447,11 @@ class GroupByImpl : public Operation {
     // Returns the number of groups.
     [[nodiscard]] size_t getNumberOfGroups() const { return map_.size(); }
 
+    // Returns an estimate of the number of bytes that the map and the
+    // aggregation data require per group, including the strings of the
+    // `GROUP_CONCAT` aggregates.
+    [[nodiscard]] size_t getNumBytesPerGroup() const;
+
     // How many columns we are grouping by, important in case
     // `NUM_GROUP_COLUMNS` == 0.
     size_t numOfGroupedColumns_;
@@ -494,6 +527,15 @@ class GroupByImpl : public Operation {
       std::vector<HashMapAliasInformation>& aggregateAliases,
       LocalVocab* localVocab) const;
 
+  // Aggregate all the rows of the `spillFile` (which contains the values of the
+  // children of `numAggregates` aggregates) into the `aggregationData`, in the
+  // order in which they were written. This consumes the `spillFile`.
+  template <size_t NUM_GROUP_COLUMNS>
+  void aggregateSpilledRows(
+      SpillFile& spillFile,
+      HashMapAggregationData<NUM_GROUP_COLUMNS>& aggregationData,
+      size_t numAggregates, LocalVocab& localVocab) const;
+
   // Reusable implementation of `checkIfHashMapOptimizationPossible`.
   static std::optional<HashMapOptimizationData>
   computeUnsequentialProcessingMetadata(
@@ -0,0 +1,390 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#include "engine/HashDistinct.h"
+
+#include <absl/hash/hash.h>
+#include <absl/strings/str_cat.h>
+#include <absl/strings/str_join.h>
+
+#include <array>
+#include <functional>
+
+#include "backports/algorithm.h"
+#include "engine/idTable/CompressedExternalIdTable.h"
+#include "global/RuntimeParameters.h"
+#include "util/HashSet.h"
+#include "util/Iterators.h"
+#include "util/Random.h"
+
+namespace {
+// The rows that are spilled to disk are split into this many partitions by
+// their hash, each of which is then deduplicated separately.
+constexpr size_t numSpillPartitionBits = 4;
+constexpr size_t numSpillPartitions = size_t{1} << numSpillPartitionBits;
+
+// The memory that is used for buffering the rows of a single spill file.
+constexpr auto spillFileMemory = ad_utility::MemorySize::megabytes(16);
+
+// The number of rows of a spill file that are deduplicated at once.
+constexpr size_t spillBlockSize = 100'000;
+
+// The number of rows after which the cancellation is checked and the size of
+// the hash set is compared to the `hash-distinct-in-memory-threshold`.
+constexpr size_t checkInterval = 1 << 14;
+
+using SpillFile = ad_utility::CompressedExternalIdTable<0>;
+using Allocator = ad_utility::AllocatorWithLimit<Id>;
+
+// Return the hash of the values of the `keyColumns` in the `row`-th row of
+// `table`.
+uint64_t hashKey(const IdTable& table, ql::span<const ColumnIndex> keyColumns,
+                 size_t row) {
+  uint64_t hash = 0;
+  for (ColumnIndex col : keyColumns) {
+    hash = absl::HashOf(hash, table(row, col));
+  }
+  return hash;
+}
+
+// Return the rows of `table` with the given indices.
+IdTable copyRows(const IdTable& table, const std::vector<size_t>& rows,
+                 const Allocator& allocator) {
+  IdTable result{table.numColumns(), allocator};
+  result.resize(rows.size());
+  for (size_t col = 0; col < table.numColumns(); ++col) {
+    ql::ranges::transform(rows, result.getColumn(col).begin(),
+                          [&table, col](size_t row) { return table(row, col); });
+  }
+  return result;
+}
+
+// A hash set of keys (the values of the distinct columns of a row). The keys
+// are stored in an `IdTable` and the hash set only stores their indices, so
+// all the memory is allocated with the `AllocatorWithLimit`.
+class KeySet {
+  IdTable keys_;
+
+  struct Hash {
+    const IdTable* keys_;
+    size_t operator()(size_t index) const {
+      uint64_t hash = 0;
+      for (size_t col = 0; col < keys_->numColumns(); ++col) {
+        hash = absl::HashOf(hash, (*keys_)(index, col));
+      }
+      return hash;
+    }
+  };
+
+  struct Equal {
+    const IdTable* keys_;
+    bool operator()(size_t a, size_t b) const {
+      for (size_t col = 0; col < keys_->numColumns(); ++col) {
+        if ((*keys_)(a, col) != (*keys_)(b, col)) {
+          return false;
+        }
+      }
+      return true;
+    }
+  };
+
+  ad_utility::HashSet<size_t, Hash, Equal,
+                      ad_utility::AllocatorWithLimit<size_t>>
+      indices_;
+
+ public:
+  KeySet(size_t numKeyColumns, const Allocator& allocator)
+      : keys_{numKeyColumns, allocator},
+        indices_{0, Hash{&keys_}, Equal{&keys_}, allocator} {}
+
+  // The hash set refers to `keys_`, so the set can neither be copied nor
+  // moved.
+  KeySet(const KeySet&) = delete;
+  KeySet& operator=(const KeySet&) = delete;
+
+  // Return true iff the key of the `row`-th row of `table` (the values of its
+  // `keyColumns`) is not contained in the set. If `insertIfNew` is true, a new
+  // key is then inserted.
+  bool isNew(const IdTable& table, ql::span<const ColumnIndex> keyColumns,
+             size_t row, bool insertIfNew) {
+    size_t index = keys_.numRows();
+    keys_.emplace_back();
+    for (size_t i = 0; i < keyColumns.size(); ++i) {
+      keys_(index, i) = table(row, keyColumns[i]);
+    }
+    bool isNew = insertIfNew ? indices_.insert(index).second
+                             : !indices_.contains(index);
+    if (!insertIfNew || !isNew) {
+      keys_.resize(index);
+    }
+    return isNew;
+  }
+
+  // Return the (approximate) number of bytes used by the set.
+  size_t getNumBytes() const {
+    return keys_.numRows() * keys_.numColumns() * sizeof(Id) +
+           indices_.capacity() * (sizeof(size_t) + 1);
+  }
+};
+
+// The state of a hash-based distinct, to which the blocks of the input are
+// passed one after the other.
+class HashDistinctState {
+  std::vector<ColumnIndex> keyColumns_;
+  size_t numColumns_;
+  Allocator allocator_;
+  std::function<void()> checkCancellation_;
+  size_t inMemoryThreshold_;
+  std::unique_ptr<KeySet> keys_;
+
+  // Once the hash set has become too large, no more keys are inserted and the
+  // rows with new keys are written to the spill files of their partition.
+  bool isSpilling_ = false;
+  std::string spillFilePrefix_;
+  std::array<std::unique_ptr<SpillFile>, numSpillPartitions> spillFiles_;
+  size_t nextSpillPartition_ = 0;
+  size_t numSpilledRows_ = 0;
+
+ public:
+  HashDistinctState(std::vector<ColumnIndex> keyColumns, size_t numColumns,
+                    Allocator allocator,
+                    std::function<void()> checkCancellation,
+                    size_t inMemoryThreshold, std::string spillFilePrefix)
+      : keyColumns_{std::move(keyColumns)},
+        numColumns_{numColumns},
+        allocator_{std::move(allocator)},
+        checkCancellation_{std::move(checkCancellation)},
+        inMemoryThreshold_{inMemoryThreshold},
+        keys_{std::make_unique<KeySet>(keyColumns_.size(), allocator_)},
+        spillFilePrefix_{std::move(spillFilePrefix)} {}
+
+  // Return the rows of `block` the keys of which haven't been seen before (in
+  // this or a previous block). When spilling, the rows with keys that are not
+  // contained in the hash set are written to the spill files instead.
+  IdTable processBlock(const IdTable& block) {
+    std::vector<size_t> newRows;
+    std::array<std::vector<size_t>, numSpillPartitions> rowsToSpill;
+    for (size_t row = 0; row < block.numRows(); ++row) {
+      if (row % checkInterval == 0) {
+        checkCancellation_();
+        isSpilling_ =
+            isSpilling_ || keys_->getNumBytes() > inMemoryThreshold_;
+      }
+      if (!isSpilling_) {
+        if (keys_->isNew(block, keyColumns_, row, true)) {
+          newRows.push_back(row);
+        }
+      } else if (keys_->isNew(block, keyColumns_, row, false)) {
+        uint64_t hash = hashKey(block, keyColumns_, row);
+        rowsToSpill[hash >> (64 - numSpillPartitionBits)].push_back(row);
+      }
+    }
+    for (size_t partition = 0; partition < numSpillPartitions; ++partition) {
+      if (rowsToSpill[partition].empty()) {
+        continue;
+      }
+      auto& spillFile = spillFiles_[partition];
+      if (!spillFile) {
+        spillFile = std::make_unique<SpillFile>(
+            absl::StrCat(spillFilePrefix_, partition, ".dat"), numColumns_,
+            spillFileMemory, allocator_);
+      }
+      for (size_t row : rowsToSpill[partition]) {
+        spillFile->push(block[row]);
+      }
+      numSpilledRows_ += rowsToSpill[partition].size();
+    }
+    return copyRows(block, newRows, allocator_);
+  }
+
+  // Return the distinct rows of the next spill file, or `std::nullopt` if all
+  // spill files have been processed. Must only be called after all blocks of
+  // the input have been passed to `processBlock`.
+  std::optional<IdTable> processNextSpillFile() {
+    while (nextSpillPartition_ < numSpillPartitions) {
+      auto& spillFile = spillFiles_[nextSpillPartition_++];
+      if (!spillFile) {
+        continue;
+      }
+      // The keys of the spilled rows are disjoint from the keys in the hash
+      // set, and so are the keys of different partitions, so each partition
+      // can be processed with a fresh hash set.
+      keys_ = std::make_unique<KeySet>(keyColumns_.size(), allocator_);
+      IdTable result{numColumns_, allocator_};
+      IdTable block{numColumns_, allocator_};
+      std::vector<size_t> newRows;
+      auto processSpilledBlock = [&]() {
+        checkCancellation_();
+        newRows.clear();
+        for (size_t row = 0; row < block.numRows(); ++row) {
+          if (keys_->isNew(block, keyColumns_, row, true)) {
+            newRows.push_back(row);
+          }
+        }
+        result.insertAtEnd(copyRows(block, newRows, allocator_));
+        block.clear();
+      };
+      for (const auto& row : spillFile->getRows()) {
+        block.push_back(row);
+        if (block.numRows() == spillBlockSize) {
+          processSpilledBlock();
+        }
+      }
+      if (!block.empty()) {
+        processSpilledBlock();
+      }
+      spillFile.reset();
+      return result;
+    }
+    keys_.reset();
+    return std::nullopt;
+  }
+
+  // The total number of rows that were written to the spill files.
+  size_t numSpilledRows() const { return numSpilledRows_; }
+};
+
+// Lazily yield the distinct rows of the blocks of a lazy input, first the ones
+// that were found via the hash set (in the order of the input), then the ones
+// of the spill files (one partition at a time).
+struct LazyHashDistinct
+    : ad_utility::InputRangeFromGet<Result::IdTableVocabPair> {
+  std::shared_ptr<const Result> inputResult_;
+  Result::LazyResult input_;
+  std::optional<Result::LazyResult::iterator> iterator_ = std::nullopt;
+  HashDistinctState state_;
+  // The local vocabs of all the blocks of the input. The spilled rows may refer
+  // to any of them, and the `Id`s of the keys in the hash set have to remain
+  // valid while the hash set is in use.
+  LocalVocab localVocab_;
+  // Called with the number of spilled rows once the input has been consumed.
+  std::function<void(size_t)> onFinished_;
+  bool inputIsConsumed_ = false;
+  bool done_ = false;
+
+  LazyHashDistinct(std::shared_ptr<const Result> inputResult,
+                   HashDistinctState state,
+                   std::function<void(size_t)> onFinished)
+      : inputResult_{std::move(inputResult)},
+        input_{inputResult_->idTables()},
+        state_{std::move(state)},
+        onFinished_{std::move(onFinished)} {}
+
+  std::optional<Result::IdTableVocabPair> get() override {
+    while (!inputIsConsumed_) {
+      if (iterator_) {
+        ++iterator_.value();
+      } else {
+        iterator_ = input_.begin();
+      }
+      if (iterator_.value() == input_.end()) {
+        inputIsConsumed_ = true;
+        break;
+      }
+      auto& [block, localVocab] = *iterator_.value();
+      localVocab_.mergeWith(localVocab);
+      IdTable result = state_.processBlock(block);
+      if (!result.empty()) {
+        return Result::IdTableVocabPair{std::move(result),
+                                        std::move(localVocab)};
+      }
+    }
+    if (auto result = state_.processNextSpillFile()) {
+      return Result::IdTableVocabPair{std::move(result.value()),
+                                      localVocab_.clone()};
+    }
+    if (!done_) {
+      done_ = true;
+      onFinished_(state_.numSpilledRows());
+    }
+    return std::nullopt;
+  }
+};
+}  // namespace
+
+// _____________________________________________________________________________
+HashDistinct::HashDistinct(QueryExecutionContext* qec,
+                           std::shared_ptr<QueryExecutionTree> subtree,
+                           const std::vector<ColumnIndex>& keepIndices)
+    : Operation{qec}, subtree_{std::move(subtree)}, keepIndices_{keepIndices} {
+  AD_CORRECTNESS_CHECK(subtree_);
+}
+
+// _____________________________________________________________________________
+std::string HashDistinct::getCacheKeyImpl() const {
+  return absl::StrCat("HASH DISTINCT (", subtree_->getCacheKey(), ") (",
+                      absl::StrJoin(keepIndices_, ","), ")");
+}
+
+// _____________________________________________________________________________
+std::string HashDistinct::getDescriptor() const { return "HashDistinct"; }
+
+// _____________________________________________________________________________
+size_t HashDistinct::getResultWidth() const {
+  return subtree_->getResultWidth();
+}
+
+// _____________________________________________________________________________
+size_t HashDistinct::getCostEstimate() {
+  double costOfHashing =
+      getExecutionContext()->getCostFactor("HASH_DISTINCT_COST") *
+      static_cast<double>(subtree_->getSizeEstimate());
+  return static_cast<size_t>(costOfHashing) + subtree_->getCostEstimate();
+}
+
+// _____________________________________________________________________________
+VariableToColumnMap HashDistinct::computeVariableToColumnMap() const {
+  return subtree_->getVariableColumns();
+}
+
+// _____________________________________________________________________________
+Result HashDistinct::computeResult(bool requestLaziness) {
+  std::shared_ptr<const Result> subRes = subtree_->getResult(true);
+  HashDistinctState state{
+      keepIndices_,
+      getResultWidth(),
+      allocator(),
+      [this]() { checkCancellation(); },
+      // The hash set may use at most half of the memory that is left for the
+      // query, s.t. there is enough memory left for the result.
+      std::min(getRuntimeParameter<
+                   &RuntimeParameters::hashDistinctInMemoryThreshold_>()
+                   .getBytes(),
+               allocator().amountMemoryLeft().getBytes() / 2),
+      absl::StrCat(getExecutionContext()->getIndex().getOnDiskBase(),
+                   ".hash-distinct.", ad_utility::UuidGenerator{}(), ".")};
+  auto addSpillDetail = [this](size_t numSpilledRows) {
+    if (numSpilledRows > 0) {
+      runtimeInfo().addDetail("numSpilledRows", numSpilledRows);
+    }
+  };
+
+  if (subRes->isFullyMaterialized()) {
+    IdTable result = state.processBlock(subRes->idTable());
+    while (auto spilledRows = state.processNextSpillFile()) {
+      result.insertAtEnd(spilledRows.value());
+    }
+    addSpillDetail(state.numSpilledRows());
+    return {std::move(result), resultSortedOn(),
+            subRes->getSharedLocalVocab()};
+  }
+
+  Result::LazyResult lazyResult{
+      LazyHashDistinct{std::move(subRes), std::move(state), addSpillDetail}};
+  if (requestLaziness) {
+    return {std::move(lazyResult), resultSortedOn()};
+  }
+  IdTable result{getResultWidth(), allocator()};
+  LocalVocab localVocab;
+  for (const auto& [block, blockLocalVocab] : lazyResult) {
+    result.insertAtEnd(block);
+    localVocab.mergeWith(blockLocalVocab);
+  }
+  return {std::move(result), resultSortedOn(), std::move(localVocab)};
+}
+
+// _____________________________________________________________________________
+std::unique_ptr<Operation> HashDistinct::cloneImpl() const {
+  return std::make_unique<HashDistinct>(_executionContext, subtree_->clone(),
+                                        keepIndices_);
+}
@@ -0,0 +1,77 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#ifndef QLEVER_SRC_ENGINE_HASHDISTINCT_H
+#define QLEVER_SRC_ENGINE_HASHDISTINCT_H
+
+#include <vector>
+
+#include "engine/Operation.h"
+#include "engine/QueryExecutionTree.h"
+
+// A `DISTINCT` that, unlike `Distinct`, doesn't require its input to be sorted.
+// The rows of the input are streamed (lazily if possible) and each row is only
+// kept if the values of its `keepIndices` columns haven't been seen before,
+// which is checked with a hash set. If the hash set exceeds the
+// `hash-distinct-in-memory-threshold`, the rows with values that are not yet
+// contained in the hash set are spilled to disk in partitions by their hash,
+// and each of these partitions is then deduplicated separately after the input
+// has been consumed. The rows are thus not necessarily in the order of the
+// input, which is why the result is not considered sorted. The query planner
+// uses this operation instead of a sort followed by a `Distinct` when this is
+// cheaper according to the cost factor `HASH_DISTINCT_COST`, see
+// `QueryPlanner::getDistinctRow`.
+class HashDistinct : public Operation {
+ private:
+  std::shared_ptr<QueryExecutionTree> subtree_;
+  std::vector<ColumnIndex> keepIndices_;
+
+ public:
+  HashDistinct(QueryExecutionContext* qec,
+               std::shared_ptr<QueryExecutionTree> subtree,
+               const std::vector<ColumnIndex>& keepIndices);
+
+  // All following functions are inherited from `Operation`, see there for
+  // comments.
+ protected:
+  std::string getCacheKeyImpl() const override;
+
+ public:
+  std::string getDescriptor() const override;
+
+  size_t getResultWidth() const override;
+
+  std::vector<ColumnIndex> resultSortedOn() const override { return {}; }
+
+  // Get all columns that need to be distinct.
+  const std::vector<ColumnIndex>& getDistinctColumns() const {
+    return keepIndices_;
+  }
+
+ private:
+  uint64_t getSizeEstimateBeforeLimit() override {
+    return subtree_->getSizeEstimate();
+  }
+
+ public:
+  size_t getCostEstimate() override;
+
+  float getMultiplicity(size_t col) override {
+    return subtree_->getMultiplicity(col);
+  }
+
+  bool knownEmptyResult() override { return subtree_->knownEmptyResult(); }
+
+  std::vector<QueryExecutionTree*> getChildren() override {
+    return {subtree_.get()};
+  }
+
+ private:
+  std::unique_ptr<Operation> cloneImpl() const override;
+
+  Result computeResult(bool requestLaziness) override;
+
+  VariableToColumnMap computeVariableToColumnMap() const override;
+};
+
+#endif  // QLEVER_SRC_ENGINE_HASHDISTINCT_H
@@ -0,0 +1,292 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#include "engine/HashJoin.h"
+
+#include <numeric>
+#include <sstream>
+
+#include "engine/AddCombinedRowToTable.h"
+#include "engine/JoinHashTable.h"
+#include "engine/JoinHelpers.h"
+#include "util/JoinAlgorithms/JoinColumnMapping.h"
+#include "util/TransparentFunctors.h"
+
+using namespace qlever::joinHelpers;
+
+// _____________________________________________________________________________
+HashJoin::HashJoin(QueryExecutionContext* qec,
+                   std::shared_ptr<QueryExecutionTree> t1,
+                   std::shared_ptr<QueryExecutionTree> t2,
+                   bool allowSwappingChildrenOnlyForTesting)
+    : Operation{qec} {
+  AD_CONTRACT_CHECK(t1 && t2);
+  // Make sure subtrees are ordered so that identical queries can be identified.
+  if (allowSwappingChildrenOnlyForTesting &&
+      t1->getCacheKey() > t2->getCacheKey()) {
+    std::swap(t1, t2);
+  }
+  joinColumns_ = QueryExecutionTree::getJoinColumns(*t1, *t2);
+  AD_CONTRACT_CHECK(!joinColumns_.empty());
+  AD_CONTRACT_CHECK(joinColumnsAreAlwaysDefined(joinColumns_, t1, t2),
+                    "The join columns of a hash join must not contain UNDEF "
+                    "values");
+  left_ = std::move(t1);
+  right_ = std::move(t2);
+  // The smaller input is inserted into the hash table.
+  buildSideIsLeft_ = left_->getSizeEstimate() < right_->getSizeEstimate();
+}
+
+// _____________________________________________________________________________
+std::string HashJoin::getCacheKeyImpl() const {
+  std::ostringstream os;
+  auto writeJoinColumns = [this, &os](size_t side) {
+    os << "join-columns: [";
+    for (size_t i = 0; i < joinColumns_.size(); i++) {
+      os << joinColumns_[i][side]
+         << (i < joinColumns_.size() - 1 ? " & " : "");
+    }
+    os << "]";
+  };
+  os << "HASH_JOIN\n" << left_->getCacheKey() << " ";
+  writeJoinColumns(0);
+  os << "\n|X|\n" << right_->getCacheKey() << " ";
+  writeJoinColumns(1);
+  // The build side determines the order of the result.
+  os << "\nbuild side: " << (buildSideIsLeft_ ? "left" : "right");
+  return std::move(os).str();
+}
+
+// _____________________________________________________________________________
+std::string HashJoin::getDescriptor() const {
+  std::string joinVars = "";
+  for (auto jc : joinColumns_) {
+    joinVars +=
+        left_->getVariableAndInfoByColumnIndex(jc[0]).first.name() + " ";
+  }
+  return "HashJoin on " + joinVars;
+}
+
+// _____________________________________________________________________________
+size_t HashJoin::getResultWidth() const {
+  return left_->getResultWidth() + right_->getResultWidth() -
+         joinColumns_.size();
+}
+
+// _____________________________________________________________________________
+std::vector<ColumnIndex> HashJoin::resultSortedOn() const {
+  // The result is in the order of the probe side.
+  if (!buildSideIsLeft_) {
+    return left_->resultSortedOn();
+  }
+  // Map the columns of the right child to the columns of the result, see
+  // `computeVariableToColumnMap`.
+  std::vector<ColumnIndex> resultColumnOfRightColumn;
+  size_t nextNonJoinColumn = left_->getResultWidth();
+  for (size_t col = 0; col < right_->getResultWidth(); ++col) {
+    auto it = ql::ranges::find(joinColumns_, col, ad_utility::second);
+    resultColumnOfRightColumn.push_back(
+        it != joinColumns_.end() ? (*it)[0] : nextNonJoinColumn++);
+  }
+  std::vector<ColumnIndex> sortedOn;
+  for (auto col : right_->resultSortedOn()) {
+    sortedOn.push_back(resultColumnOfRightColumn.at(col));
+  }
+  return sortedOn;
+}
+
+// _____________________________________________________________________________
+float HashJoin::getMultiplicity(size_t col) {
+  if (!multiplicitiesComputed_) {
+    computeSizeEstimateAndMultiplicities();
+  }
+  return multiplicities_.at(col);
+}
+
+// _____________________________________________________________________________
+uint64_t HashJoin::getSizeEstimateBeforeLimit() {
+  if (!multiplicitiesComputed_) {
+    computeSizeEstimateAndMultiplicities();
+  }
+  return sizeEstimate_;
+}
+
+// _____________________________________________________________________________
+size_t HashJoin::getCostEstimate() {
+  const auto& build = buildSideIsLeft_ ? left_ : right_;
+  const auto& probe = buildSideIsLeft_ ? right_ : left_;
+  auto* qec = getExecutionContext();
+  double costOfHashing =
+      qec->getCostFactor("HASH_JOIN_BUILD_COST") *
+          static_cast<double>(build->getSizeEstimate()) +
+      qec->getCostFactor("HASH_JOIN_PROBE_COST") *
+          static_cast<double>(probe->getSizeEstimate());
+  return getSizeEstimateBeforeLimit() + static_cast<size_t>(costOfHashing) +
+         left_->getCostEstimate() + right_->getCostEstimate();
+}
+
+// _____________________________________________________________________________
+void HashJoin::computeSizeEstimateAndMultiplicities() {
+  auto [sizeEstimate, multiplicities] =
+      qlever::joinHelpers::computeSizeEstimateAndMultiplicities(
+          *left_, *right_, joinColumns_);
+  sizeEstimate_ = sizeEstimate;
+  multiplicities_ = std::move(multiplicities);
+  multiplicitiesComputed_ = true;
+}
+
+// _____________________________________________________________________________
+VariableToColumnMap HashJoin::computeVariableToColumnMap() const {
+  return makeVarToColMapForJoinOperation(
+      left_->getVariableColumns(), right_->getVariableColumns(), joinColumns_,
+      BinOpType::Join, left_->getResultWidth());
+}
+
+// _____________________________________________________________________________
+Result HashJoin::createEmptyResult() const {
+  return {IdTable{getResultWidth(), allocator()}, resultSortedOn(),
+          LocalVocab{}};
+}
+
+// _____________________________________________________________________________
+Result HashJoin::computeResult(bool requestLaziness) {
+  const auto& buildTree = buildSideIsLeft_ ? left_ : right_;
+  const auto& probeTree = buildSideIsLeft_ ? right_ : left_;
+  if (knownEmptyResult()) {
+    left_->getRootOperation()->updateRuntimeInformationWhenOptimizedOut();
+    right_->getRootOperation()->updateRuntimeInformationWhenOptimizedOut();
+    return createEmptyResult();
+  }
+
+  // The build side always has to be fully materialized.
+  auto buildResult = buildTree->getResult();
+  checkCancellation();
+  if (buildResult->idTable().empty()) {
+    probeTree->getRootOperation()->updateRuntimeInformationWhenOptimizedOut();
+    return createEmptyResult();
+  }
+  auto probeResult = probeTree->getResult(true);
+  checkCancellation();
+
+  // The join algorithm below works on inputs the first columns of which are
+  // the join columns, see `JoinColumnMapping` for details.
+  ad_utility::JoinColumnMapping joinColumnMapping{
+      joinColumns_, left_->getResultWidth(), right_->getResultWidth()};
+  auto buildPermutation = buildSideIsLeft_
+                              ? joinColumnMapping.permutationLeft()
+                              : joinColumnMapping.permutationRight();
+  auto probePermutation = buildSideIsLeft_
+                              ? joinColumnMapping.permutationRight()
+                              : joinColumnMapping.permutationLeft();
+  auto action = [this, buildResult = std::move(buildResult),
+                 probeResult = std::move(probeResult),
+                 buildPermutation = std::move(buildPermutation),
+                 probePermutation = std::move(probePermutation)](
+                    std::function<void(IdTable&, LocalVocab&)> yieldTable) {
+    size_t numJoinColumns = joinColumns_.size();
+    std::vector<ColumnIndex> keyColumns(numJoinColumns);
+    std::iota(keyColumns.begin(), keyColumns.end(), 0);
+
+    auto build = ad_utility::makeIdTableAndFirstCols<1>(
+        buildResult->idTable().asColumnSubsetView(buildPermutation),
+        buildResult->getCopyOfLocalVocab());
+    size_t numBuildRows = buildResult->idTable().numRows();
+    JoinHashTable hashTable{
+        build.asStaticView<0>().asColumnSubsetView(keyColumns),
+        getNumPartitionsForParallelJoin(numBuildRows), allocator(),
+        cancellationHandle_};
+
+    // Add the result of joining the rows `[begin, end)` of the `probe` block
+    // with the build side to the `rowAdder`.
+    auto probeRows = [&](const auto& probe, size_t begin, size_t end,
+                         ad_utility::AddCombinedRowToIdTable& rowAdder) {
+      auto probeKeys =
+          probe.template asStaticView<0>().asColumnSubsetView(keyColumns);
+      if (buildSideIsLeft_) {
+        rowAdder.setInput(build, probe);
+      } else {
+        rowAdder.setInput(probe, build);
+      }
+      for (size_t row = begin; row < end; ++row) {
+        if ((row - begin) % CHUNK_SIZE == 0) {
+          checkCancellation();
+        }
+        hashTable.forEachMatch(probeKeys, row, [&](size_t buildRow) {
+          if (buildSideIsLeft_) {
+            rowAdder.addRow(buildRow, row);
+          } else {
+            rowAdder.addRow(row, buildRow);
+          }
+        });
+      }
+    };
+
+    auto rowAdder = getRowAdderForJoin(*this, numJoinColumns, true,
+                                       std::move(yieldTable));
+    if (probeResult->isFullyMaterialized()) {
+      auto probe = ad_utility::makeIdTableAndFirstCols<1>(
+          probeResult->idTable().asColumnSubsetView(probePermutation),
+          probeResult->getCopyOfLocalVocab());
+      size_t numProbeRows = probeResult->idTable().numRows();
+      size_t numChunks =
+          getNumPartitionsForParallelJoin(numBuildRows + numProbeRows);
+      if (numChunks <= 1) {
+        probeRows(probe, 0, numProbeRows, rowAdder);
+        return std::move(rowAdder).toIdTableVocabPair();
+      }
+      // Large inputs are probed in parallel. The chunks of the probe side are
+      // stored as the left side of `JoinPartition`s.
+      std::vector<ad_utility::JoinPartition> chunks;
+      for (size_t i = 0; i < numChunks; ++i) {
+        size_t begin = i * numProbeRows / numChunks;
+        size_t end = (i + 1) * numProbeRows / numChunks;
+        if (begin < end) {
+          chunks.push_back({begin, end, 0, numBuildRows});
+        }
+      }
+      IdTable result = joinPartitionsInParallel(
+          chunks, IdTable{getResultWidth(), allocator()},
+          [&](const ad_utility::JoinPartition& chunk, IdTable table) {
+            ad_utility::AddCombinedRowToIdTable chunkRowAdder{
+                numJoinColumns, std::move(table), cancellationHandle_};
+            probeRows(probe, chunk.beginLeft_, chunk.endLeft_, chunkRowAdder);
+            return std::move(chunkRowAdder).resultTable();
+          });
+      LocalVocab localVocab = buildResult->getCopyOfLocalVocab();
+      localVocab.mergeWith(probeResult->localVocab());
+      return Result::IdTableVocabPair{std::move(result),
+                                      std::move(localVocab)};
+    }
+
+    // A lazy probe side is processed block by block.
+    for (const auto& probe :
+         convertGenerator(probeResult->idTables(), probePermutation)) {
+      probeRows(probe, 0, probe.size(), rowAdder);
+    }
+    return std::move(rowAdder).toIdTableVocabPair();
+  };
+  return createResultFromAction(requestLaziness, std::move(action),
+                                resultSortedOn(),
+                                joinColumnMapping.permutationResult());
+}
+
+// _____________________________________________________________________________
+std::unique_ptr<Operation> HashJoin::cloneImpl() const {
+  auto copy = std::make_unique<HashJoin>(*this);
+  copy->left_ = left_->clone();
+  copy->right_ = right_->clone();
+  return copy;
+}
+
+// _____________________________________________________________________________
+bool HashJoin::columnOriginatesFromGraphOrUndef(
+    const Variable& variable) const {
+  AD_CONTRACT_CHECK(getExternallyVisibleVariableColumns().contains(variable));
+  // For the join columns we don't union the elements, we intersect them so we
+  // can have a more efficient implementation.
+  if (left_->getVariableColumnOrNullopt(variable).has_value() &&
+      right_->getVariableColumnOrNullopt(variable).has_value()) {
+    return doesJoinProduceGuaranteedGraphValuesOrUndef(left_, right_, variable);
+  }
+  return Operation::columnOriginatesFromGraphOrUndef(variable);
+}
@@ -0,0 +1,91 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#ifndef QLEVER_SRC_ENGINE_HASHJOIN_H
+#define QLEVER_SRC_ENGINE_HASHJOIN_H
+
+#include <array>
+#include <vector>
+
+#include "engine/Operation.h"
+#include "engine/QueryExecutionTree.h"
+
+// A join on one or more columns that, unlike `Join` and `MultiColumnJoin`,
+// doesn't require its inputs to be sorted. The child with the smaller size
+// estimate (the "build side") is fully materialized and inserted into a
+// `JoinHashTable`, the other child (the "probe side") is then streamed (lazily
+// if possible) and each of its rows is looked up in the hash table. The rows
+// of the result are in the order of the probe side, so the result is sorted if
+// the probe side is. The query planner uses this operation instead of a sort
+// followed by a merge join when this is cheaper according to the cost factors
+// `HASH_JOIN_BUILD_COST` and `HASH_JOIN_PROBE_COST`, see
+// `QueryPlanner::createHashJoin`.
+//
+// NOTE: The join columns of both children must be statically guaranteed to
+// not contain UNDEF values.
+class HashJoin : public Operation {
+ private:
+  std::shared_ptr<QueryExecutionTree> left_;
+  std::shared_ptr<QueryExecutionTree> right_;
+  std::vector<std::array<ColumnIndex, 2>> joinColumns_;
+
+  // True iff the left child is the build side.
+  bool buildSideIsLeft_;
+
+  std::vector<float> multiplicities_;
+  uint64_t sizeEstimate_ = 0;
+  bool multiplicitiesComputed_ = false;
+
+ public:
+  // `allowSwappingChildrenOnlyForTesting` should only ever be changed by tests.
+  HashJoin(QueryExecutionContext* qec, std::shared_ptr<QueryExecutionTree> t1,
+           std::shared_ptr<QueryExecutionTree> t2,
+           bool allowSwappingChildrenOnlyForTesting = true);
+
+  // All following functions are inherited from `Operation`, see there for
+  // comments.
+ protected:
+  std::string getCacheKeyImpl() const override;
+
+ public:
+  std::string getDescriptor() const override;
+
+  size_t getResultWidth() const override;
+
+  std::vector<ColumnIndex> resultSortedOn() const override;
+
+  bool knownEmptyResult() override {
+    return left_->knownEmptyResult() || right_->knownEmptyResult();
+  }
+
+  float getMultiplicity(size_t col) override;
+
+ private:
+  uint64_t getSizeEstimateBeforeLimit() override;
+
+ public:
+  size_t getCostEstimate() override;
+
+  std::vector<QueryExecutionTree*> getChildren() override {
+    return {left_.get(), right_.get()};
+  }
+
+  bool columnOriginatesFromGraphOrUndef(
+      const Variable& variable) const override;
+
+  // Return true iff the left child is the build side (used for testing).
+  bool buildSideIsLeft() const { return buildSideIsLeft_; }
+
+ private:
+  std::unique_ptr<Operation> cloneImpl() const override;
+
+  Result computeResult(bool requestLaziness) override;
+
+  VariableToColumnMap computeVariableToColumnMap() const override;
+
+  void computeSizeEstimateAndMultiplicities();
+
+  Result createEmptyResult() const;
+};
+
+#endif  // QLEVER_SRC_ENGINE_HASHJOIN_H
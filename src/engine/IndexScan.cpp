@@ -11,6 +11,7 @@
 #include <string>
 #include <utility>
 
+#include "engine/JoinColumnSummary.h"
 #include "engine/MaterializedViews.h"
 #include "engine/QueryExecutionTree.h"
 #include "engine/VariableToColumnMap.h"
@@ -160,6 +161,47 @@ bool IndexScan::canResultBeCachedImpl() const {
   return !scanSpecAndBlocksIsPrefiltered_;
 };
 
+// _____________________________________________________________________________
+bool IndexScan::applyJoinColumnSummaryImpl(const Variable& variable,
+                                           const JoinColumnSummary& summary) {
+  // The blocks are only sorted by the first variable. UNDEF values (which can
+  // occur in materialized views) match every value, so we can't skip any
+  // blocks for such columns.
+  auto sortedVarAndColIndex =
+      getSortedVariableAndMetadataColumnIndexForPrefiltering();
+  if (!sortedVarAndColIndex.has_value() ||
+      sortedVarAndColIndex.value().first != variable ||
+      getExternallyVisibleVariableColumns().at(variable).mightContainUndef_ !=
+          ColumnIndexAndTypeInfo::AlwaysDefined) {
+    return false;
+  }
+  auto metadataAndBlocks = getMetadataForScan();
+  if (!metadataAndBlocks.has_value()) {
+    return false;
+  }
+  auto relevantId = [&metadataAndBlocks](const auto& triple) {
+    return CompressedRelationReader::getRelevantIdFromTriple(
+        triple, metadataAndBlocks.value());
+  };
+  auto blocks = filterBlockMetadataRanges(
+      scanSpecAndBlocks_.blockMetadata_,
+      [&summary, &relevantId](const CompressedBlockMetadata& block) {
+        return summary.mayContainValueBetween(relevantId(block.firstTriple_),
+                                              relevantId(block.lastTriple_));
+      });
+  ScanSpecAndBlocks prefiltered{scanSpecAndBlocks_.scanSpec_, blocks};
+  size_t numBlocksSkipped = scanSpecAndBlocks_.sizeBlockMetadata_ -
+                            prefiltered.sizeBlockMetadata_;
+  if (numBlocksSkipped == 0) {
+    return false;
+  }
+  runtimeInfo().addDetail("num-blocks-skipped-by-join-column-summary",
+                          numBlocksSkipped);
+  scanSpecAndBlocks_ = std::move(prefiltered);
+  scanSpecAndBlocksIsPrefiltered_ = true;
+  return true;
+}
+
 // _____________________________________________________________________________
 string IndexScan::getDescriptor() const {
   auto additionalVars = absl::StrJoin(
@@ -228,24 +270,56 @@ IndexScan::getUpdatedQueryExecutionTreeWithPrefilterApplied(
 
   // Return a new `IndexScan` with updated `scanSpecAndBlocks_`, by
   // intersecting its block ranges with the block ranges from the applicable
-  // prefilters.
+  // prefilters. The blocks are only sorted by the column of the `sortedVar`;
+  // for the variables in the subsequent columns, the column statistics of the
+  // blocks are used instead.
   const auto& [sortedVar, colIndex] = sortedVarAndColIndex.value();
-  auto it =
-      ql::ranges::find(prefilterVariablePairs, sortedVar, ad_utility::second);
-  if (it != prefilterVariablePairs.end()) {
-    const auto& blockMetadataRanges =
+  const auto& permutedTriple = getPermutedTriple();
+  const auto scanSpecAndBlocks = getScanSpecAndBlocks();
+  // The blocks of the scan might consist of several ranges (the Bloom filters
+  // of the blocks can split the blocks for a fixed `col1Id`), each of which is
+  // evaluated separately.
+  auto evaluatePrefilter = [this, &scanSpecAndBlocks](const auto& prefilter,
+                                                      size_t col,
+                                                      bool isSortedColumn) {
+    BlockMetadataRanges result;
+    for (const auto& range : scanSpecAndBlocks.blockMetadata_) {
+      BlockMetadataSpan blockMetadataSpan{range.begin(), range.end()};
+      auto relevantBlocks =
+          isSortedColumn
+              ? prefilter.evaluate(getLocalVocabContext(), blockMetadataSpan,
+                                   col)
+              : prefilter.evaluateWithColumnStatistics(
+                    getLocalVocabContext(), blockMetadataSpan, col);
+      ql::ranges::move(relevantBlocks, std::back_inserter(result));
+    }
+    return result;
+  };
+  std::optional<BlockMetadataRanges> blockMetadataRanges;
+  for (size_t col = colIndex; col < permutedTriple.size(); ++col) {
+    if (!permutedTriple.at(col)->isVariable()) {
+      continue;
+    }
+    auto it = ql::ranges::find(prefilterVariablePairs,
+                               permutedTriple.at(col)->getVariable(),
+                               ad_utility::second);
+    if (it == prefilterVariablePairs.end()) {
+      continue;
+    }
+    auto relevantBlocks =
+        evaluatePrefilter(*it->first, col, col == colIndex);
+    blockMetadataRanges =
         prefilterExpressions::detail::logicalOps::getIntersectionOfBlockRanges(
-            it->first->evaluate(getLocalVocabContext(),
-                                getScanSpecAndBlocks().getBlockMetadataSpan(),
-                                colIndex),
-            scanSpecAndBlocks_.blockMetadata_);
-
-    return makeCopyWithPrefilteredScanSpecAndBlocks(
-        {scanSpecAndBlocks_.scanSpec_, blockMetadataRanges});
+            relevantBlocks,
+            blockMetadataRanges.value_or(scanSpecAndBlocks_.blockMetadata_));
   }
 
   // If no prefilter applies, return `std::nullopt`.
-  return std::nullopt;
+  if (!blockMetadataRanges.has_value()) {
+    return std::nullopt;
+  }
+  return makeCopyWithPrefilteredScanSpecAndBlocks(
+      {scanSpecAndBlocks_.scanSpec_, std::move(blockMetadataRanges.value())});
 }
 
 // _____________________________________________________________________________
@@ -450,16 +524,20 @@ Permutation::ScanSpecAndBlocks IndexScan::getScanSpecAndBlocks() const {
 
 // _____________________________________________________________________________
 CompressedRelationReader::IdTableGeneratorInputRange IndexScan::getLazyScan(
-    std::optional<std::vector<CompressedBlockMetadata>> blocks) const {
+    std::optional<std::vector<CompressedBlockMetadata>> blocks,
+    std::optional<ql::span<const Id>> joinColumn) const {
   // If there is a LIMIT or OFFSET clause that constrains the scan
   // (which can happen with an explicit subquery), we cannot use the prefiltered
   // blocks, as we currently have no mechanism to include limits and offsets
-  // into the prefiltering (`std::nullopt` means `scan all blocks`).
-  auto filteredBlocks =
-      getLimitOffset().isUnconstrained() ? std::move(blocks) : std::nullopt;
+  // into the prefiltering (`std::nullopt` means `scan all blocks`). The same
+  // holds for the filtering of the rows by the `joinColumn`.
+  bool isUnconstrained = getLimitOffset().isUnconstrained();
+  auto filteredBlocks = isUnconstrained ? std::move(blocks) : std::nullopt;
+  auto filteringJoinColumn = isUnconstrained ? joinColumn : std::nullopt;
   auto lazyScanAllCols = permutation().lazyScan(
       scanSpecAndBlocks_, filteredBlocks, additionalColumns(),
-      cancellationHandle_, locatedTriplesState(), getLimitOffset());
+      cancellationHandle_, locatedTriplesState(), getLimitOffset(),
+      filteringJoinColumn);
 
   return CompressedRelationReader::IdTableGeneratorInputRange{
       ad_utility::CachingTransformInputRange<
@@ -549,9 +627,11 @@ IndexScan::lazyScanForJoinOfColumnWithScan(
   if (!metaBlocks.has_value() || joinColumn.empty()) {
     return {};
   }
+  // With UNDEF values in the `joinColumn`, every row of the scan can match, so
+  // we neither prefilter the blocks nor the rows.
+  bool hasUndef = joinColumn.front().isUndefined();
   auto matchingBlocks =
       [&]() -> std::optional<std::vector<CompressedBlockMetadata>> {
-    bool hasUndef = joinColumn.front().isUndefined();
     if (hasUndef) {
       return std::nullopt;
     }
@@ -559,7 +639,9 @@ IndexScan::lazyScanForJoinOfColumnWithScan(
         joinColumn, metaBlocks.value());
     return std::move(blocks.matchingBlocks_);
   }();
-  auto result = getLazyScan(std::move(matchingBlocks));
+  auto result =
+      getLazyScan(std::move(matchingBlocks),
+                  hasUndef ? std::nullopt : std::optional{joinColumn});
   result.details().numBlocksAll_ = metaBlocks.value().sizeBlockMetadata_;
   return result;
 }
@@ -587,6 +669,8 @@ void IndexScan::updateRuntimeInfoForLazyScan(
   updateIfPositive(metadata.numBlocksPostprocessed_,
                    "num-blocks-postprocessed");
   updateIfPositive(metadata.numBlocksWithUpdate_, "num-blocks-with-update");
+  updateIfPositive(metadata.numBlocksSkippedBecauseOfJoin_,
+                   "num-blocks-skipped-join");
   signalQueryUpdate(sendPriority);
 }
 
@@ -122,6 +122,10 @@ class IndexScan final : public Operation {
   // the blocks that can theoretically contain matching rows when performing a
   // join between the first column of the result with the `joinColumn`.
   // Requires that the `joinColumn` is sorted, else the behavior is undefined.
+  // If the `joinColumn` contains no UNDEF values, then additionally only the
+  // rows that actually match are yielded, and the remaining columns of a block
+  // are only decompressed if the block contains at least one matching row. In
+  // this case the `joinColumn` must outlive the returned generator.
   CompressedRelationReader::IdTableGeneratorInputRange
   lazyScanForJoinOfColumnWithScan(ql::span<const Id> joinColumn) const;
 
@@ -244,6 +248,11 @@ class IndexScan final : public Operation {
   // `false` if prefilterd `BlockMetadataRanges` are contained.
   bool canResultBeCachedImpl() const override;
 
+  // Skip the blocks that can't contain a value from the `summary`, if the
+  // `variable` is the column by which the result is sorted.
+  bool applyJoinColumnSummaryImpl(const Variable& variable,
+                                  const JoinColumnSummary& summary) override;
+
   VariableToColumnMap computeVariableToColumnMap() const override;
 
   // Return a new `QueryExecutionTree` with prefiltered `scanSpecAndBlocks`. If
@@ -270,8 +279,8 @@ class IndexScan final : public Operation {
   // Helper functions for the public `getLazyScanFor...` methods and
   // `chunkedIndexScan` (see above).
   CompressedRelationReader::IdTableGeneratorInputRange getLazyScan(
-      std::optional<std::vector<CompressedBlockMetadata>> blocks =
-          std::nullopt) const;
+      std::optional<std::vector<CompressedBlockMetadata>> blocks = std::nullopt,
+      std::optional<ql::span<const Id>> joinColumn = std::nullopt) const;
   std::optional<Permutation::MetadataAndBlocks> getMetadataForScan() const;
 
   // If the `varsToKeep_` member is set, meaning that this `IndexScan` only
@@ -17,6 +17,7 @@
 #include "engine/AddCombinedRowToTable.h"
 #include "engine/CallFixedSize.h"
 #include "engine/IndexScan.h"
+#include "engine/JoinColumnSummary.h"
 #include "engine/JoinHelpers.h"
 #include "engine/OperationBindPushDownImpl.h"
 #include "engine/Service.h"
@@ -135,6 +136,14 @@ Result Join::computeResult(bool requestLaziness) {
   auto rightResIfCached = getCachedOrSmallResult(*_right);
   checkCancellation();
 
+  // If exactly one of the children is already materialized, its join column
+  // restricts the rows of the other child that can possibly match.
+  if (leftResIfCached && !rightResIfCached) {
+    passJoinColumnSummary(*leftResIfCached, _leftJoinCol, *_right);
+  } else if (rightResIfCached && !leftResIfCached) {
+    passJoinColumnSummary(*rightResIfCached, _rightJoinCol, *_left);
+  }
+
   auto leftIndexScan =
       std::dynamic_pointer_cast<IndexScan>(_left->getRootOperation());
   if (leftIndexScan &&
@@ -157,6 +166,12 @@ Result Join::computeResult(bool requestLaziness) {
     return createEmptyResult();
   }
 
+  // The left child might have been fully materialized only now, in which case
+  // its join column can still restrict the right child before it is computed.
+  if (!leftResIfCached && !rightResIfCached && leftRes->isFullyMaterialized()) {
+    passJoinColumnSummary(*leftRes, _leftJoinCol, *_right);
+  }
+
   // Note: If only one of the children is a scan, then we have made sure in the
   // constructor that it is the right child.
   auto rightIndexScan =
@@ -180,6 +195,38 @@ Result Join::computeResult(bool requestLaziness) {
   return lazyJoin(std::move(leftRes), std::move(rightRes), requestLaziness);
 }
 
+// _____________________________________________________________________________
+bool Join::applyJoinColumnSummaryImpl(const Variable& variable,
+                                      const JoinColumnSummary& summary) {
+  bool applied = false;
+  for (auto* child : {_left.get(), _right.get()}) {
+    if (child->getVariableColumns().contains(variable)) {
+      applied |=
+          child->getRootOperation()->applyJoinColumnSummary(variable, summary);
+    }
+  }
+  return applied;
+}
+
+// _____________________________________________________________________________
+void Join::passJoinColumnSummary(const Result& result, ColumnIndex joinColumn,
+                                 QueryExecutionTree& other) {
+  auto maxNumRanges = getRuntimeParameter<
+      &RuntimeParameters::joinColumnSummaryMaxNumRanges_>();
+  if (maxNumRanges == 0 ||
+      std::dynamic_pointer_cast<IndexScan>(other.getRootOperation())) {
+    return;
+  }
+  auto summary = JoinColumnSummary::fromSortedColumn(
+      result.idTable().getColumn(joinColumn), maxNumRanges);
+  if (summary.has_value() &&
+      other.getRootOperation()->applyJoinColumnSummary(_joinVar,
+                                                       summary.value())) {
+    runtimeInfo().addDetail("num-ranges-of-join-column-summary",
+                            summary.value().ranges().size());
+  }
+}
+
 // _____________________________________________________________________________
 VariableToColumnMap Join::computeVariableToColumnMap() const {
   return makeVarToColMapForJoinOperation(
@@ -317,13 +364,19 @@ void Join::join(const IdTable& a, const IdTable& b, IdTable* result) const {
   auto aPermuted = a.asColumnSubsetView(joinColumnData.permutationLeft());
   auto bPermuted = b.asColumnSubsetView(joinColumnData.permutationRight());
 
-  auto rowAdder = ad_utility::AddCombinedRowToIdTable(
-      1, aPermuted, bPermuted, std::move(*result), cancellationHandle_,
-      keepJoinColumn_);
-  auto addRow = [beginLeft = joinColumnL.begin(),
-                 beginRight = joinColumnR.begin(),
-                 &rowAdder](const auto& itLeft, const auto& itRight) {
-    rowAdder.addRow(itLeft - beginLeft, itRight - beginRight);
+  auto makeRowAdderForTable = [&](IdTable table) {
+    return ad_utility::AddCombinedRowToIdTable(
+        1, aPermuted, bPermuted, std::move(table), cancellationHandle_,
+        keepJoinColumn_);
+  };
+  // Return the callback for the join algorithms that adds the rows for a pair
+  // of iterators into the join columns to the `rowAdder`.
+  auto makeAddRow = [beginLeft = joinColumnL.begin(),
+                     beginRight = joinColumnR.begin()](auto& rowAdder) {
+    return [beginLeft, beginRight, &rowAdder](const auto& itLeft,
+                                              const auto& itRight) {
+      rowAdder.addRow(itLeft - beginLeft, itRight - beginRight);
+    };
   };
 
   // The UNDEF values are right at the start, so this calculation works.
@@ -338,44 +391,78 @@ void Join::join(const IdTable& a, const IdTable& b, IdTable* result) const {
 
   auto cancellationCallback = [this]() { checkCancellation(); };
 
-  // Determine whether we should use the galloping join optimization.
-  if (a.size() / b.size() > GALLOP_THRESHOLD && numUndefA == 0 &&
-      numUndefB == 0) {
-    // The first argument to the galloping join will always be the smaller
-    // input, so we need to switch the rows when adding them.
-    auto inverseAddRow = [&addRow](const auto& rowA, const auto& rowB) {
-      addRow(rowB, rowA);
-    };
-    ad_utility::gallopingJoin(joinColumnR, joinColumnL, ql::ranges::less{},
-                              inverseAddRow, {}, cancellationCallback);
-  } else if (b.size() / a.size() > GALLOP_THRESHOLD && numUndefA == 0 &&
-             numUndefB == 0) {
-    ad_utility::gallopingJoin(joinColumnL, joinColumnR, ql::ranges::less{},
-                              addRow, {}, cancellationCallback);
-  } else {
+  // Without UNDEF values and local vocab entries, the `Id`s can be compared by
+  // their bits, which allows for the faster SIMD zipper join. Note that the
+  // join columns have to be checked directly, because a result with an empty
+  // local vocab can still contain `Id`s from the local vocab of the delta
+  // triples. The check is linear in the size of the inputs, so it is only done
+  // for the zipper join, but not for the galloping join, which is sublinear.
+  bool noUndef = numUndefA == 0 && numUndefB == 0;
+  auto isOrderedByBits = [](ql::span<const Id> column) {
+    return ql::ranges::none_of(column, [](Id id) {
+      return id.getDatatype() == Datatype::LocalVocabIndex;
+    });
+  };
+
+  // Join the (non-empty) parts `left` and `right` of the join columns, which
+  // must not contain UNDEF values, and call `addRow` for each matching pair.
+  auto joinWithoutUndef = [&](ql::span<const Id> left,
+                              ql::span<const Id> right, const auto& addRow) {
+    // Determine whether we should use the galloping join optimization.
+    if (left.size() / right.size() > GALLOP_THRESHOLD) {
+      // The first argument to the galloping join will always be the smaller
+      // input, so we need to switch the rows when adding them.
+      auto inverseAddRow = [&addRow](const auto& rowA, const auto& rowB) {
+        addRow(rowB, rowA);
+      };
+      ad_utility::gallopingJoin(right, left, ql::ranges::less{}, inverseAddRow,
+                                {}, cancellationCallback);
+    } else if (right.size() / left.size() > GALLOP_THRESHOLD) {
+      ad_utility::gallopingJoin(left, right, ql::ranges::less{}, addRow, {},
+                                cancellationCallback);
+    } else if (isOrderedByBits(left) && isOrderedByBits(right)) {
+      ad_utility::zipperJoinForIdsWithoutUndef(left, right, addRow,
+                                               cancellationCallback);
+    } else {
+      auto numOutOfOrder = ad_utility::zipperJoinWithUndef(
+          left, right, ql::ranges::less{}, addRow, ad_utility::noop,
+          ad_utility::noop, {}, cancellationCallback);
+      AD_CORRECTNESS_CHECK(numOutOfOrder == 0);
+    }
+  };
+
+  if (!noUndef) {
     auto findSmallerUndefRangeLeft = [undefRangeA](auto&&...) {
       return ad_utility::IteratorRange{undefRangeA.first, undefRangeA.second};
     };
     auto findSmallerUndefRangeRight = [undefRangeB](auto&&...) {
       return ad_utility::IteratorRange{undefRangeB.first, undefRangeB.second};
     };
-
-    auto numOutOfOrder = [&]() {
-      if (numUndefB == 0 && numUndefA == 0) {
-        return ad_utility::zipperJoinWithUndef(
-            joinColumnL, joinColumnR, ql::ranges::less{}, addRow,
-            ad_utility::noop, ad_utility::noop, {}, cancellationCallback);
-
-      } else {
-        return ad_utility::zipperJoinWithUndef(
-            joinColumnL, joinColumnR, ql::ranges::less{}, addRow,
-            findSmallerUndefRangeLeft, findSmallerUndefRangeRight, {},
-            cancellationCallback);
-      }
-    }();
+    auto rowAdder = makeRowAdderForTable(std::move(*result));
+    auto numOutOfOrder = ad_utility::zipperJoinWithUndef(
+        joinColumnL, joinColumnR, ql::ranges::less{}, makeAddRow(rowAdder),
+        findSmallerUndefRangeLeft, findSmallerUndefRangeRight, {},
+        cancellationCallback);
     AD_CORRECTNESS_CHECK(numOutOfOrder == 0);
+    *result = std::move(rowAdder).resultTable();
+  } else {
+    // Large inputs are split into partitions that are joined in parallel.
+    auto partitions = ad_utility::partitionForParallelJoin(
+        joinColumnL, joinColumnR, ql::ranges::less{},
+        getNumPartitionsForParallelJoin(a.size() + b.size()));
+    *result = joinPartitionsInParallel(
+        partitions, *result,
+        [&](const ad_utility::JoinPartition& partition, IdTable table) {
+          auto rowAdder = makeRowAdderForTable(std::move(table));
+          joinWithoutUndef(
+              joinColumnL.subspan(partition.beginLeft_,
+                                  partition.endLeft_ - partition.beginLeft_),
+              joinColumnR.subspan(partition.beginRight_,
+                                  partition.endRight_ - partition.beginRight_),
+              makeAddRow(rowAdder));
+          return std::move(rowAdder).resultTable();
+        });
   }
-  *result = std::move(rowAdder).resultTable();
   // The column order in the result is now
   // [joinColumns, non-join-columns-a, non-join-columns-b] (which makes the
   // algorithms above easier), be the order that is expected by the rest of
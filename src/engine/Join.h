@@ -89,6 +89,9 @@ class Join : public Operation {
    * join, with the merge join code directly written in the function.
    * TODO Move the merge join into it's own function and make this function
    * a proper switch.
+   * If the join columns contain neither UNDEF values nor `Id`s from a local
+   * vocab, the `Id`s are compared by their bits, which allows to use SIMD
+   * instructions (see `SimdJoin.h`).
    **/
   void join(const IdTable& a, const IdTable& b, IdTable* result) const;
 
@@ -125,6 +128,17 @@ class Join : public Operation {
 
   VariableToColumnMap computeVariableToColumnMap() const override;
 
+  // Pass the `summary` to both children that contain the `variable`.
+  bool applyJoinColumnSummaryImpl(const Variable& variable,
+                                  const JoinColumnSummary& summary) override;
+
+  // Sideways information passing: Pass a `JoinColumnSummary` of the join
+  // column of the fully materialized `result` of one child to the `other`
+  // child, before the latter is computed. Children that are `IndexScan`s are
+  // skipped, because they are handled by the more precise special cases below.
+  void passJoinColumnSummary(const Result& result, ColumnIndex joinColumn,
+                             QueryExecutionTree& other);
+
   std::optional<std::shared_ptr<QueryExecutionTree>>
   makeTreeWithStrippedColumns(
       const std::set<Variable>& variables) const override;
@@ -0,0 +1,41 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#include "engine/JoinColumnSummary.h"
+
+#include "backports/algorithm.h"
+#include "util/Exception.h"
+
+// _____________________________________________________________________________
+std::optional<JoinColumnSummary> JoinColumnSummary::fromSortedColumn(
+    ql::span<const Id> joinColumn, size_t maxNumRanges) {
+  AD_EXPENSIVE_CHECK(ql::ranges::is_sorted(joinColumn));
+  // UNDEF values are sorted to the front.
+  if (maxNumRanges == 0 ||
+      (!joinColumn.empty() && joinColumn.front().isUndefined())) {
+    return std::nullopt;
+  }
+  std::vector<Id> distinctIds;
+  ql::ranges::unique_copy(joinColumn, std::back_inserter(distinctIds));
+
+  // Split the distinct `Id`s into `numRanges` ranges with (almost) the same
+  // number of `Id`s.
+  size_t numRanges = std::min(distinctIds.size(), maxNumRanges);
+  std::vector<std::pair<Id, Id>> ranges;
+  ranges.reserve(numRanges);
+  for (size_t i = 0; i < numRanges; ++i) {
+    size_t begin = i * distinctIds.size() / numRanges;
+    size_t end = (i + 1) * distinctIds.size() / numRanges;
+    ranges.emplace_back(distinctIds[begin], distinctIds[end - 1]);
+  }
+  return JoinColumnSummary{std::move(ranges)};
+}
+
+// _____________________________________________________________________________
+bool JoinColumnSummary::mayContainValueBetween(Id lower, Id upper) const {
+  // Find the first range that doesn't end before `lower`, it is the only
+  // candidate for an overlap.
+  auto it = ql::ranges::lower_bound(ranges_, lower, std::less{},
+                                    &std::pair<Id, Id>::second);
+  return it != ranges_.end() && !(upper < it->first);
+}
@@ -0,0 +1,46 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#ifndef QLEVER_SRC_ENGINE_JOINCOLUMNSUMMARY_H
+#define QLEVER_SRC_ENGINE_JOINCOLUMNSUMMARY_H
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "backports/span.h"
+#include "global/Id.h"
+
+// A compact summary of the values in the join column of one input of a join,
+// which is passed to the other input before that one is computed ("sideways
+// information passing"). The other input can then skip the computation of rows
+// whose value in the join column is not contained in the summary, because they
+// can't be part of the result of the join (see
+// `Operation::applyJoinColumnSummary`).
+//
+// The summary consists of a sorted sequence of disjoint, closed ranges of
+// `Id`s. If the join column has few distinct values, then each of them is its
+// own range and the summary is exact, otherwise adjacent values are combined
+// into ranges.
+class JoinColumnSummary {
+ private:
+  std::vector<std::pair<Id, Id>> ranges_;
+
+  explicit JoinColumnSummary(std::vector<std::pair<Id, Id>> ranges)
+      : ranges_{std::move(ranges)} {}
+
+ public:
+  // Create the summary for the given `joinColumn`, which must be sorted, with
+  // at most `maxNumRanges` ranges. Return `std::nullopt` if the `joinColumn`
+  // contains UNDEF values (which match every value) or if `maxNumRanges` is 0.
+  static std::optional<JoinColumnSummary> fromSortedColumn(
+      ql::span<const Id> joinColumn, size_t maxNumRanges);
+
+  // Return false if none of the `Id`s in the closed range `[lower, upper]` is
+  // contained in the summary.
+  bool mayContainValueBetween(Id lower, Id upper) const;
+
+  const std::vector<std::pair<Id, Id>>& ranges() const { return ranges_; }
+};
+
+#endif  // QLEVER_SRC_ENGINE_JOINCOLUMNSUMMARY_H
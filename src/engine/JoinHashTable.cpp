@@ -0,0 +1,128 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#include "engine/JoinHashTable.h"
+
+#include <absl/hash/hash.h>
+
+#include <future>
+
+#include "backports/algorithm.h"
+#include "util/Exception.h"
+#include "util/ParallelExecutor.h"
+
+namespace {
+// The number of rows after which the building of the table checks for
+// cancellation.
+constexpr size_t checkCancellationInterval = 1 << 16;
+}  // namespace
+
+// _____________________________________________________________________________
+JoinHashTable::JoinHashTable(IdTableView<0> keys, size_t numThreads,
+                             const Allocator& allocator,
+                             const CancellationHandle& cancellationHandle)
+    : keys_{std::move(keys)}, nextRow_(keys_.numRows(), noRow, allocator) {
+  AD_CONTRACT_CHECK(keys_.numColumns() > 0);
+  while ((size_t{1} << numPartitionBits_) < numThreads) {
+    ++numPartitionBits_;
+  }
+  size_t numPartitions = size_t{1} << numPartitionBits_;
+  for (size_t i = 0; i < numPartitions; ++i) {
+    partitions_.push_back(Partition{Vector<Slot>(allocator)});
+  }
+
+  // Call `function(i)` for each partition index `i`, in parallel if there is
+  // more than one partition.
+  auto forEachPartitionIndex = [numPartitions](const auto& function) {
+    if (numPartitions == 1) {
+      function(0);
+      return;
+    }
+    std::vector<std::packaged_task<void()>> tasks;
+    for (size_t i = 0; i < numPartitions; ++i) {
+      tasks.emplace_back([&function, i]() { function(i); });
+    }
+    ad_utility::runTasksInParallel(std::move(tasks));
+  };
+
+  // First compute the hashes of all rows (each thread handles a contiguous
+  // range of rows), then insert the rows into the partitions (each thread
+  // handles one partition).
+  size_t numRows = keys_.numRows();
+  Vector<uint64_t> hashes(numRows, allocator);
+  forEachPartitionIndex([&](size_t i) {
+    size_t end = (i + 1) * numRows / numPartitions;
+    for (size_t row = i * numRows / numPartitions; row < end; ++row) {
+      if (row % checkCancellationInterval == 0) {
+        cancellationHandle->throwIfCancelled();
+      }
+      hashes[row] = hashRow(keys_, row);
+    }
+  });
+  forEachPartitionIndex([&](size_t i) {
+    buildPartition(i, hashes, cancellationHandle);
+  });
+}
+
+// _____________________________________________________________________________
+uint64_t JoinHashTable::hashRow(const IdTableView<0>& keys, size_t row) {
+  size_t hash = 0;
+  for (size_t col = 0; col < keys.numColumns(); ++col) {
+    hash = absl::HashOf(hash, keys(row, col));
+  }
+  return hash;
+}
+
+// _____________________________________________________________________________
+bool JoinHashTable::keysAreEqual(const IdTableView<0>& probeKeys,
+                                 size_t probeRow, uint64_t buildRow) const {
+  for (size_t col = 0; col < keys_.numColumns(); ++col) {
+    if (probeKeys(probeRow, col) != keys_(buildRow, col)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// _____________________________________________________________________________
+void JoinHashTable::buildPartition(
+    size_t index, const Vector<uint64_t>& hashes,
+    const CancellationHandle& cancellationHandle) {
+  auto isInPartition = [this, index](uint64_t hash) {
+    return partitionIndex(hash) == index;
+  };
+  // The number of distinct keys in the partition is at most the number of its
+  // rows, so the load factor of the table is at most 0.5.
+  size_t numRowsInPartition = ql::ranges::count_if(hashes, isInPartition);
+  size_t numSlots = 2;
+  while (numSlots < 2 * numRowsInPartition) {
+    numSlots *= 2;
+  }
+  Partition& partition = partitions_[index];
+  partition.slots_.resize(numSlots);
+  partition.mask_ = numSlots - 1;
+
+  // Insert the rows in reverse order, s.t. the chains of rows with the same key
+  // are in increasing order.
+  for (size_t row = hashes.size(); row-- > 0;) {
+    if (row % checkCancellationInterval == 0) {
+      cancellationHandle->throwIfCancelled();
+    }
+    uint64_t hash = hashes[row];
+    if (!isInPartition(hash)) {
+      continue;
+    }
+    for (uint64_t i = hash & partition.mask_;; i = (i + 1) & partition.mask_) {
+      Slot& slot = partition.slots_[i];
+      if (slot.firstRow_ == noRow) {
+        slot = Slot{hash, row};
+        break;
+      }
+      if (slot.hash_ == hash && keysAreEqual(keys_, row, slot.firstRow_)) {
+        nextRow_[row] = slot.firstRow_;
+        slot.firstRow_ = row;
+        break;
+      }
+    }
+  }
+}
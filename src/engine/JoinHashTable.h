@@ -0,0 +1,122 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#ifndef QLEVER_SRC_ENGINE_JOINHASHTABLE_H
+#define QLEVER_SRC_ENGINE_JOINHASHTABLE_H
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "engine/idTable/IdTable.h"
+#include "global/Id.h"
+#include "util/AllocatorWithLimit.h"
+#include "util/CancellationHandle.h"
+
+// A flat hash table for the build side of a `HashJoin`. It maps the values of
+// the join columns of the rows of the build side to the indices of these rows.
+// The table uses open addressing with linear probing. A slot only stores the
+// hash and the index of the first row with the respective key, the other rows
+// with the same key are chained via a separate array. This keeps the slots
+// small and the probing cache-friendly. The table is split into partitions by
+// the most significant bits of the hashes, which are built in parallel. All
+// the memory is allocated with the given `AllocatorWithLimit`, so building the
+// table throws if the memory limit is exceeded.
+//
+// NOTE: The join columns must not contain UNDEF values, as an UNDEF value would
+// have to match every other value.
+class JoinHashTable {
+ public:
+  using Allocator = ad_utility::AllocatorWithLimit<Id>;
+  using CancellationHandle = ad_utility::SharedCancellationHandle;
+
+ private:
+  template <typename T>
+  using Vector = std::vector<T, ad_utility::AllocatorWithLimit<T>>;
+
+  // Marks an empty slot and the end of a chain of rows.
+  static constexpr uint64_t noRow = std::numeric_limits<uint64_t>::max();
+
+  struct Slot {
+    uint64_t hash_ = 0;
+    uint64_t firstRow_ = noRow;
+  };
+
+  struct Partition {
+    Vector<Slot> slots_;
+    // The number of slots is a power of two, so the position of a hash is
+    // `hash & mask_`.
+    uint64_t mask_ = 0;
+  };
+
+  // The join columns of the build side.
+  IdTableView<0> keys_;
+  // `nextRow_[i]` is the index of the next row after row `i` with the same key
+  // or `noRow` if there is no such row.
+  Vector<uint64_t> nextRow_;
+  std::vector<Partition> partitions_;
+  size_t numPartitionBits_ = 0;
+
+ public:
+  // Build the hash table for all the rows of `keys`, which has to consist of
+  // exactly the join columns of the build side. Only a view of `keys` is
+  // stored, so the underlying table has to outlive the hash table. The table is
+  // built by (about) `numThreads` threads.
+  JoinHashTable(IdTableView<0> keys, size_t numThreads,
+                const Allocator& allocator,
+                const CancellationHandle& cancellationHandle);
+
+  // Call `action(buildRow)` for the index of each row of the build side, the
+  // key of which is equal to the `probeRow`-th row of `probeKeys`. The
+  // `probeKeys` have to consist of the join columns of the probe side in the
+  // same order as the `keys` of the build side. The indices are passed in
+  // increasing order.
+  template <typename F>
+  void forEachMatch(const IdTableView<0>& probeKeys, size_t probeRow,
+                    const F& action) const {
+    uint64_t hash = hashRow(probeKeys, probeRow);
+    const Partition& partition = partitions_[partitionIndex(hash)];
+    for (uint64_t i = hash & partition.mask_;; i = (i + 1) & partition.mask_) {
+      const Slot& slot = partition.slots_[i];
+      if (slot.firstRow_ == noRow) {
+        return;
+      }
+      if (slot.hash_ == hash &&
+          keysAreEqual(probeKeys, probeRow, slot.firstRow_)) {
+        for (uint64_t row = slot.firstRow_; row != noRow; row = nextRow_[row]) {
+          action(static_cast<size_t>(row));
+        }
+        return;
+      }
+    }
+  }
+
+  // The number of rows of the build side.
+  size_t numRows() const { return keys_.numRows(); }
+
+  // The number of partitions, which is a power of two.
+  size_t numPartitions() const { return partitions_.size(); }
+
+  // Return the hash of the `row`-th row of the `keys`. Rows with equal values
+  // have equal hashes, this also holds for `Id`s from different local
+  // vocabularies that refer to the same word.
+  static uint64_t hashRow(const IdTableView<0>& keys, size_t row);
+
+ private:
+  // Return the partition of a row with the given `hash`.
+  size_t partitionIndex(uint64_t hash) const {
+    return numPartitionBits_ == 0 ? 0 : hash >> (64 - numPartitionBits_);
+  }
+
+  // Return true iff the `probeRow`-th row of `probeKeys` and the `buildRow`-th
+  // row of the build side have the same key.
+  bool keysAreEqual(const IdTableView<0>& probeKeys, size_t probeRow,
+                    uint64_t buildRow) const;
+
+  // Insert all the rows that belong to the partition with the given `index`.
+  // The `hashes` are the hashes of all the rows of the build side.
+  void buildPartition(size_t index, const Vector<uint64_t>& hashes,
+                      const CancellationHandle& cancellationHandle);
+};
+
+#endif  // QLEVER_SRC_ENGINE_JOINHASHTABLE_H
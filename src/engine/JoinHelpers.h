@@ -10,6 +10,8 @@
 #include <absl/functional/function_ref.h>
 
 #include <array>
+#include <future>
+#include <limits>
 #include <optional>
 #include <vector>
 
@@ -20,13 +22,16 @@
 #include "engine/Result.h"
 #include "engine/Sort.h"
 #include "engine/idTable/IdTable.h"
+#include "global/RuntimeParameters.h"
 #include "index/CompressedRelation.h"
 #include "index/Permutation.h"
 #include "util/Exception.h"
 #include "util/Generators.h"
 #include "util/InputRangeUtils.h"
 #include "util/Iterators.h"
+#include "util/JoinAlgorithms/JoinAlgorithms.h"
 #include "util/JoinAlgorithms/JoinColumnMapping.h"
+#include "util/ParallelExecutor.h"
 #include "util/TypeTraits.h"
 
 namespace qlever::joinHelpers {
@@ -286,6 +291,135 @@ tryGetResultsForLeftIndexNestedLoopJoin(
   auto rightRes = computeResultSkipChild(sort, true);
   return std::optional{std::pair{std::move(leftRes), std::move(rightRes)}};
 }
+
+// The estimated size and the estimated multiplicities of the result columns
+// of a join, see `computeSizeEstimateAndMultiplicities` below.
+struct SizeEstimateAndMultiplicities {
+  uint64_t sizeEstimate_;
+  std::vector<float> multiplicities_;
+};
+
+// Estimate the size and the multiplicities of the result of joining `left` and
+// `right` on the `joinColumns`, where the result consists of the columns of
+// `left` followed by the non-join columns of `right`. This is used by the
+// operations that join on multiple columns.
+inline SizeEstimateAndMultiplicities computeSizeEstimateAndMultiplicities(
+    QueryExecutionTree& left, QueryExecutionTree& right,
+    const std::vector<std::array<ColumnIndex, 2>>& joinColumns) {
+  // The number of distinct entries in the result is at most the minimum of
+  // the numbers of distinct entries in all join columns.
+  // The multiplicity in the result is approximated by the product of the
+  // maximum of the multiplicities of each side.
+
+  // compute the minimum number of distinct elements in the join columns
+  size_t numDistinctLeft = std::numeric_limits<size_t>::max();
+  size_t numDistinctRight = std::numeric_limits<size_t>::max();
+  for (const auto& [leftCol, rightCol] : joinColumns) {
+    size_t dl = std::max(
+        1.0f, left.getSizeEstimate() / left.getMultiplicity(leftCol));
+    size_t dr = std::max(
+        1.0f, right.getSizeEstimate() / right.getMultiplicity(rightCol));
+    numDistinctLeft = std::min(numDistinctLeft, dl);
+    numDistinctRight = std::min(numDistinctRight, dr);
+  }
+  size_t numDistinctResult = std::min(numDistinctLeft, numDistinctRight);
+
+  // compute an estimate for the results multiplicity
+  float multLeft = std::numeric_limits<float>::max();
+  float multRight = std::numeric_limits<float>::max();
+  for (const auto& [leftCol, rightCol] : joinColumns) {
+    multLeft = std::min(multLeft, left.getMultiplicity(leftCol));
+    multRight = std::min(multRight, right.getMultiplicity(rightCol));
+  }
+  float multResult = multLeft * multRight;
+
+  SizeEstimateAndMultiplicities result;
+  result.sizeEstimate_ = multResult * numDistinctResult;
+  // Don't estimate 0 since then some parent operations
+  // (in particular joins) using isKnownEmpty() will
+  // will assume the size to be exactly zero
+  result.sizeEstimate_ += 1;
+
+  // compute estimates for the multiplicities of the result columns
+  auto& multiplicities = result.multiplicities_;
+  for (size_t i = 0; i < left.getResultWidth(); i++) {
+    multiplicities.push_back(left.getMultiplicity(i) *
+                             (multResult / multLeft));
+  }
+  for (size_t i = 0; i < right.getResultWidth(); i++) {
+    bool isJoinColumn = ql::ranges::any_of(
+        joinColumns, [i](const auto& jcs) { return jcs[1] == i; });
+    if (isJoinColumn) {
+      continue;
+    }
+    multiplicities.push_back(right.getMultiplicity(i) *
+                             (multResult / multRight));
+  }
+  return result;
+}
+
+// Return the number of partitions into which the fully materialized inputs of
+// a join with `numRows` rows in total should be split to join them in parallel
+// (see `joinPartitionsInParallel` below). A result of 1 means that the join
+// should be computed by a single thread.
+inline size_t getNumPartitionsForParallelJoin(size_t numRows) {
+  auto numThreads =
+      getRuntimeParameter<&RuntimeParameters::joinMaxNumThreads_>();
+  auto minNumRows =
+      getRuntimeParameter<&RuntimeParameters::joinParallelMinNumRows_>();
+  return numRows >= minNumRows ? std::max(numThreads, size_t{1}) : 1;
+}
+
+// Join the `partitions` of the inputs of a join (see
+// `ad_utility::partitionForParallelJoin`) in parallel, using one thread per
+// partition. `joinPartition(partition, table)` has to add the result of joining
+// the `partition` to the empty `table` (which has the columns and the allocator
+// of the `emptyResult`) and return it. The results of the partitions are
+// concatenated in the order of the partitions, so the result is sorted if the
+// result of each partition is. A single partition is joined directly by the
+// calling thread.
+template <typename JoinPartitionFunction>
+IdTable joinPartitionsInParallel(
+    const std::vector<ad_utility::JoinPartition>& partitions,
+    const IdTable& emptyResult, const JoinPartitionFunction& joinPartition) {
+  AD_CONTRACT_CHECK(emptyResult.empty());
+  if (partitions.size() <= 1) {
+    return partitions.empty()
+               ? emptyResult.clone()
+               : joinPartition(partitions.front(), emptyResult.clone());
+  }
+  std::vector<IdTable> results;
+  results.reserve(partitions.size());
+  std::vector<std::packaged_task<void()>> tasks;
+  for (const auto& partition : partitions) {
+    auto& table = results.emplace_back(emptyResult.clone());
+    tasks.emplace_back([&table, &partition, &joinPartition]() {
+      table = joinPartition(partition, std::move(table));
+    });
+  }
+  ad_utility::runTasksInParallel(std::move(tasks));
+
+  // Concatenate the partial results one column at a time and free each column
+  // of the partial results right after it has been copied. This way, the peak
+  // memory is only one column more than the size of the result.
+  size_t numRows = 0;
+  for (const auto& table : results) {
+    numRows += table.numRows();
+  }
+  IdTable result = emptyResult.clone();
+  size_t numColumns = result.numColumns();
+  result.setNumColumns(0);
+  result.resize(numRows);
+  for (size_t i = 0; i < numColumns; ++i) {
+    result.addEmptyColumn();
+    auto target = result.getColumn(i).begin();
+    for (auto& table : results) {
+      target = ql::ranges::copy(table.getColumn(0), target).out;
+      table.deleteColumn(0);
+    }
+  }
+  return result;
+}
 }  // namespace qlever::joinHelpers
 
 #endif  // JOINHELPERS_H
@@ -145,62 +145,11 @@ size_t MultiColumnJoin::getCostEstimate() {
 
 // _____________________________________________________________________________
 void MultiColumnJoin::computeSizeEstimateAndMultiplicities() {
-  // The number of distinct entries in the result is at most the minimum of
-  // the numbers of distinct entries in all join columns.
-  // The multiplicity in the result is approximated by the product of the
-  // maximum of the multiplicities of each side.
-
-  // compute the minimum number of distinct elements in the join columns
-  size_t numDistinctLeft = std::numeric_limits<size_t>::max();
-  size_t numDistinctRight = std::numeric_limits<size_t>::max();
-  for (size_t i = 0; i < _joinColumns.size(); i++) {
-    size_t dl = std::max(1.0f, _left->getSizeEstimate() /
-                                   _left->getMultiplicity(_joinColumns[i][0]));
-    size_t dr = std::max(1.0f, _right->getSizeEstimate() /
-                                   _right->getMultiplicity(_joinColumns[i][1]));
-    numDistinctLeft = std::min(numDistinctLeft, dl);
-    numDistinctRight = std::min(numDistinctRight, dr);
-  }
-  size_t numDistinctResult = std::min(numDistinctLeft, numDistinctRight);
-
-  // compute an estimate for the results multiplicity
-  float multLeft = std::numeric_limits<float>::max();
-  float multRight = std::numeric_limits<float>::max();
-  for (size_t i = 0; i < _joinColumns.size(); i++) {
-    multLeft = std::min(multLeft, _left->getMultiplicity(_joinColumns[i][0]));
-    multRight =
-        std::min(multRight, _right->getMultiplicity(_joinColumns[i][1]));
-  }
-  float multResult = multLeft * multRight;
-
-  _sizeEstimate = multResult * numDistinctResult;
-  // Don't estimate 0 since then some parent operations
-  // (in particular joins) using isKnownEmpty() will
-  // will assume the size to be exactly zero
-  _sizeEstimate += 1;
-
-  // compute estimates for the multiplicities of the result columns
-  _multiplicities.clear();
-
-  for (size_t i = 0; i < _left->getResultWidth(); i++) {
-    float mult = _left->getMultiplicity(i) * (multResult / multLeft);
-    _multiplicities.push_back(mult);
-  }
-
-  for (size_t i = 0; i < _right->getResultWidth(); i++) {
-    bool isJcl = false;
-    for (size_t j = 0; j < _joinColumns.size(); j++) {
-      if (_joinColumns[j][1] == i) {
-        isJcl = true;
-        break;
-      }
-    }
-    if (isJcl) {
-      continue;
-    }
-    float mult = _right->getMultiplicity(i) * (multResult / multRight);
-    _multiplicities.push_back(mult);
-  }
+  auto [sizeEstimate, multiplicities] =
+      qlever::joinHelpers::computeSizeEstimateAndMultiplicities(
+          *_left, *_right, _joinColumns);
+  _sizeEstimate = sizeEstimate;
+  _multiplicities = std::move(multiplicities);
   _multiplicitiesComputed = true;
 }
 
@@ -226,13 +175,20 @@ void MultiColumnJoin::computeMultiColumnJoin(
   auto rightPermuted =
       right.asColumnSubsetView(joinColumnData.permutationRight());
 
-  auto rowAdder = ad_utility::AddCombinedRowToIdTable(
-      joinColumns.size(), leftPermuted, rightPermuted, std::move(*result),
-      cancellationHandle_);
-  auto addRow = [&rowAdder, beginLeft = leftJoinColumns.begin(),
-                 beginRight = rightJoinColumns.begin()](const auto& itLeft,
-                                                        const auto& itRight) {
-    rowAdder.addRow(itLeft - beginLeft, itRight - beginRight);
+  auto makeRowAdderForTable = [&](IdTable table) {
+    return ad_utility::AddCombinedRowToIdTable(joinColumns.size(),
+                                               leftPermuted, rightPermuted,
+                                               std::move(table),
+                                               cancellationHandle_);
+  };
+  // Return the callback for the join algorithms that adds the rows for a pair
+  // of iterators into the join columns to the `rowAdder`.
+  auto makeAddRow = [beginLeft = leftJoinColumns.begin(),
+                     beginRight = rightJoinColumns.begin()](auto& rowAdder) {
+    return [beginLeft, beginRight, &rowAdder](const auto& itLeft,
+                                              const auto& itRight) {
+      rowAdder.addRow(itLeft - beginLeft, itRight - beginRight);
+    };
   };
 
   // Compute `isCheap`, which is true iff there are no UNDEF values in the join
@@ -249,22 +205,40 @@ void MultiColumnJoin::computeMultiColumnJoin(
 
   auto checkCancellationLambda = [this] { checkCancellation(); };
 
-  const size_t numOutOfOrder = [&]() {
-    if (isCheap) {
-      return ad_utility::zipperJoinWithUndef(
-          leftJoinColumns, rightJoinColumns,
-          ql::ranges::lexicographical_compare, addRow, ad_utility::noop,
-          ad_utility::noop, ad_utility::noop, checkCancellationLambda);
-    } else {
-      return ad_utility::zipperJoinWithUndef(
-          leftJoinColumns, rightJoinColumns,
-          ql::ranges::lexicographical_compare, addRow,
-          ad_utility::findSmallerUndefRanges,
-          ad_utility::findSmallerUndefRanges, ad_utility::noop,
-          checkCancellationLambda);
-    }
-  }();
-  *result = std::move(rowAdder).resultTable();
+  size_t numOutOfOrder = 0;
+  if (isCheap) {
+    // Large inputs are split into partitions that are joined in parallel.
+    auto partitions = ad_utility::partitionForParallelJoin(
+        leftJoinColumns, rightJoinColumns, ql::ranges::lexicographical_compare,
+        qlever::joinHelpers::getNumPartitionsForParallelJoin(left.size() +
+                                                             right.size()));
+    *result = qlever::joinHelpers::joinPartitionsInParallel(
+        partitions, *result,
+        [&](const ad_utility::JoinPartition& partition, IdTable table) {
+          auto rowAdder = makeRowAdderForTable(std::move(table));
+          ql::ranges::subrange leftPartition{
+              leftJoinColumns.begin() + partition.beginLeft_,
+              leftJoinColumns.begin() + partition.endLeft_};
+          ql::ranges::subrange rightPartition{
+              rightJoinColumns.begin() + partition.beginRight_,
+              rightJoinColumns.begin() + partition.endRight_};
+          auto numOutOfOrderInPartition = ad_utility::zipperJoinWithUndef(
+              leftPartition, rightPartition,
+              ql::ranges::lexicographical_compare, makeAddRow(rowAdder),
+              ad_utility::noop, ad_utility::noop, ad_utility::noop,
+              checkCancellationLambda);
+          AD_CORRECTNESS_CHECK(numOutOfOrderInPartition == 0);
+          return std::move(rowAdder).resultTable();
+        });
+  } else {
+    auto rowAdder = makeRowAdderForTable(std::move(*result));
+    numOutOfOrder = ad_utility::zipperJoinWithUndef(
+        leftJoinColumns, rightJoinColumns, ql::ranges::lexicographical_compare,
+        makeAddRow(rowAdder), ad_utility::findSmallerUndefRanges,
+        ad_utility::findSmallerUndefRanges, ad_utility::noop,
+        checkCancellationLambda);
+    *result = std::move(rowAdder).resultTable();
+  }
   // If there were UNDEF values in the input, the result might be out of
   // order. Sort it, because this operation promises a sorted result in its
   // `resultSortedOn()` member function.
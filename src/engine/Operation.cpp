@@ -592,6 +592,22 @@ void Operation::applyLimitOffset(const LimitOffsetClause& limitOffsetClause) {
   onLimitOffsetChanged(limitOffsetClause);
 }
 
+// _____________________________________________________________________________
+bool Operation::applyJoinColumnSummary(const Variable& variable,
+                                       const JoinColumnSummary& summary) {
+  // With a LIMIT or OFFSET, removing rows from the input would change which
+  // rows are part of the result.
+  if (!getLimitOffset().isUnconstrained() ||
+      !getExternallyVisibleVariableColumns().contains(variable)) {
+    return false;
+  }
+  if (!applyJoinColumnSummaryImpl(variable, summary)) {
+    return false;
+  }
+  disableStoringInCache();
+  return true;
+}
+
 // __________________________________________________________________
 void Operation::createRuntimeInfoFromEstimates(
     std::shared_ptr<const RuntimeInformation> root) {
@@ -26,6 +26,7 @@
 // forward declaration needed to break dependencies
 class QueryExecutionTree;
 class ExternalValues;
+class JoinColumnSummary;
 namespace parsedQuery {
 struct Bind;
 }
@@ -162,6 +163,27 @@ class Operation {
     return std::nullopt;
   };
 
+  // Sideways information passing: Inform this operation that only the rows
+  // whose value for the `variable` is contained in the `summary` are relevant,
+  // because a parent operation joins this result with another input on the
+  // `variable` (see `JoinColumnSummary`). This has to be called before the
+  // result is computed. Return true iff the summary was used, in which case
+  // the result might be incomplete and is thus no longer stored in the cache.
+  // Operations with a LIMIT or OFFSET ignore the summary.
+  bool applyJoinColumnSummary(const Variable& variable,
+                              const JoinColumnSummary& summary);
+
+ private:
+  // The part of `applyJoinColumnSummary` that is specific to the operation. It
+  // is only called if the `variable` is part of the result. The default
+  // implementation ignores the `summary`.
+  virtual bool applyJoinColumnSummaryImpl(
+      [[maybe_unused]] const Variable& variable,
+      [[maybe_unused]] const JoinColumnSummary& summary) {
+    return false;
+  }
+
+ public:
   // Get a unique, not ambiguous string representation for a subtree.
   // This should act like an ID for each subtree.
   // Calls  `getCacheKeyImpl` and adds the information about the `LIMIT` clause.
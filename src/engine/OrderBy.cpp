@@ -10,10 +10,58 @@
 #include "engine/CallFixedSize.h"
 #include "engine/QueryExecutionTree.h"
 #include "global/RuntimeParameters.h"
-#include "global/ValueIdComparators.h"
 #include "index/IdTableUtils.h"
 #include "util/TransparentFunctors.h"
 
+namespace {
+// Return a 64-bit key for the `id`, s.t. for two `Id`s from a column for which
+// `columnHasSemanticSortKeys` (see below) holds, the order of the keys is the
+// order of `compareIds` with `CompareByType`. The datatype bits are the most
+// significant bits of both the `Id` and the key, so `Id`s with different
+// (incompatible) datatypes are ordered by their datatype.
+uint64_t semanticSortKey(Id id) {
+  constexpr uint64_t signBit = uint64_t{1} << (ValueId::numDataBits - 1);
+  constexpr uint64_t dataBits = (signBit << 1) - 1;
+  uint64_t bits = id.getBits();
+  switch (id.getDatatype()) {
+    case Datatype::Int:
+      // Integers are stored in two's complement.
+      return bits ^ signBit;
+    case Datatype::Double:
+      // Doubles are stored as sign and magnitude.
+      return (bits & signBit) ? bits ^ dataBits : bits | signBit;
+    default:
+      return bits;
+  }
+}
+
+// Return true iff the `semanticSortKey`s of the `Id`s in the `column` can be
+// used to sort it. This is the case if all the `Id`s are of one of the
+// datatypes below, and the column doesn't contain both integers and doubles
+// (which are compared by their numeric value).
+bool columnHasSemanticSortKeys(ql::span<const Id> column) {
+  bool hasInt = false;
+  bool hasDouble = false;
+  for (Id id : column) {
+    switch (id.getDatatype()) {
+      case Datatype::Undefined:
+      case Datatype::Bool:
+      case Datatype::VocabIndex:
+        break;
+      case Datatype::Int:
+        hasInt = true;
+        break;
+      case Datatype::Double:
+        hasDouble = true;
+        break;
+      default:
+        return false;
+    }
+  }
+  return !(hasInt && hasDouble);
+}
+}  // namespace
+
 // _____________________________________________________________________________
 size_t OrderBy::getResultWidth() const { return subtree_->getResultWidth(); }
 
@@ -95,34 +143,32 @@ Result OrderBy::computeResult([[maybe_unused]] bool requestLaziness) {
   // TODO<joka921> Undefined values should always be at the end, no matter
   // if the ordering is ascending or descending.
 
-  // TODO<joka921> If we know, that all the sort columns contain only datatypes
-  // for which the `internal` order is also the `semantic` order, or if a column
-  // only contains a single datatype, then we can use more efficient
-  // implementations here.
-
-  // Return true iff `rowA` comes before `rowB` in the sort order specified by
-  // `sortIndices_`.
-  auto comparison = [this](const auto& row1, const auto& row2) -> bool {
-    for (auto& [column, isDescending] : sortIndices_) {
-      if (row1[column] == row2[column]) {
-        continue;
-      }
-      bool isLessThan =
-          toBoolNotUndef(valueIdComparators::compareIds<
-                         valueIdComparators::ComparisonForIncompatibleTypes::
-                             CompareByType>(
-              row1[column], row2[column], valueIdComparators::Comparison::LT));
-      return isLessThan != isDescending;
-    }
-    return false;
-  };
-
-  // We cannot use the `CALL_FIXED_SIZE` macro here because the `sort` function
-  // is templated not only on the integer `I` (which the `callFixedSize`
-  // function deals with) but also on the `comparison`.
-  ad_utility::callFixedSizeVi(width, [&idTable, &comparison](auto I) {
-    IdTableUtils::sort<I>(&idTable, comparison);
-  });
+  // If the order of all the sort columns can be expressed via
+  // `semanticSortKey`s, use the (much faster) radix sort.
+  bool useRadixSort =
+      idTable.numRows() >= IdTableUtils::minNumRowsForRadixSort &&
+      ql::ranges::all_of(sortIndices_, [&idTable](const auto& sortIndex) {
+        return columnHasSemanticSortKeys(idTable.getColumn(sortIndex.first));
+      });
+  if (useRadixSort) {
+    auto sortColumns = ::ranges::to<std::vector<ColumnIndex>>(
+        sortIndices_ | ql::views::transform(ad_utility::first));
+    IdTableUtils::radixSort(idTable, sortColumns, [this](Id id, size_t i) {
+      uint64_t key = semanticSortKey(id);
+      return sortIndices_[i].second ? ~key : key;
+    });
+  } else {
+    auto comparison = [this](const auto& row1, const auto& row2) {
+      return comesBefore(sortIndices_, row1, row2);
+    };
+
+    // We cannot use the `CALL_FIXED_SIZE` macro here because the `sort`
+    // function is templated not only on the integer `I` (which the
+    // `callFixedSize` function deals with) but also on the `comparison`.
+    ad_utility::callFixedSizeVi(width, [&idTable, &comparison](auto I) {
+      IdTableUtils::sort<I>(&idTable, comparison);
+    });
+  }
   // We can't check during sort, so reset status here
   cancellationHandle_->resetWatchDogState();
   checkCancellation();
@@ -11,6 +11,7 @@
 
 #include "engine/Operation.h"
 #include "engine/QueryExecutionTree.h"
+#include "global/ValueIdComparators.h"
 
 // The implementation of the SPARQL `ORDER BY` operation.
 //
@@ -51,6 +52,25 @@ class OrderBy : public Operation {
   using SortedVariables = std::vector<std::pair<Variable, AscOrDesc>>;
   SortedVariables getSortedVariables() const;
 
+  // Return true iff `row1` comes before `row2` in the order specified by the
+  // `sortIndices`. This is also used by `TopK`.
+  template <typename Row1, typename Row2>
+  static bool comesBefore(const SortIndices& sortIndices, const Row1& row1,
+                          const Row2& row2) {
+    for (const auto& [column, isDescending] : sortIndices) {
+      if (row1[column] == row2[column]) {
+        continue;
+      }
+      bool isLessThan = toBoolNotUndef(
+          valueIdComparators::compareIds<
+              valueIdComparators::ComparisonForIncompatibleTypes::
+                  CompareByType>(row1[column], row2[column],
+                                 valueIdComparators::Comparison::LT));
+      return isLessThan != isDescending;
+    }
+    return false;
+  }
+
  private:
   uint64_t getSizeEstimateBeforeLimit() override {
     return subtree_->getSizeEstimate();
@@ -22,6 +22,7 @@
 #include "index/Index.h"
 #include "util/Cache.h"
 #include "util/ConcurrentCache.h"
+#include "util/HashMap.h"
 
 // The value of the `QueryResultCache` below. It consists of a `Result` together
 // with its `RuntimeInfo`.
@@ -205,6 +206,17 @@ class QueryExecutionContext
   auto& pinResultWithName() { return pinResultWithName_; }
   const auto& pinResultWithName() const { return pinResultWithName_; }
 
+  // The actual sizes of the results of subtrees (identified by their cache
+  // key) that differed strongly from their size estimates. When the query is
+  // planned again, these sizes are used instead of the estimates (see
+  // `AdaptiveReplanning.h`).
+  ad_utility::HashMap<std::string, size_t>& observedResultSizes() {
+    return observedResultSizes_;
+  }
+  const ad_utility::HashMap<std::string, size_t>& observedResultSizes() const {
+    return observedResultSizes_;
+  }
+
   // Helper function to abstract away the fact that `LocalVocabContext` is
   // currently just an alias for `IndexImpl`.
   const LocalVocabContext& getLocalVocabContext() const { return getIndex(); }
@@ -262,6 +274,9 @@ class QueryExecutionContext
   // See the documentation for the getter with the same name above;
   bool disableCaching_ = false;
 
+  // See the documentation for the getter with the same name above.
+  ad_utility::HashMap<std::string, size_t> observedResultSizes_;
+
   // The last point in time when a websocket update was sent. This is used for
   // limiting the update frequency when `sendPriority` is `IfDue`.
   mutable std::chrono::steady_clock::time_point lastWebsocketUpdate_ =
@@ -105,6 +105,15 @@ size_t QueryExecutionTree::getSizeEstimate() {
     // results that were already in the cache. This however often lead to poor
     // planning, because the query planner compared exact sizes with estimates,
     // which lead to worse plans than just conistently choosing the estimate.
+    // The exception are results with a strongly wrong estimate that were
+    // observed during adaptive re-planning.
+    if (qec_ != nullptr) {
+      auto it = qec_->observedResultSizes().find(getCacheKey());
+      if (it != qec_->observedResultSizes().end()) {
+        sizeEstimate_ = it->second;
+        return sizeEstimate_.value();
+      }
+    }
     sizeEstimate_ = rootOperation_->getSizeEstimate();
   }
   return sizeEstimate_.value();
@@ -30,8 +30,11 @@
 #include "engine/Filter.h"
 #include "engine/GroupBy.h"
 #include "engine/HasPredicateScan.h"
+#include "engine/HashDistinct.h"
+#include "engine/HashJoin.h"
 #include "engine/IndexScan.h"
 #include "engine/Join.h"
+#include "engine/JoinHelpers.h"
 #include "engine/Load.h"
 #include "engine/MaterializedViews.h"
 #include "engine/Minus.h"
@@ -51,6 +54,7 @@
 #include "engine/TextIndexScanForEntity.h"
 #include "engine/TextIndexScanForWord.h"
 #include "engine/TextLimit.h"
+#include "engine/TopK.h"
 #include "engine/TransitivePathBase.h"
 #include "engine/Union.h"
 #include "engine/Values.h"
@@ -341,6 +345,21 @@ std::vector<SubtreePlan> QueryPlanner::getDistinctRow(
     distinctPlan._qet =
         makeExecutionTree<Distinct>(_qec, parent._qet, keepIndices);
     added.push_back(distinctPlan);
+    // If the `Distinct` has to sort its input, also consider a `HashDistinct`
+    // for large inputs. Which of the two is actually used is then decided by
+    // the cost estimates.
+    bool distinctRequiresSort =
+        distinctPlan._qet->getRootOperation()->getChildren().at(0) !=
+        parent._qet.get();
+    if (distinctRequiresSort && !keepIndices.empty() &&
+        parent._qet->getSizeEstimate() >=
+            getRuntimeParameter<
+                &RuntimeParameters::hashDistinctMinNumRowsToSort_>()) {
+      SubtreePlan hashDistinctPlan(_qec);
+      hashDistinctPlan._qet =
+          makeExecutionTree<HashDistinct>(_qec, parent._qet, keepIndices);
+      added.push_back(std::move(hashDistinctPlan));
+    }
   }
   return added;
 }
@@ -480,8 +499,25 @@ std::vector<SubtreePlan> QueryPlanner::getOrderByRow(
       AD_CONTRACT_CHECK(pq._isInternalSort == IsInternalSort::False);
       // Note: As the internal ordering is different from the semantic ordering
       // needed by `OrderBy`, we always have to instantiate the `OrderBy`
-      // operation.
-      tree = makeExecutionTree<OrderBy>(_qec, parent._qet, sortIndices);
+      // operation (or a `TopK`, see below).
+      //
+      // If there is a small `LIMIT`, only the first `LIMIT + OFFSET` rows have
+      // to be computed. This doesn't hold if there is a trailing `VALUES`
+      // clause, which is joined with the result before the `LIMIT` is applied.
+      const auto& limitOffset = pq._limitOffset;
+      const auto& postValues = pq.postQueryValuesClause_;
+      bool hasPostValues =
+          postValues.has_value() &&
+          !postValues.value()._inlineValues._variables.empty();
+      size_t numRows =
+          limitOffset.upperBound(std::numeric_limits<uint64_t>::max());
+      if (limitOffset._limit.has_value() && !hasPostValues &&
+          numRows <=
+              getRuntimeParameter<&RuntimeParameters::topKMaxNumRows_>()) {
+        tree = makeExecutionTree<TopK>(_qec, parent._qet, sortIndices, numRows);
+      } else {
+        tree = makeExecutionTree<OrderBy>(_qec, parent._qet, sortIndices);
+      }
     }
     added.push_back(plan);
   }
@@ -2302,6 +2338,12 @@ std::vector<SubtreePlan> QueryPlanner::createJoinCandidates(
     candidates.push_back(std::move(opt.value()));
   }
 
+  // A hash join doesn't need sorted inputs, so it might be cheaper than the
+  // sort-based joins below.
+  if (auto opt = createHashJoin(a, b, jcs)) {
+    candidates.push_back(std::move(opt.value()));
+  }
+
   if (jcs.size() >= 2) {
     // If there are two or more join columns use a multiColumnJoin.
     SubtreePlan plan = makeSubtreePlan<MultiColumnJoin>(_qec, a._qet, b._qet);
@@ -2679,6 +2721,34 @@ auto QueryPlanner::createJoinWithHasPredicateScan(
   return plan;
 }
 
+// _____________________________________________________________________
+auto QueryPlanner::createHashJoin(const SubtreePlan& a, const SubtreePlan& b,
+                                  const JoinColumns& jcs)
+    -> std::optional<SubtreePlan> {
+  if (!qlever::joinHelpers::joinColumnsAreAlwaysDefined(jcs, a._qet, b._qet)) {
+    return std::nullopt;
+  }
+  // The number of rows of the `side`-th input that a sort-based join would
+  // have to sort.
+  auto numRowsToSort = [&jcs](const SubtreePlan& plan, size_t side) {
+    std::vector<ColumnIndex> sortColumns;
+    for (const auto& jc : jcs) {
+      sortColumns.push_back(jc[side]);
+    }
+    return plan._qet->getRootOperation()->isSortedBy(sortColumns)
+               ? 0
+               : plan._qet->getSizeEstimate();
+  };
+  if (numRowsToSort(a, 0) + numRowsToSort(b, 1) <
+      getRuntimeParameter<&RuntimeParameters::hashJoinMinNumRowsToSort_>()) {
+    return std::nullopt;
+  }
+  auto qec = a._qet->getRootOperation()->getExecutionContext();
+  auto plan = makeSubtreePlan<HashJoin>(qec, a._qet, b._qet);
+  mergeSubtreePlanIds(plan, a, b);
+  return plan;
+}
+
 // _____________________________________________________________________
 auto QueryPlanner::createJoinWithPathSearch(
     const SubtreePlan& a, const SubtreePlan& b,
@@ -431,6 +431,15 @@ class QueryPlanner {
   static std::optional<SubtreePlan> createJoinWithPathSearch(
       const SubtreePlan& a, const SubtreePlan& b, const JoinColumns& jcs);
 
+  // Used internally by `createJoinCandidates`. Return a `HashJoin` of `a` and
+  // `b` if the join columns are guaranteed to not contain UNDEF values and
+  // a sort-based join would have to sort at least
+  // `hash-join-min-num-rows-to-sort` rows. Else returns `std::nullopt`. Whether
+  // the `HashJoin` is actually used is then decided by the cost estimates.
+  static std::optional<SubtreePlan> createHashJoin(const SubtreePlan& a,
+                                                   const SubtreePlan& b,
+                                                   const JoinColumns& jcs);
+
   // Helper that returns `true` for each of the subtree plans `a` and `b` iff
   // the subtree plan is a spatial join and it is not yet fully constructed
   // (it does not have both children set)
@@ -23,6 +23,17 @@ QueryPlanningCostFactors::QueryPlanningCostFactors() : _factors() {
   _factors["JOIN_SIZE_ESTIMATE_CORRECTION_FACTOR"] = 0.7;
   _factors["DUMMY_JOIN_SIZE_ESTIMATE_CORRECTION_FACTOR"] = 0.7;
 
+  // The cost per row of inserting the build side of a `HashJoin` into the hash
+  // table and of looking up a row of the probe side, relative to the cost per
+  // row of a merge join.
+  _factors["HASH_JOIN_BUILD_COST"] = 3.0;
+  _factors["HASH_JOIN_PROBE_COST"] = 2.0;
+
+  // The cost per row of looking up (and possibly inserting) the values of a
+  // row in the hash set of a `HashDistinct`, relative to the cost per row of a
+  // `Distinct` on sorted input.
+  _factors["HASH_DISTINCT_COST"] = 3.0;
+
   // Assume that a random disk seek is 100 times more expensive than an
   // average `O(1)` access to a single ID.
   _factors["DISK_RANDOM_ACCESS_COST"] = 100;
@@ -18,6 +18,7 @@
 #include <vector>
 
 #include "CompilationInfo.h"
+#include "engine/AdaptiveReplanning.h"
 #include "engine/ExecuteUpdate.h"
 #include "engine/ExportQueryExecutionTrees.h"
 #include "engine/GraphStoreProtocol.h"
@@ -28,8 +29,11 @@
 #include "engine/SparqlProtocol.h"
 #include "engine/UpdateMetadata.h"
 #include "global/RuntimeParameters.h"
+#include "index/BlockAccessHistogram.h"
+#include "index/DecompressedBlockCache.h"
 #include "index/IndexImpl.h"
 #include "index/IndexRebuilder.h"
+#include "index/IndexWarmup.h"
 #include "parser/SparqlParser.h"
 #include "util/AsioHelpers.h"
 #include "util/Exception.h"
@@ -77,6 +81,14 @@ Server::Server(unsigned short port, size_t numThreads,
       [this](ad_utility::MemorySize newValue) {
         cache_.setMaxSizeSingleEntry(newValue);
       });
+  // Note: The global block cache has to be created before the lock on the
+  // runtime parameters is acquired, because its constructor reads them.
+  auto& blockCache = DecompressedBlockCache::global();
+  globalRuntimeParameters.wlock()
+      ->decompressedBlockCacheMaxSize_.setOnUpdateAction(
+          [&blockCache](ad_utility::MemorySize newValue) {
+            blockCache.setMaxSize(newValue);
+          });
 }
 
 // __________________________________________________________________________
@@ -109,6 +121,12 @@ void Server::initialize(const std::string& indexBaseName, bool useText,
     }
   }
 
+  // Prefetch the hot parts of the index, s.t. the first queries after a
+  // restart don't have to wait for many random reads from disk.
+  IndexWarmup::warmUp(
+      index().getImpl(),
+      getRuntimeParameter<&RuntimeParameters::indexWarmupBudget_>());
+
   sortPerformanceEstimator_.computeEstimatesExpensively(
       allocator_, index().numTriples().normalAndInternal_() *
                       PERCENTAGE_OF_TRIPLES_FOR_SORT_ESTIMATE / 100);
@@ -496,6 +514,14 @@ CPP_template_def(typename RequestT, typename ResponseT)(
         handle);
     auto vacuumStats = co_await std::move(coroutine);
     response = createJsonResponse(vacuumStats, request);
+  } else if (auto cmd = checkParameter("cmd", "block-access-stats")) {
+    logCommand(cmd, "get block access statistics");
+    response = createJsonResponse(composeBlockAccessStatsJson(), request);
+  } else if (auto cmd = checkParameter("cmd", "save-block-access-stats")) {
+    requireValidAccessToken("save-block-access-stats");
+    logCommand(cmd, "save block access statistics");
+    BlockAccessHistogram::writeAll(index().getImpl());
+    response = createJsonResponse(composeBlockAccessStatsJson(), request);
   } else if (auto cmd = checkParameter("cmd", "get-settings")) {
     logCommand(cmd, "get server settings");
     response = createJsonResponse(
@@ -784,8 +810,37 @@ Server::PlannedQuery Server::planQuery(
     ParsedQuery&& operation, const ad_utility::Timer& requestTimer,
     TimeLimit timeLimit, QueryExecutionContext& qec,
     ad_utility::SharedCancellationHandle handle) const {
-  QueryPlanner qp(&qec, handle);
-  auto executionTree = qp.createExecutionTree(operation);
+  auto maxNumReplans = getRuntimeParameter<
+      &RuntimeParameters::adaptiveReplanningMaxNumReplans_>();
+  // Adaptive re-planning reuses the already computed results via the cache.
+  bool useAdaptiveReplanning = maxNumReplans > 0 && !qec.disableCaching();
+  // With adaptive re-planning, the time limit also covers the results that are
+  // computed during the planning.
+  auto deadline = std::chrono::steady_clock::now() + timeLimit;
+  auto executionTree = [&]() {
+    if (!useAdaptiveReplanning) {
+      QueryPlanner qp(&qec, handle);
+      return qp.createExecutionTree(operation);
+    }
+    // A `QueryPlanner` can only be used for a single query, and the planning
+    // might modify the `ParsedQuery`, so each plan is created from a copy.
+    ParsedQuery originalOperation = operation;
+    auto createExecutionTree = [&]() {
+      operation = originalOperation;
+      QueryPlanner qp(&qec, handle);
+      return qp.createExecutionTree(operation);
+    };
+    auto prepareForComputation = [&](QueryExecutionTree& qet) {
+      qet.getRootOperation()->recursivelySetCancellationHandle(handle);
+      qet.getRootOperation()->recursivelySetTimeConstraint(deadline);
+    };
+    auto threshold =
+        getRuntimeParameter<&RuntimeParameters::adaptiveReplanningThreshold_>();
+    return qlever::adaptiveReplanning::
+        createExecutionTreeWithAdaptiveReplanning(
+            qec, createExecutionTree, prepareForComputation, maxNumReplans,
+            threshold);
+  }();
   PlannedQuery plannedQuery{std::move(operation), std::move(executionTree),
                             qec};
   handle->throwIfCancelled();
@@ -793,9 +848,15 @@ Server::PlannedQuery Server::planQuery(
   plannedQuery.queryExecutionTree()
       .getRootOperation()
       ->recursivelySetCancellationHandle(std::move(handle));
-  plannedQuery.queryExecutionTree()
-      .getRootOperation()
-      ->recursivelySetTimeConstraint(timeLimit);
+  if (useAdaptiveReplanning) {
+    plannedQuery.queryExecutionTree()
+        .getRootOperation()
+        ->recursivelySetTimeConstraint(deadline);
+  } else {
+    plannedQuery.queryExecutionTree()
+        .getRootOperation()
+        ->recursivelySetTimeConstraint(timeLimit);
+  }
   auto& qet = plannedQuery.queryExecutionTree();
   qet.isRoot() = true;  // allow pinning of the final result
   auto timeForQueryPlanning = requestTimer.msecs();
@@ -873,9 +934,24 @@ nlohmann::json Server::composeCacheStatsJson() const {
   // converter.
   result["cache-size-unpinned"] = cache_.nonPinnedSize().getBytes();
   result["cache-size-pinned"] = cache_.pinnedSize().getBytes();
+
+  auto blockCacheStats = DecompressedBlockCache::global().getStatistics();
+  result["decompressed-block-cache-num-hits"] = blockCacheStats.numHits_;
+  result["decompressed-block-cache-num-misses"] = blockCacheStats.numMisses_;
+  result["decompressed-block-cache-num-entries"] = blockCacheStats.numEntries_;
+  result["decompressed-block-cache-size"] = blockCacheStats.size_.getBytes();
+  result["decompressed-block-cache-max-size"] =
+      blockCacheStats.maxSize_.getBytes();
   return result;
 }
 
+// _____________________________________________________________________________
+nlohmann::json Server::composeBlockAccessStatsJson() const {
+  static constexpr size_t numHottestBlocks = 20;
+  return BlockAccessHistogram::getStatistics(index().getImpl(),
+                                             numHottestBlocks);
+}
+
 // _____________________________________________
 CPP_template_def(typename RequestT)(
     requires ad_utility::httpUtils::HttpRequest<RequestT>)
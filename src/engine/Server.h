@@ -80,6 +80,9 @@ class Server {
   // Get server statistics.
   json composeStatsJson() const;
   json composeCacheStatsJson() const;
+  // Get the statistics of the accesses to the blocks of the permutations (see
+  // `BlockAccessHistogram.h`).
+  json composeBlockAccessStatsJson() const;
 
   // Helper struct bundling a parsed query with a query execution tree.
   // As the `QueryExecutionTree` stores a raw pointer to the
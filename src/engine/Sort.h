@@ -91,6 +91,13 @@ class Sort : public Operation {
  private:
   std::unique_ptr<Operation> cloneImpl() const override;
 
+  // Sorting doesn't change the rows, so the summary can be passed on.
+  bool applyJoinColumnSummaryImpl(const Variable& variable,
+                                  const JoinColumnSummary& summary) override {
+    return subtree_->getRootOperation()->applyJoinColumnSummary(variable,
+                                                                summary);
+  }
+
   virtual Result computeResult(bool requestLaziness) override;
 
   // Sort in memory, using `IdTableUtils::sort`.
@@ -9,7 +9,6 @@
 #include <cstdlib>
 #include <iomanip>
 
-#include "engine/CallFixedSize.h"
 #include "engine/idTable/IdTable.h"
 #include "global/RuntimeParameters.h"
 #include "index/IdTableUtils.h"
@@ -48,10 +47,10 @@ auto SortPerformanceEstimator::measureSortingTime(
     const ad_utility::AllocatorWithLimit<Id>& allocator) -> Timer::Duration {
   auto randomTable = createRandomIdTable(numRows, numColumns, allocator);
   ad_utility::Timer timer{ad_utility::Timer::Started};
-  // Always sort on the first column for simplicity;
-  ad_utility::callFixedSizeVi(numColumns, [&](auto numCols) {
-    IdTableUtils::sort<numCols>(&randomTable, 0ull);
-  });
+  // Always sort on the first column for simplicity. This uses the same
+  // algorithm (a radix sort for `Id`s without a local vocabulary) as the
+  // in-memory sort of the `Sort` operation.
+  IdTableUtils::sort(randomTable, {0});
   return timer.value();
 }
 
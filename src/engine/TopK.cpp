@@ -0,0 +1,194 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#include "engine/TopK.h"
+
+#include <absl/strings/str_cat.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <numeric>
+#include <sstream>
+
+#include "backports/algorithm.h"
+#include "util/TransparentFunctors.h"
+
+namespace {
+// The buffer of a `TopKRows` has room for at least this many rows in addition
+// to the `k` first rows, s.t. the buffer isn't compacted too often for a small
+// `k`.
+constexpr size_t minNumBufferedRows = 1'000;
+
+// The number of rows after which the cancellation is checked.
+constexpr size_t checkCancellationInterval = 1 << 14;
+
+// Collects the first `k` rows (in the order of the `sortIndices`) of all the
+// rows that are passed to `addRows`. The rows are appended to a buffer, which
+// is compacted to the (sorted) first `k` rows whenever it is full. After the
+// first compaction, a row that doesn't come before the last of these `k` rows
+// can't be part of the result and is skipped right away.
+class TopKRows {
+  const OrderBy::SortIndices& sortIndices_;
+  size_t k_;
+  size_t maxNumRows_;
+  IdTable rows_;
+  std::function<void()> checkCancellation_;
+  // True iff the first `k_` rows of `rows_` are the first `k_` rows of all the
+  // rows that have been added (and in sorted order).
+  bool hasThreshold_ = false;
+
+ public:
+  TopKRows(const OrderBy::SortIndices& sortIndices, size_t k, size_t numColumns,
+           const ad_utility::AllocatorWithLimit<Id>& allocator,
+           std::function<void()> checkCancellation)
+      : sortIndices_{sortIndices},
+        k_{k},
+        maxNumRows_{k + std::max(k, minNumBufferedRows)},
+        rows_{numColumns, allocator},
+        checkCancellation_{std::move(checkCancellation)} {}
+
+  // Add the rows of `table` and return the number of rows that were added to
+  // the buffer (the other ones can't be part of the result).
+  size_t addRows(const IdTable& table) {
+    size_t numAdded = 0;
+    for (size_t i = 0; i < table.numRows(); ++i) {
+      if (i % checkCancellationInterval == 0) {
+        checkCancellation_();
+      }
+      const auto& row = table[i];
+      if (hasThreshold_ &&
+          !OrderBy::comesBefore(sortIndices_, row, rows_[k_ - 1])) {
+        continue;
+      }
+      rows_.push_back(row);
+      ++numAdded;
+      if (rows_.numRows() == maxNumRows_) {
+        compact();
+      }
+    }
+    return numAdded;
+  }
+
+  // Return the first `k` rows in sorted order.
+  IdTable getResult() && {
+    compact();
+    return std::move(rows_);
+  }
+
+ private:
+  // Only keep the first `k_` of the buffered rows and sort them.
+  void compact() {
+    std::vector<size_t> order(rows_.numRows());
+    std::iota(order.begin(), order.end(), size_t{0});
+    size_t numKept = std::min(k_, order.size());
+    std::partial_sort(order.begin(), order.begin() + numKept, order.end(),
+                      [this](size_t a, size_t b) {
+                        return OrderBy::comesBefore(sortIndices_, rows_[a],
+                                                    rows_[b]);
+                      });
+    IdTable kept{rows_.numColumns(), rows_.getAllocator()};
+    kept.resize(numKept);
+    for (size_t col = 0; col < rows_.numColumns(); ++col) {
+      std::transform(order.begin(), order.begin() + numKept,
+                     kept.getColumn(col).begin(),
+                     [this, col](size_t row) { return rows_(row, col); });
+    }
+    rows_ = std::move(kept);
+    hasThreshold_ = rows_.numRows() == k_;
+  }
+};
+}  // namespace
+
+// _____________________________________________________________________________
+TopK::TopK(QueryExecutionContext* qec,
+           std::shared_ptr<QueryExecutionTree> subtree,
+           OrderBy::SortIndices sortIndices, size_t numRows)
+    : Operation{qec},
+      subtree_{std::move(subtree)},
+      sortIndices_{std::move(sortIndices)},
+      numRows_{numRows} {
+  AD_CONTRACT_CHECK(!sortIndices_.empty());
+  AD_CONTRACT_CHECK(ql::ranges::all_of(
+      sortIndices_,
+      [this](ColumnIndex index) { return index < getResultWidth(); },
+      ad_utility::first));
+}
+
+// _____________________________________________________________________________
+size_t TopK::getResultWidth() const { return subtree_->getResultWidth(); }
+
+// _____________________________________________________________________________
+std::string TopK::getCacheKeyImpl() const {
+  std::ostringstream os;
+  os << "TOP " << numRows_ << " ORDER BY on columns:";
+  for (auto [column, isDescending] : sortIndices_) {
+    os << (isDescending ? "desc(" : "asc(") << column << ") ";
+  }
+  os << "\n" << subtree_->getCacheKey();
+  return std::move(os).str();
+}
+
+// _____________________________________________________________________________
+std::string TopK::getDescriptor() const {
+  std::string orderByVars;
+  for (const auto& [variable, ascOrDesc] : getSortedVariables()) {
+    bool isDescending = ascOrDesc == OrderBy::AscOrDesc::Desc;
+    absl::StrAppend(&orderByVars, isDescending ? " DESC(" : " ASC(",
+                    variable.name(), ")");
+  }
+  return absl::StrCat("TopK ", numRows_, " on", orderByVars);
+}
+
+// _____________________________________________________________________________
+size_t TopK::getCostEstimate() {
+  size_t size = subtree_->getSizeEstimate();
+  size_t logNumRows = std::max(
+      size_t{1}, static_cast<size_t>(logb(static_cast<double>(numRows_))));
+  return size * logNumRows + subtree_->getCostEstimate();
+}
+
+// _____________________________________________________________________________
+Result TopK::computeResult([[maybe_unused]] bool requestLaziness) {
+  if (numRows_ == 0) {
+    subtree_->getRootOperation()->updateRuntimeInformationWhenOptimizedOut();
+    return {IdTable{getResultWidth(), allocator()}, resultSortedOn(),
+            LocalVocab{}};
+  }
+  std::shared_ptr<const Result> subRes = subtree_->getResult(true);
+  TopKRows topKRows{sortIndices_, numRows_, getResultWidth(), allocator(),
+                    [this]() { checkCancellation(); }};
+  if (subRes->isFullyMaterialized()) {
+    topKRows.addRows(subRes->idTable());
+    return {std::move(topKRows).getResult(), resultSortedOn(),
+            subRes->getSharedLocalVocab()};
+  }
+
+  // The rows of a lazy input may refer to the local vocab of their block, so
+  // we keep the local vocabs of all the blocks from which rows were added.
+  LocalVocab localVocab;
+  for (const auto& [idTable, blockLocalVocab] : subRes->idTables()) {
+    if (topKRows.addRows(idTable) > 0) {
+      localVocab.mergeWith(blockLocalVocab);
+    }
+  }
+  return {std::move(topKRows).getResult(), resultSortedOn(),
+          std::move(localVocab)};
+}
+
+// _____________________________________________________________________________
+OrderBy::SortedVariables TopK::getSortedVariables() const {
+  OrderBy::SortedVariables result;
+  for (const auto& [column, isDescending] : sortIndices_) {
+    using enum OrderBy::AscOrDesc;
+    result.emplace_back(subtree_->getVariableAndInfoByColumnIndex(column).first,
+                        isDescending ? Desc : Asc);
+  }
+  return result;
+}
+
+// _____________________________________________________________________________
+std::unique_ptr<Operation> TopK::cloneImpl() const {
+  return std::make_unique<TopK>(_executionContext, subtree_->clone(),
+                                sortIndices_, numRows_);
+}
@@ -0,0 +1,81 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#ifndef QLEVER_SRC_ENGINE_TOPK_H
+#define QLEVER_SRC_ENGINE_TOPK_H
+
+#include <vector>
+
+#include "engine/Operation.h"
+#include "engine/OrderBy.h"
+#include "engine/QueryExecutionTree.h"
+
+// The first `numRows` rows of the result of an `OrderBy` with the same
+// `sortIndices`, which is used by the query planner for an `ORDER BY` that is
+// followed by a `LIMIT` (where `numRows` is the `LIMIT` plus the `OFFSET`, which
+// are still applied to the result of this operation). The input is consumed
+// lazily if possible, and only the `numRows` first rows seen so far are kept
+// (plus a buffer of candidates of the same size), so the memory consumption
+// doesn't depend on the size of the input.
+class TopK : public Operation {
+ private:
+  std::shared_ptr<QueryExecutionTree> subtree_;
+  OrderBy::SortIndices sortIndices_;
+  size_t numRows_;
+
+ public:
+  TopK(QueryExecutionContext* qec, std::shared_ptr<QueryExecutionTree> subtree,
+       OrderBy::SortIndices sortIndices, size_t numRows);
+
+  // All following functions are inherited from `Operation`, see there for
+  // comments.
+ protected:
+  std::string getCacheKeyImpl() const override;
+
+ public:
+  std::string getDescriptor() const override;
+
+  // Like for `OrderBy`, the result is not sorted by the internal order of the
+  // `Id`s.
+  std::vector<ColumnIndex> resultSortedOn() const override { return {}; }
+
+  // The variables on which this operation sorts (used for testing).
+  OrderBy::SortedVariables getSortedVariables() const;
+
+  // The maximal number of rows of the result.
+  size_t getNumRows() const { return numRows_; }
+
+ private:
+  uint64_t getSizeEstimateBeforeLimit() override {
+    return std::min(subtree_->getSizeEstimate(),
+                    static_cast<uint64_t>(numRows_));
+  }
+
+ public:
+  float getMultiplicity(size_t col) override {
+    return subtree_->getMultiplicity(col);
+  }
+
+  size_t getCostEstimate() override;
+
+  bool knownEmptyResult() override {
+    return numRows_ == 0 || subtree_->knownEmptyResult();
+  }
+
+  size_t getResultWidth() const override;
+
+  std::vector<QueryExecutionTree*> getChildren() override {
+    return {subtree_.get()};
+  }
+
+ private:
+  std::unique_ptr<Operation> cloneImpl() const override;
+
+  Result computeResult([[maybe_unused]] bool requestLaziness) override;
+
+  VariableToColumnMap computeVariableToColumnMap() const override {
+    return subtree_->getVariableColumns();
+  }
+};
+
+#endif  // QLEVER_SRC_ENGINE_TOPK_H
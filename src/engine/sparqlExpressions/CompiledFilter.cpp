@@ -0,0 +1,56 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#include "engine/sparqlExpressions/CompiledFilter.h"
+
+#include "util/Algorithm.h"
+
+namespace sparqlExpression {
+
+// _____________________________________________________________________________
+CompiledFilter::CompiledFilter(Function function,
+                               std::vector<ColumnIndex> columns)
+    : function_{std::move(function)}, columns_{std::move(columns)} {}
+
+// _____________________________________________________________________________
+CompiledFilter CompiledFilter::makeAnd(CompiledFilter a, CompiledFilter b) {
+  auto columns = std::move(a.columns_);
+  columns.insert(columns.end(), b.columns_.begin(), b.columns_.end());
+  auto function = [a = std::move(a.function_), b = std::move(b.function_)](
+                      const EvaluationContext& context, Mask& mask) {
+    a(context, mask);
+    b(context, mask);
+  };
+  return {std::move(function), std::move(columns)};
+}
+
+// _____________________________________________________________________________
+CompiledFilter CompiledFilter::makeOr(CompiledFilter a, CompiledFilter b) {
+  auto columns = std::move(a.columns_);
+  columns.insert(columns.end(), b.columns_.begin(), b.columns_.end());
+  auto function = [a = std::move(a.function_), b = std::move(b.function_)](
+                      const EvaluationContext& context, Mask& mask) {
+    Mask maskA(mask.size(), 1);
+    a(context, maskA);
+    Mask maskB(mask.size(), 1);
+    b(context, maskB);
+    for (size_t i = 0; i < mask.size(); ++i) {
+      mask[i] &= maskA[i] | maskB[i];
+    }
+  };
+  return {std::move(function), std::move(columns)};
+}
+
+// _____________________________________________________________________________
+auto CompiledFilter::evaluate(const EvaluationContext& context) const -> Mask {
+  Mask mask(context.size(), 1);
+  function_(context, mask);
+  return mask;
+}
+
+// _____________________________________________________________________________
+bool CompiledFilter::readsColumn(ColumnIndex column) const {
+  return ad_utility::contains(columns_, column);
+}
+
+}  // namespace sparqlExpression
@@ -0,0 +1,76 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#ifndef QLEVER_SRC_ENGINE_SPARQLEXPRESSIONS_COMPILEDFILTER_H
+#define QLEVER_SRC_ENGINE_SPARQLEXPRESSIONS_COMPILEDFILTER_H
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "engine/sparqlExpressions/SparqlExpressionTypes.h"
+#include "global/Id.h"
+
+namespace sparqlExpression {
+
+// The expression of a `FILTER`, lowered once (when the `Filter` operation is
+// created) to a closure that directly reads the columns of the input and
+// computes which of its rows are kept. This avoids the walk over the
+// expression tree and the materialization of intermediate `ExpressionResult`s
+// for each evaluation. A `CompiledFilter` is obtained via
+// `SparqlExpression::compileForFilter`, which is only implemented for a few
+// common shapes of expressions (e.g. `?x < 42`, `isIri(?x)`, and conjunctions
+// and disjunctions of these).
+class CompiledFilter {
+ public:
+  // `mask[i]` refers to row `context._beginIndex + i` of the input and is
+  // nonzero iff that row passes the filter.
+  using Mask = std::vector<uint8_t>;
+
+  // Clear the entries of the mask for all the rows that don't pass the filter.
+  using Function = std::function<void(const EvaluationContext&, Mask&)>;
+
+ private:
+  Function function_;
+  // The columns of the input that are read by the `function_`.
+  std::vector<ColumnIndex> columns_;
+
+ public:
+  CompiledFilter(Function function, std::vector<ColumnIndex> columns);
+
+  // Return a filter that keeps exactly the rows for which the `predicate`
+  // returns true when it is called with the `Id` of the given `column` (and
+  // the `EvaluationContext`, e.g. for access to the vocabulary).
+  template <typename Predicate>
+  static CompiledFilter makeForColumn(ColumnIndex column, Predicate predicate) {
+    auto function = [column, predicate = std::move(predicate)](
+                        const EvaluationContext& context, Mask& mask) {
+      ql::span<const Id> ids = context._inputTable.getColumn(column);
+      const Id* begin = ids.data() + context._beginIndex;
+      AD_CORRECTNESS_CHECK(context._endIndex <= ids.size() &&
+                           mask.size() == context.size());
+      // No branches in the loop body, s.t. it can be vectorized if the
+      // `predicate` is simple enough.
+      for (size_t i = 0; i < mask.size(); ++i) {
+        mask[i] &= static_cast<uint8_t>(predicate(begin[i], context));
+      }
+    };
+    return {std::move(function), {column}};
+  }
+
+  // Return a filter that keeps the rows that are kept by both `a` and `b`.
+  static CompiledFilter makeAnd(CompiledFilter a, CompiledFilter b);
+
+  // Return a filter that keeps the rows that are kept by `a` or by `b`.
+  static CompiledFilter makeOr(CompiledFilter a, CompiledFilter b);
+
+  // Evaluate the filter on the rows of the `context`.
+  Mask evaluate(const EvaluationContext& context) const;
+
+  // Return true iff the filter reads the given column of the input.
+  bool readsColumn(ColumnIndex column) const;
+};
+
+}  // namespace sparqlExpression
+
+#endif  // QLEVER_SRC_ENGINE_SPARQLEXPRESSIONS_COMPILEDFILTER_H
@@ -0,0 +1,112 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#include "engine/sparqlExpressions/DistinctValueCachingExpression.h"
+
+#include "backports/algorithm.h"
+#include "engine/sparqlExpressions/SparqlExpressionGenerators.h"
+
+namespace sparqlExpression {
+
+// _____________________________________________________________________________
+DistinctValueCachingExpression::DistinctValueCachingExpression(
+    Ptr impl, Variable variable)
+    : impl_{std::move(impl)}, variable_{std::move(variable)} {}
+
+// _____________________________________________________________________________
+auto DistinctValueCachingExpression::wrapIfPossible(Ptr expression) -> Ptr {
+  auto children = expression->children();
+  if (children.empty()) {
+    return expression;
+  }
+  auto variable = children[0]->getVariableOrNullopt();
+  bool otherChildrenAreConstant =
+      ql::ranges::all_of(children.subspan(1), [](const Ptr& child) {
+        return child->isConstantExpression();
+      });
+  if (!variable.has_value() || !otherChildrenAreConstant) {
+    return expression;
+  }
+  return std::make_unique<DistinctValueCachingExpression>(
+      std::move(expression), std::move(variable.value()));
+}
+
+// _____________________________________________________________________________
+ExpressionResult DistinctValueCachingExpression::evaluate(
+    EvaluationContext* context) const {
+  // Variables that are grouped or that are bound in the same SELECT clause of
+  // a GROUP BY have special semantics, which are handled by the wrapped
+  // expression.
+  if (!context->getColumnIndexForVariable(variable_).has_value() ||
+      !context->_groupedVariables.empty() ||
+      !context->_variableToColumnMapPreviousResults.empty()) {
+    return impl_->evaluate(context);
+  }
+  ql::span<const Id> ids = detail::getIdsFromVariable(variable_, context);
+
+  // The results for the distinct `Id`s of this evaluation. The `Id`s for which
+  // no result is cached yet are collected in `distinctIds`.
+  ad_utility::HashMap<Id, Id> results;
+  IdTable distinctIds{1, context->_allocator};
+  const Index* index = &context->_qec.getIndex();
+  {
+    auto cache = cache_.wlock();
+    if (cache->index_ != index) {
+      cache->index_ = index;
+      cache->results_.clear();
+    }
+    for (Id id : ids) {
+      auto [it, isNew] = results.try_emplace(id);
+      if (!isNew) {
+        continue;
+      }
+      if (auto cached = cache->results_.find(id);
+          cached != cache->results_.end()) {
+        it->second = cached->second;
+      } else {
+        distinctIds.push_back({id});
+      }
+    }
+  }
+  context->cancellationHandle_->throwIfCancelled();
+
+  // Evaluate the wrapped expression once for each of the `distinctIds`.
+  if (!distinctIds.empty()) {
+    VariableToColumnMap distinctVarColMap{
+        {variable_, makePossiblyUndefinedColumn(0)}};
+    EvaluationContext distinctContext{context->_qec,
+                                      distinctVarColMap,
+                                      distinctIds,
+                                      context->_allocator,
+                                      context->_localVocab,
+                                      context->cancellationHandle_,
+                                      context->deadline_};
+    auto distinctResult = impl_->evaluate(&distinctContext);
+    auto* distinctResultIds =
+        std::get_if<VectorWithMemoryLimit<Id>>(&distinctResult);
+    AD_CORRECTNESS_CHECK(distinctResultIds != nullptr &&
+                         distinctResultIds->size() == distinctIds.size());
+    auto cache = cache_.wlock();
+    for (size_t i = 0; i < distinctIds.size(); ++i) {
+      Id id = distinctIds(i, 0);
+      Id result = (*distinctResultIds)[i];
+      results[id] = result;
+      // `Id`s from a local vocab are only valid for this evaluation.
+      if (id.getDatatype() != Datatype::LocalVocabIndex &&
+          cache->index_ == index &&
+          cache->results_.size() < maxNumCachedResults) {
+        cache->results_.emplace(id, result);
+      }
+    }
+  }
+  context->cancellationHandle_->throwIfCancelled();
+
+  VectorWithMemoryLimit<Id> result{context->_allocator};
+  result.reserve(ids.size());
+  for (Id id : ids) {
+    result.push_back(results.find(id)->second);
+  }
+  return result;
+}
+
+}  // namespace sparqlExpression
@@ -0,0 +1,69 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#ifndef QLEVER_SRC_ENGINE_SPARQLEXPRESSIONS_DISTINCTVALUECACHINGEXPRESSION_H
+#define QLEVER_SRC_ENGINE_SPARQLEXPRESSIONS_DISTINCTVALUECACHINGEXPRESSION_H
+
+#include "engine/sparqlExpressions/SparqlExpression.h"
+#include "util/HashMap.h"
+#include "util/Synchronized.h"
+
+namespace sparqlExpression {
+
+// Wrapper for expressions like `REGEX(?x, "pattern")` or `CONTAINS(STR(?x),
+// "abc")`, the result of which only depends on the value of a single variable
+// and which are expensive to evaluate because the string of each value has to
+// be retrieved from the vocabulary. The wrapped expression is evaluated only
+// once for each distinct `Id` of the variable, and the results are then looked
+// up for all the rows. The results for `Id`s that don't refer to a local
+// vocabulary (in particular, for all `VocabIndex`es) are additionally cached
+// across evaluations (for example, for all the blocks of a lazy input of a
+// `FILTER`), for the lifetime of the expression, i.e. for a single query.
+class DistinctValueCachingExpression : public SparqlExpression {
+ public:
+  // The maximal number of results that are cached across evaluations, s.t.
+  // the memory of the cache is bounded.
+  static constexpr size_t maxNumCachedResults = 1'000'000;
+
+ private:
+  // The wrapped expression. Its first child is the `variable_`, and all its
+  // other children are constants.
+  Ptr impl_;
+  Variable variable_;
+
+  struct Cache {
+    // The results are only valid for the `Index` that was used to compute
+    // them.
+    const Index* index_ = nullptr;
+    ad_utility::HashMap<Id, Id> results_;
+  };
+  mutable ad_utility::Synchronized<Cache> cache_;
+
+ public:
+  DistinctValueCachingExpression(Ptr impl, Variable variable);
+
+  // If the first child of the `expression` is a variable (possibly wrapped in
+  // `STR()`, which some string expressions store implicitly) and all other
+  // children are constants, return the `expression` wrapped in a
+  // `DistinctValueCachingExpression`, else return the `expression` unchanged.
+  // The `expression` must return an `Id` (e.g. a boolean) for each row.
+  static Ptr wrapIfPossible(Ptr expression);
+
+  ExpressionResult evaluate(EvaluationContext* context) const override;
+
+  // The result is the same as the result of the wrapped expression.
+  std::string getCacheKey(const VariableToColumnMap& varColMap) const override {
+    return impl_->getCacheKey(varColMap);
+  }
+
+  // The number of results that are currently cached across evaluations (for
+  // testing).
+  size_t numCachedResults() const { return cache_.rlock()->results_.size(); }
+
+ private:
+  ql::span<Ptr> childrenImpl() override { return impl_->children(); }
+};
+
+}  // namespace sparqlExpression
+
+#endif  // QLEVER_SRC_ENGINE_SPARQLEXPRESSIONS_DISTINCTVALUECACHINGEXPRESSION_H
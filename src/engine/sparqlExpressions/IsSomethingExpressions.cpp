@@ -46,6 +46,28 @@ CPP_class_template(typename NaryOperation,
     }
     return prefilterVec;
   }
+
+  // Compile `isIri(?x)` etc. if `?x` is contained in the input.
+  std::optional<CompiledFilter> compileForFilter(
+      const VariableToColumnMap& variableToColumnMap,
+      [[maybe_unused]] const QueryExecutionContext& qec) const override {
+    const auto& children = this->children();
+    AD_CORRECTNESS_CHECK(children.size() == 1);
+    std::optional<Variable> optVar = children[0]->getVariableOrNullopt();
+    if (!optVar.has_value()) {
+      return std::nullopt;
+    }
+    auto it = variableToColumnMap.find(optVar.value());
+    if (it == variableToColumnMap.end()) {
+      return std::nullopt;
+    }
+    using Getter =
+        std::tuple_element_t<0, typename NaryOperation::ValueGetters>;
+    return CompiledFilter::makeForColumn(
+        it->second.columnIndex_, [](Id id, const EvaluationContext& context) {
+          return Getter{}(id, &context) == Id::makeFromBool(true);
+        });
+  }
 };
 
 //______________________________________________________________________________
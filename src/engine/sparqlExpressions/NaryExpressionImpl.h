@@ -10,6 +10,7 @@
 #include <absl/functional/bind_front.h>
 #include <absl/strings/str_join.h>
 
+#include "engine/sparqlExpressions/SparqlExpressionBatchEvaluation.h"
 #include "engine/sparqlExpressions/SparqlExpressionGenerators.h"
 #include "engine/sparqlExpressions/SparqlExpressionValueGetters.h"
 #include "util/CryptographicHashUtils.h"
@@ -69,6 +70,19 @@ class NaryExpressionStronglyTyped : public SparqlExpression {
         return std::move(optionalResult.value());
       }
 
+      // If the operands consist of `Id`s with a suitable datatype, evaluate the
+      // function in a single loop over all rows (see
+      // `SparqlExpressionBatchEvaluation.h`).
+      using Function = typename NaryOperation::Function;
+      if constexpr (batch::hasBatchFunction<Function>) {
+        auto batchResult =
+            batch::evaluateOnBatches<typename Function::BatchFunction>(
+                context, operands...);
+        if (batchResult.has_value()) {
+          return std::move(batchResult.value());
+        }
+      }
+
       // We have to first determine the number of results we will produce.
       auto targetSize = getResultSize(*context, operands...);
 
@@ -362,6 +376,10 @@ struct NumericIdWrapper {
 // `NumericValue` variant.
 template <typename Function, bool NanOrInfToUndef = false>
 struct MakeNumericExpression {
+  // On `Int`s and `Double`s, the `visitor` below simply calls the `Function`.
+  using BatchFunction =
+      batch::NumericBatchFunction<NumericIdWrapper<Function, NanOrInfToUndef>>;
+
   template <typename... Args>
   Id operator()(const Args&... args) const {
     CPP_assert((concepts::same_as<std::decay_t<Args>, NumericValue> && ...));
@@ -39,6 +39,10 @@ NARY_EXPRESSION(DivideExpressionByZeroIsNan, 2,
 // _____________________________________________________________________________
 // Addition.
 struct AddImpl {
+  // On `Int`s and `Double`s, only the overloads for `int64_t` and `double`
+  // below are used.
+  using BatchFunction = batch::NumericBatchFunction<AddImpl>;
+
   ValueId operator()(NumericOrDateValue lhs, NumericOrDateValue rhs) const {
     return std::visit(AddImpl{}, lhs, rhs);
   }
@@ -79,6 +83,10 @@ NARY_EXPRESSION(AddExpression, 2, FV<AddImpl, NumericOrDateValueGetter>);
 // _____________________________________________________________________________
 // Subtraction.
 struct SubtractImpl {
+  // On `Int`s and `Double`s, only the overloads for `int64_t` and `double`
+  // below are used.
+  using BatchFunction = batch::NumericBatchFunction<SubtractImpl>;
+
   ValueId operator()(NumericOrDateValue lhs, NumericOrDateValue rhs) const {
     return std::visit(SubtractImpl{}, lhs, rhs);
   }
@@ -130,6 +138,9 @@ NARY_EXPRESSION(PowExpression, 2, FV<Pow, NumericValueGetter>);
 // OR and AND
 // _____________________________________________________________________________
 struct OrLambda {
+  // On `Bool`s, this is the ordinary logical operation.
+  using BatchFunction = batch::BooleanBatchFunction<std::logical_or<>>;
+
   Id operator()(TernaryBool a, TernaryBool b) const {
     using enum TernaryBool;
     if (a == True || b == True) {
@@ -144,6 +155,9 @@ struct OrLambda {
 
 // _____________________________________________________________________________
 struct AndLambda {
+  // On `Bool`s, this is the ordinary logical operation.
+  using BatchFunction = batch::BooleanBatchFunction<std::logical_and<>>;
+
   Id operator()(TernaryBool a, TernaryBool b) const {
     using enum TernaryBool;
     if (a == True && b == True) {
@@ -441,6 +455,33 @@ CPP_template(typename BinaryPrefilterExpr, typename NaryOperation)(
     return std::nullopt;
   }
 
+  // A conjunction or disjunction can be compiled if both children can be
+  // compiled.
+  std::optional<CompiledFilter> compileForFilter(
+      const VariableToColumnMap& variableToColumnMap,
+      const QueryExecutionContext& qec) const override {
+    const auto& children = this->children();
+    AD_CORRECTNESS_CHECK(children.size() == 2);
+    auto left = children[0]->compileForFilter(variableToColumnMap, qec);
+    if (!left.has_value()) {
+      return std::nullopt;
+    }
+    auto right = children[1]->compileForFilter(variableToColumnMap, qec);
+    if (!right.has_value()) {
+      return std::nullopt;
+    }
+    if constexpr (std::is_same_v<BinaryPrefilterExpr,
+                                 prefilterExpressions::OrExpression>) {
+      return CompiledFilter::makeOr(std::move(left.value()),
+                                    std::move(right.value()));
+    } else {
+      static_assert(std::is_same_v<BinaryPrefilterExpr,
+                                   prefilterExpressions::AndExpression>);
+      return CompiledFilter::makeAnd(std::move(left.value()),
+                                     std::move(right.value()));
+    }
+  }
+
   // _____________________________________________________________________________
   bool isResultAlwaysDefined(const VariableToColumnMap& map) const override {
     auto isAlwaysDefined = [&map](const auto& child) {
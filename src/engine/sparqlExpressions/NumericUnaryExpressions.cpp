@@ -12,6 +12,9 @@ namespace detail {
 // _____________________________________________________________________________
 // Unary negation.
 struct UnaryNegate {
+  // On `Bool`s, this is the ordinary logical negation.
+  using BatchFunction = batch::BooleanBatchFunction<std::logical_not<>>;
+
   Id operator()(TernaryBool a) const {
     using enum TernaryBool;
     switch (a) {
@@ -406,6 +406,131 @@ BlockMetadataRanges PrefilterExpression::evaluate(
   return result;
 }
 
+// Split the `[min_, max_]` bounds of the column `statistics` into one pair of
+// bounds for each datatype that is contained in the column, s.t. each pair
+// can be evaluated like the first and last `ValueId` of a block in which
+// all `ValueId`s have the same datatype (see `getRangesMixedDatatypeBlocks`
+// above for why this is necessary). For the datatypes between the datatypes
+// of `min_` and `max_`, the smallest and largest possible `ValueId` of that
+// datatype are used. Return `std::nullopt` if no such bounds can be
+// determined.
+static std::optional<std::vector<std::pair<ValueId, ValueId>>>
+getBoundsPerDatatype(
+    const CompressedBlockMetadata::ColumnStatistics& statistics) {
+  using enum Datatype;
+  using Statistics = CompressedBlockMetadata::ColumnStatistics;
+  const auto& [min, max, datatypes] = statistics;
+  Datatype minDatatype = min.getDatatype();
+  Datatype maxDatatype = max.getDatatype();
+  std::vector<std::pair<ValueId, ValueId>> bounds;
+  // `VocabIndex` and `LocalVocabIndex` are ordered by their strings, see
+  // `getRangesMixedDatatypeBlocks` above.
+  if (datatypes == Statistics::datatypeBit(minDatatype) ||
+      datatypes == (Statistics::datatypeBit(VocabIndex) |
+                    Statistics::datatypeBit(LocalVocabIndex))) {
+    bounds.emplace_back(min, max);
+  } else if (statistics.containsDatatype(LocalVocabIndex)) {
+    // We can't construct the bounds for `LocalVocabIndex` and the datatypes
+    // that are interleaved with it.
+    return std::nullopt;
+  } else {
+    constexpr auto maxDatatypeValue = static_cast<size_t>(MaxValue);
+    for (size_t i = 0; i <= maxDatatypeValue; ++i) {
+      auto datatype = static_cast<Datatype>(i);
+      if (!statistics.containsDatatype(datatype)) {
+        continue;
+      }
+      uint64_t datatypeBits = static_cast<uint64_t>(i) << ValueId::numDataBits;
+      bounds.emplace_back(
+          datatype == minDatatype ? min : ValueId::fromBits(datatypeBits),
+          datatype == maxDatatype
+              ? max
+              : ValueId::fromBits(datatypeBits | ValueId::maxIndex));
+    }
+  }
+
+  // The `Int` and `Double` values are ordered by their bits, which means that
+  // the negative values come after the positive values (see
+  // `ValueId::compareThreeWay`). The evaluation of the first and last
+  // `ValueId` of a block relies on the values in between being ordered, so we
+  // have to split bounds that contain both positive and negative values.
+  std::vector<std::pair<ValueId, ValueId>> result;
+  constexpr uint64_t signBit = uint64_t{1} << (ValueId::numDataBits - 1);
+  for (auto [lower, upper] : bounds) {
+    Datatype datatype = lower.getDatatype();
+    if ((datatype == Int || datatype == Double) &&
+        (lower.getBits() & signBit) == 0 && (upper.getBits() & signBit) != 0) {
+      uint64_t datatypeBits = lower.getBits() & ~ValueId::maxIndex;
+      result.emplace_back(lower,
+                          ValueId::fromBits(datatypeBits | (signBit - 1)));
+      result.emplace_back(ValueId::fromBits(datatypeBits | signBit), upper);
+    } else {
+      result.emplace_back(lower, upper);
+    }
+  }
+  return result;
+}
+
+// Set the `ValueId` at the given column index of the `triple`.
+static void setIdAtColumnIndex(CompressedBlockMetadata::PermutedTriple& triple,
+                               size_t columnIndex, ValueId id) {
+  switch (columnIndex) {
+    case 0:
+      triple.col0Id_ = id;
+      return;
+    case 1:
+      triple.col1Id_ = id;
+      return;
+    case 2:
+      triple.col2Id_ = id;
+      return;
+    default:
+      // columnIndex out of bounds
+      AD_FAIL();
+  }
+}
+
+//______________________________________________________________________________
+BlockMetadataRanges PrefilterExpression::evaluateWithColumnStatistics(
+    const LocalVocabContext& context, BlockMetadataSpan blockRange,
+    size_t evaluationColumn) const {
+  AD_CONTRACT_CHECK(evaluationColumn < 3);
+  // Evaluate this expression on a single block, the `evaluationColumn` of
+  // which starts with `lower` and ends with `upper`. Return true iff the block
+  // is relevant.
+  auto isRelevant = [this, &context, evaluationColumn](ValueId lower,
+                                                       ValueId upper) {
+    CompressedBlockMetadata bounds{};
+    setIdAtColumnIndex(bounds.firstTriple_, evaluationColumn, lower);
+    setIdAtColumnIndex(bounds.lastTriple_, evaluationColumn, upper);
+    BlockMetadataSpan boundsSpan{&bounds, 1};
+    AccessValueIdFromBlockMetadata accessValueIdOp(evaluationColumn);
+    ValueIdSubrange idRange{ValueIdIt{&boundsSpan, 0, accessValueIdOp},
+                            ValueIdIt{&boundsSpan, 2, accessValueIdOp}};
+    return ql::ranges::any_of(
+        evaluateImpl(context, idRange, boundsSpan, false),
+        [](const BlockMetadataRange& range) { return !range.empty(); });
+  };
+
+  BlockMetadataRanges result;
+  for (auto it = blockRange.begin(); it != blockRange.end(); ++it) {
+    const auto& statistics = it->columnStatistics_;
+    std::optional<std::vector<std::pair<ValueId, ValueId>>> bounds;
+    if (statistics.has_value()) {
+      bounds = getBoundsPerDatatype(statistics.value()[evaluationColumn]);
+    }
+    bool relevant =
+        !bounds.has_value() ||
+        ql::ranges::any_of(bounds.value(), [&isRelevant](const auto& bound) {
+          return isRelevant(bound.first, bound.second);
+        });
+    if (relevant) {
+      detail::mergeBlockRangeWithRanges(result, {it, std::next(it)});
+    }
+  }
+  return result;
+}
+
 //______________________________________________________________________________
 ValueId PrefilterExpression::getValueIdFromIdOrLocalVocabEntry(
     const IdOrLocalVocabEntry& referenceValue, LocalVocab& vocab) {
@@ -136,6 +136,16 @@ class PrefilterExpression {
                                BlockMetadataSpan blockRange,
                                size_t evaluationColumn) const;
 
+  // Similar to `evaluate`, but for an `evaluationColumn` (`< 3`) which is not
+  // sorted within the blocks, e.g. the object column of a scan for a fixed
+  // predicate. Each block is evaluated separately on the bounds given by its
+  // `columnStatistics_` (one pair of bounds for each of the datatypes that
+  // occur in the column). Blocks without statistics are always relevant. The
+  // `blockRange` doesn't have to adhere to the conditions of `evaluate`.
+  BlockMetadataRanges evaluateWithColumnStatistics(
+      const LocalVocabContext& context, BlockMetadataSpan blockRange,
+      size_t evaluationColumn) const;
+
   // `evaluateImpl` is internally used for the actual pre-filter procedure.
   // `ValueIdSubrange idRange` enables indirect access to all `ValueId`s at
   // column index `evaluationColumn` over the containerized `ql::span<const
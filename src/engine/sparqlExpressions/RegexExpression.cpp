@@ -9,6 +9,7 @@
 #include <re2/re2.h>
 
 #include "backports/StartsWithAndEndsWith.h"
+#include "engine/sparqlExpressions/DistinctValueCachingExpression.h"
 #include "engine/sparqlExpressions/LiteralExpression.h"
 #include "engine/sparqlExpressions/NaryExpression.h"
 #include "engine/sparqlExpressions/NaryExpressionImpl.h"
@@ -165,14 +166,8 @@ ql::span<SparqlExpression::Ptr> PrefixRegexExpression::childrenImpl() {
 }
 
 // _____________________________________________________________________________
-ExpressionResult PrefixRegexExpression::evaluate(
-    EvaluationContext* context) const {
-  // This function must only be called if we have a simple prefix regex.
-  auto optColumn = context->getColumnIndexForVariable(variable_);
-  if (!optColumn.has_value()) {
-    return Id::makeUndefined();
-  }
-
+std::vector<std::pair<Id, Id>> PrefixRegexExpression::getLowerAndUpperIds(
+    const QueryExecutionContext& qec) const {
   // If the expression is enclosed in `STR()`, we have two ranges: for the
   // prefix with and without leading "<".
   //
@@ -193,12 +188,26 @@ ExpressionResult PrefixRegexExpression::evaluate(
   std::vector<std::pair<Id, Id>> lowerAndUpperIds;
   lowerAndUpperIds.reserve(actualPrefixes.size());
   for (const auto& prefix : actualPrefixes) {
-    const auto& ranges = context->_qec.getIndex().prefixRanges(prefix);
+    const auto& ranges = qec.getIndex().prefixRanges(prefix);
     for (const auto& [begin, end] : ranges.ranges()) {
       lowerAndUpperIds.emplace_back(Id::makeFromVocabIndex(begin),
                                     Id::makeFromVocabIndex(end));
     }
   }
+  return lowerAndUpperIds;
+}
+
+// _____________________________________________________________________________
+ExpressionResult PrefixRegexExpression::evaluate(
+    EvaluationContext* context) const {
+  // This function must only be called if we have a simple prefix regex.
+  auto optColumn = context->getColumnIndexForVariable(variable_);
+  if (!optColumn.has_value()) {
+    return Id::makeUndefined();
+  }
+
+  std::vector<std::pair<Id, Id>> lowerAndUpperIds =
+      getLowerAndUpperIds(context->_qec);
   checkCancellation(context);
 
   // Begin and end of the input (for each row of which we want to
@@ -259,6 +268,28 @@ ExpressionResult PrefixRegexExpression::evaluate(
   return result;
 }
 
+// _____________________________________________________________________________
+std::optional<CompiledFilter> PrefixRegexExpression::compileForFilter(
+    const VariableToColumnMap& variableToColumnMap,
+    const QueryExecutionContext& qec) const {
+  auto it = variableToColumnMap.find(variable_);
+  if (it == variableToColumnMap.end()) {
+    return std::nullopt;
+  }
+  // Undefined values are filtered out, as they are not contained in any of the
+  // ranges.
+  return CompiledFilter::makeForColumn(
+      it->second.columnIndex_,
+      [lowerAndUpperIds = getLowerAndUpperIds(qec)](
+          Id id, const EvaluationContext&) {
+        return ql::ranges::any_of(
+            lowerAndUpperIds, [id](const auto& lowerUpper) {
+              return !valueIdComparators::compareByBits(id, lowerUpper.first) &&
+                     valueIdComparators::compareByBits(id, lowerUpper.second);
+            });
+      });
+}
+
 // _____________________________________________________________________________
 auto PrefixRegexExpression::getEstimatesForFilterExpression(
     uint64_t inputSize,
@@ -334,14 +365,34 @@ SparqlExpression::Ptr makeRegexExpression(SparqlExpression::Ptr string,
                                           SparqlExpression::Ptr regex,
                                           SparqlExpression::Ptr flags) {
   if (flags) {
-    if (auto* stringLiteralExpression =
-            dynamic_cast<const StringLiteralExpression*>(flags.get())) {
-      detail::ensureIsSimpleLiteral(stringLiteralExpression->value());
+    const auto* flagsLiteral =
+        dynamic_cast<const StringLiteralExpression*>(flags.get());
+    if (flagsLiteral) {
+      detail::ensureIsSimpleLiteral(flagsLiteral->value());
     }
     detail::ensureIsValidRegexIfConstant(*regex);
     detail::ensureIsValidFlagIfConstant(*flags);
-    regex = makeMergeRegexPatternAndFlagsExpression(std::move(regex),
-                                                    std::move(flags));
+    const auto* regexLiteral =
+        dynamic_cast<const StringLiteralExpression*>(regex.get());
+    if (flagsLiteral && regexLiteral &&
+        !regexLiteral->value().hasDatatype() &&
+        !regexLiteral->value().hasLanguageTag()) {
+      // Merge constant flags into a constant regex right away (in the same
+      // way as `makeMergeRegexPatternAndFlagsExpression`), s.t. the regex
+      // stays a constant and the expression can be wrapped below.
+      auto regexString = asStringViewUnsafe(regexLiteral->value().getContent());
+      auto flagsString = asStringViewUnsafe(flagsLiteral->value().getContent());
+      std::string merged =
+          flagsString.empty()
+              ? std::string{regexString}
+              : absl::StrCat("(?", flagsString, ":", regexString, ")");
+      regex = std::make_unique<StringLiteralExpression>(
+          ad_utility::triple_component::Literal::literalWithNormalizedContent(
+              asNormalizedStringViewUnsafe(merged)));
+    } else {
+      regex = makeMergeRegexPatternAndFlagsExpression(std::move(regex),
+                                                      std::move(flags));
+    }
   } else if (auto prefixExpression =
                  PrefixRegexExpression::makePrefixRegexExpressionIfPossible(
                      string, *regex)) {
@@ -350,8 +401,12 @@ SparqlExpression::Ptr makeRegexExpression(SparqlExpression::Ptr string,
   } else {
     detail::ensureIsValidRegexIfConstant(*regex);
   }
-  return std::make_unique<detail::RegexExpression>(std::move(string),
-                                                   std::move(regex));
+  // For a constant regex, the regex only has to be evaluated once per distinct
+  // value of the `string` (which may also be `STR(?x)`, see
+  // `StringExpressionImpl`).
+  return DistinctValueCachingExpression::wrapIfPossible(
+      std::make_unique<detail::RegexExpression>(std::move(string),
+                                                std::move(regex)));
 }
 
 // _____________________________________________________________________________
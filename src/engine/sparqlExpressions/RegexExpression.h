@@ -58,9 +58,19 @@ class PrefixRegexExpression : public SparqlExpression {
       uint64_t inputSize,
       const std::optional<Variable>& firstSortedVariable) const override;
 
+  // The vocabulary ranges of the prefix are computed once at compile time.
+  std::optional<CompiledFilter> compileForFilter(
+      const VariableToColumnMap& variableToColumnMap,
+      const QueryExecutionContext& qec) const override;
+
  private:
   ql::span<Ptr> childrenImpl() override;
 
+  // Return the (one or two) ranges `[lower, upper)` of `Id`s of the vocabulary
+  // of the `qec` that match the prefix.
+  std::vector<std::pair<Id, Id>> getLowerAndUpperIds(
+      const QueryExecutionContext& qec) const;
+
   // Check if the `CancellationHandle` of `context` has been cancelled and throw
   // an exception if this is the case.
   static void checkCancellation(
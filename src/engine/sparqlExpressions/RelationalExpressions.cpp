@@ -9,6 +9,7 @@
 #include "engine/sparqlExpressions/LiteralExpression.h"
 #include "engine/sparqlExpressions/NaryExpression.h"
 #include "engine/sparqlExpressions/RelationalExpressionHelpers.h"
+#include "engine/sparqlExpressions/SparqlExpressionBatchEvaluation.h"
 #include "engine/sparqlExpressions/SparqlExpressionGenerators.h"
 #include "util/GeoSparqlHelpers.h"
 #include "util/LambdaHelpers.h"
@@ -119,6 +120,17 @@ ad_utility::SetOfIntervals evaluateWithBinarySearch(
   return s;
 }
 
+// The comparison of two numeric values, which is used to evaluate a relational
+// expression on batches of `Int` and `Double` `Id`s. For these datatypes,
+// `compareIds` also simply compares the values.
+template <Comparison Comp>
+struct CompareNumericValues {
+  template <typename A, typename B>
+  bool operator()(A a, B b) const {
+    return applyComparison<Comp>(a, b);
+  }
+};
+
 // The actual comparison function for the `SingleExpressionResult`'s which are
 // `AreComparable` (see above), which means that the comparison between them is
 // supported and not always false.
@@ -168,6 +180,15 @@ CPP_template(Comparison Comp, typename S1, typename S2)(
     }
   }
 
+  // If both operands consist of numeric `Id`s, compare them in a single loop.
+  namespace batch = sparqlExpression::detail::batch;
+  auto resultFromBatches = batch::evaluateOnBatches<
+      batch::NumericBatchFunction<CompareNumericValues<Comp>>>(context, value1,
+                                                               value2);
+  if (resultFromBatches.has_value()) {
+    return std::move(resultFromBatches.value());
+  }
+
   auto [generatorA, generatorB] =
       getGenerators(AD_FWD(value1), AD_FWD(value2), resultSize, context);
   auto itA = generatorA.begin();
@@ -485,6 +506,47 @@ RelationalExpression<comp>::getPrefilterExpressionForMetadata(
   return tryGetPrefilterExprVariablePairVec(child1, child0, true);
 }
 
+// _____________________________________________________________________________
+template <Comparison Comp>
+std::optional<CompiledFilter> RelationalExpression<Comp>::compileForFilter(
+    const VariableToColumnMap& variableToColumnMap,
+    [[maybe_unused]] const QueryExecutionContext& qec) const {
+  // Return the `CompiledFilter` for `variable comp constant` if `variable` is
+  // a `Variable` that is contained in the input and `constant` is an
+  // `IdExpression`.
+  auto tryCompile =
+      [&variableToColumnMap](const SparqlExpression* variable,
+                             const SparqlExpression* constant,
+                             Comparison comparison)
+      -> std::optional<CompiledFilter> {
+    auto optVariable = variable->getVariableOrNullopt();
+    const auto* idExpression = dynamic_cast<const IdExpression*>(constant);
+    if (!optVariable.has_value() || idExpression == nullptr) {
+      return std::nullopt;
+    }
+    auto it = variableToColumnMap.find(optVariable.value());
+    if (it == variableToColumnMap.end()) {
+      return std::nullopt;
+    }
+    // Same semantics as in `evaluateRelationalExpression` above: Incompatible
+    // datatypes (e.g. a string and a number) are never equal nor unequal, so
+    // the corresponding rows are filtered out.
+    Id value = idExpression->value();
+    return CompiledFilter::makeForColumn(
+        it->second.columnIndex_,
+        [value, comparison](Id id, const EvaluationContext&) {
+          return valueIdComparators::compareIds(id, value, comparison) ==
+                 valueIdComparators::ComparisonResult::True;
+        });
+  };
+  const SparqlExpression* child0 = children_.at(0).get();
+  const SparqlExpression* child1 = children_.at(1).get();
+  if (auto result = tryCompile(child0, child1, Comp)) {
+    return result;
+  }
+  return tryCompile(child1, child0, getComparisonForSwappedArguments(Comp));
+}
+
 // _____________________________________________________________________________
 ql::span<SparqlExpression::Ptr> InExpression::childrenImpl() {
   return children_;
@@ -54,6 +54,13 @@ class RelationalExpression : public SparqlExpression {
       uint64_t inputSizeEstimate,
       const std::optional<Variable>& firstSortedVariable) const override;
 
+  // Compile expressions of the form `?var <comparison> constant` (or
+  // `constant <comparison> ?var`), where the constant is directly stored in an
+  // `Id`, e.g. a number or a date.
+  std::optional<CompiledFilter> compileForFilter(
+      const VariableToColumnMap& variableToColumnMap,
+      const QueryExecutionContext& qec) const override;
+
  private:
   ql::span<SparqlExpression::Ptr> childrenImpl() override;
 };
@@ -120,6 +120,13 @@ SparqlExpression::getPrefilterExpressionForMetadata(
   return {};
 };
 
+// _____________________________________________________________________________
+std::optional<CompiledFilter> SparqlExpression::compileForFilter(
+    [[maybe_unused]] const VariableToColumnMap& variableToColumnMap,
+    [[maybe_unused]] const QueryExecutionContext& qec) const {
+  return std::nullopt;
+}
+
 // _____________________________________________________________________________
 bool SparqlExpression::isConstantExpression() const { return false; }
 
@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "backports/span.h"
+#include "engine/sparqlExpressions/CompiledFilter.h"
 #include "engine/sparqlExpressions/SparqlExpressionPimpl.h"
 #include "engine/sparqlExpressions/SparqlExpressionTypes.h"
 #include "rdfTypes/Variable.h"
@@ -122,6 +123,17 @@ class SparqlExpression {
   getPrefilterExpressionForMetadata(const LocalVocabContext& context,
                                     bool isNegated = false) const;
 
+  // If this expression is used as the expression of a `FILTER` on an input
+  // with the given `variableToColumnMap`, return an equivalent
+  // `CompiledFilter` that directly works on the columns of the input (see
+  // `CompiledFilter.h`). Return `std::nullopt` if the expression doesn't have
+  // one of the supported forms, which is what the default implementation does.
+  // The `qec` can be used to precompute values that are the same for all
+  // inputs, like the vocabulary ranges of a prefix regex.
+  virtual std::optional<CompiledFilter> compileForFilter(
+      const VariableToColumnMap& variableToColumnMap,
+      const QueryExecutionContext& qec) const;
+
   // Returns true iff this expression is a simple constant. Default
   // implementation returns `false`.
   virtual bool isConstantExpression() const;
@@ -0,0 +1,225 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+// Evaluation of simple (numeric, comparison, and boolean) expressions on whole
+// batches of `Id`s at once, as a fast path for the value-by-value evaluation
+// via the value getters and generators.
+
+#ifndef QLEVER_SRC_ENGINE_SPARQLEXPRESSIONS_SPARQLEXPRESSIONBATCHEVALUATION_H
+#define QLEVER_SRC_ENGINE_SPARQLEXPRESSIONS_SPARQLEXPRESSIONBATCHEVALUATION_H
+
+#include <array>
+#include <optional>
+#include <type_traits>
+
+#include "engine/sparqlExpressions/SparqlExpressionGenerators.h"
+#include "global/Id.h"
+
+namespace sparqlExpression::detail::batch {
+
+// The `Id`s of a single operand of a batch evaluation, all of which have the
+// same `datatype_`.
+struct IdBatch {
+  ql::span<const Id> ids_;
+  // If true, `ids_` consists of a single `Id` that is used for all rows.
+  bool isConstant_;
+  Datatype datatype_;
+};
+
+// Return the datatype of the `ids` if all of them have the same datatype, and
+// `std::nullopt` otherwise. The loop deliberately has no early exit, s.t. it
+// can be vectorized by the compiler.
+inline std::optional<Datatype> getCommonDatatype(ql::span<const Id> ids) {
+  AD_CONTRACT_CHECK(!ids.empty());
+  const uint64_t firstDatatypeBits = ids[0].getBits() >> Id::numDataBits;
+  uint64_t mismatch = 0;
+  for (Id id : ids) {
+    mismatch |= (id.getBits() >> Id::numDataBits) ^ firstDatatypeBits;
+  }
+  if (mismatch != 0) {
+    return std::nullopt;
+  }
+  return ids[0].getDatatype();
+}
+
+// True iff `T` is an operand type that consists of `Id`s that can be accessed
+// as a contiguous range (see `getIdBatch` below).
+template <typename T>
+constexpr bool isBatchOperand =
+    ad_utility::SimilarToAny<T, Id, VectorWithMemoryLimit<Id>, ::Variable>;
+
+// Return the `Id`s of the `operand` (a constant `Id`, a vector of `Id`s, or a
+// variable, the `Id`s of which are read from the input of the `context`) as an
+// `IdBatch`. Return `std::nullopt` if the `Id`s don't all have the same
+// datatype.
+template <typename Operand>
+std::optional<IdBatch> getIdBatch(const Operand& operand,
+                                  const EvaluationContext* context) {
+  static_assert(isBatchOperand<Operand>);
+  ql::span<const Id> ids;
+  if constexpr (ad_utility::isSimilar<Operand, Id>) {
+    ids = ql::span<const Id>{&operand, 1};
+  } else if constexpr (ad_utility::isSimilar<Operand, ::Variable>) {
+    ids = getIdsFromVariable(operand, context);
+  } else {
+    ids = operand;
+  }
+  if (ids.empty()) {
+    return std::nullopt;
+  }
+  auto datatype = getCommonDatatype(ids);
+  if (!datatype.has_value()) {
+    return std::nullopt;
+  }
+  return IdBatch{ids, isConstantResult<Operand>, datatype.value()};
+}
+
+// Return the value that is stored in the `id`, which must be of the given
+// datatype.
+template <Datatype type>
+auto getValue(Id id) {
+  if constexpr (type == Datatype::Int) {
+    return id.getInt();
+  } else if constexpr (type == Datatype::Double) {
+    return id.getDouble();
+  } else {
+    static_assert(type == Datatype::Bool);
+    return id.getBool();
+  }
+}
+
+// An `IdBatch` with the datatype and the constness known at compile time.
+// `batch[i]` is the value of the `i`-th row.
+template <Datatype type, bool isConstant>
+struct TypedBatch {
+  const Id* ids_;
+  auto operator[](size_t i) const {
+    if constexpr (isConstant) {
+      return getValue<type>(ids_[0]);
+    } else {
+      return getValue<type>(ids_[i]);
+    }
+  }
+};
+
+// A `FunctionT` that can be evaluated on `IdBatch`es, the datatype of which is
+// one of the `Datatypes`. The `FunctionT` is called with the values of the
+// `Id`s (e.g. `int64_t` for `Datatype::Int`) and must return an `Id` or a
+// `bool`. The result must be the same as the result of the corresponding
+// expression when it is evaluated via its value getters.
+template <typename FunctionT, Datatype... Datatypes>
+struct BatchFunction {
+  using Function = FunctionT;
+
+  // If the datatype of the `batch` is one of the `Datatypes`, call `f` with
+  // the corresponding `TypedBatch` and return true, else return false.
+  template <typename F>
+  static bool visitTypedBatch(const IdBatch& batch, const F& f) {
+    auto visitIfDatatype = [&batch, &f](auto datatypeConstant) {
+      constexpr Datatype type = decltype(datatypeConstant)::value;
+      if (batch.datatype_ != type) {
+        return false;
+      }
+      if (batch.isConstant_) {
+        f(TypedBatch<type, true>{batch.ids_.data()});
+      } else {
+        f(TypedBatch<type, false>{batch.ids_.data()});
+      }
+      return true;
+    };
+    return (... ||
+            visitIfDatatype(std::integral_constant<Datatype, Datatypes>{}));
+  }
+};
+
+// Shorthands for functions on numeric and on boolean values.
+template <typename Function>
+using NumericBatchFunction =
+    BatchFunction<Function, Datatype::Int, Datatype::Double>;
+template <typename Function>
+using BooleanBatchFunction = BatchFunction<Function, Datatype::Bool>;
+
+// True iff the `Function` of an expression declares a `BatchFunction` member
+// type, s.t. it can also be evaluated via `evaluateOnBatches` below.
+template <typename Function, typename = void>
+constexpr bool hasBatchFunction = false;
+template <typename Function>
+constexpr bool
+    hasBatchFunction<Function, std::void_t<typename Function::BatchFunction>> =
+        true;
+
+// Call `f` with the `TypedBatch`es for all the `batches` starting from index
+// `I`, where the `typed` batches for the indices before `I` have already been
+// determined. Return false iff one of the datatypes is not supported by the
+// `BatchFunctionT`.
+template <size_t I, typename BatchFunctionT, size_t N, typename F,
+          typename... Typed>
+bool visitTypedBatches(const std::array<IdBatch, N>& batches, const F& f,
+                       const Typed&... typed) {
+  if constexpr (I == N) {
+    f(typed...);
+    return true;
+  } else {
+    // The remaining batches might have a datatype that is not supported, so
+    // the result of the recursive call has to be propagated.
+    bool remainingAreSupported = false;
+    bool isSupported = BatchFunctionT::visitTypedBatch(
+        batches[I],
+        [&batches, &f, &remainingAreSupported, &typed...](const auto& next) {
+          remainingAreSupported = visitTypedBatches<I + 1, BatchFunctionT>(
+              batches, f, typed..., next);
+        });
+    return isSupported && remainingAreSupported;
+  }
+}
+
+// Evaluate the `BatchFunctionT` on all the rows of the `operands` in a single
+// loop over their `Id`s. Return `std::nullopt` if this is not possible because
+// one of the operands is not a `isBatchOperand`, or because its `Id`s don't
+// have a common datatype that is supported by the `BatchFunctionT`. In this
+// case, the expression has to be evaluated row by row.
+template <typename BatchFunctionT, typename... Operands>
+std::optional<ExpressionResult> evaluateOnBatches(
+    const EvaluationContext* context, const Operands&... operands) {
+  // If all the operands are constants, there is nothing to gain.
+  if constexpr (!(... && isBatchOperand<Operands>) ||
+                (... && isConstantResult<Operands>)) {
+    return std::nullopt;
+  } else {
+    constexpr size_t N = sizeof...(Operands);
+    std::array<std::optional<IdBatch>, N> optionalBatches{
+        getIdBatch(operands, context)...};
+    std::array<IdBatch, N> batches;
+    for (size_t i = 0; i < N; ++i) {
+      if (!optionalBatches[i].has_value()) {
+        return std::nullopt;
+      }
+      batches[i] = optionalBatches[i].value();
+      AD_CORRECTNESS_CHECK(batches[i].isConstant_ ||
+                           batches[i].ids_.size() == context->size());
+    }
+
+    context->cancellationHandle_->throwIfCancelled();
+    VectorWithMemoryLimit<Id> result{context->_allocator};
+    result.resize(context->size());
+    auto evaluate = [&result](const auto&... typed) {
+      typename BatchFunctionT::Function function{};
+      for (size_t i = 0; i < result.size(); ++i) {
+        auto value = function(typed[i]...);
+        if constexpr (std::is_same_v<decltype(value), bool>) {
+          result[i] = Id::makeFromBool(value);
+        } else {
+          result[i] = value;
+        }
+      }
+    };
+    if (!visitTypedBatches<0, BatchFunctionT>(batches, evaluate)) {
+      return std::nullopt;
+    }
+    return ExpressionResult{std::move(result)};
+  }
+}
+
+}  // namespace sparqlExpression::detail::batch
+
+#endif  // QLEVER_SRC_ENGINE_SPARQLEXPRESSIONS_SPARQLEXPRESSIONBATCHEVALUATION_H
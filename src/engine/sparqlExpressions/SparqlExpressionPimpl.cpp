@@ -107,6 +107,13 @@ SparqlExpressionPimpl::getPrefilterExpressionForMetadata(
   return _pimpl->getPrefilterExpressionForMetadata(context);
 }
 
+//_____________________________________________________________________________
+std::optional<CompiledFilter> SparqlExpressionPimpl::compileForFilter(
+    const VariableToColumnMap& variableToColumnMap,
+    const QueryExecutionContext& qec) const {
+  return _pimpl->compileForFilter(variableToColumnMap, qec);
+}
+
 // _____________________________________________________________________________
 bool SparqlExpressionPimpl::containsAggregate() const {
   return _pimpl->containsAggregate();
@@ -13,10 +13,13 @@
 #include "rdfTypes/Variable.h"
 #include "util/HashSet.h"
 
+class QueryExecutionContext;
+
 namespace sparqlExpression {
 
 class SparqlExpression;
 struct EvaluationContext;
+class CompiledFilter;
 
 // Improve return type readability.
 // Pair containing `PrefilterExpression` pointer and a `Variable`.
@@ -127,6 +130,12 @@ class SparqlExpressionPimpl {
   std::vector<PrefilterExprVariablePair> getPrefilterExpressionForMetadata(
       const LocalVocabContext& context) const;
 
+  // For a concise description of this method and its functionality, refer to
+  // the corresponding declaration in SparqlExpression.h.
+  std::optional<CompiledFilter> compileForFilter(
+      const VariableToColumnMap& variableToColumnMap,
+      const QueryExecutionContext& qec) const;
+
   SparqlExpression* getPimpl() { return _pimpl.get(); }
   [[nodiscard]] const SparqlExpression* getPimpl() const {
     return _pimpl.get();
@@ -9,6 +9,7 @@
 #endif
 
 #include "backports/StartsWithAndEndsWith.h"
+#include "engine/sparqlExpressions/DistinctValueCachingExpression.h"
 #include "engine/sparqlExpressions/LiteralExpression.h"
 #include "engine/sparqlExpressions/NaryExpressionImpl.h"
 #include "engine/sparqlExpressions/StringExpressionsHelper.h"
@@ -669,7 +670,8 @@ Expr makeUppercaseExpression(Expr child) {
 }
 
 Expr makeStrEndsExpression(Expr child1, Expr child2) {
-  return make<StrEndsExpression>(child1, child2);
+  return DistinctValueCachingExpression::wrapIfPossible(
+      make<StrEndsExpression>(child1, child2));
 }
 Expr makeStrAfterExpression(Expr child1, Expr child2) {
   return make<StrAfterExpression>(child1, child2);
@@ -688,7 +690,8 @@ Expr makeReplaceExpression(Expr input, Expr pattern, Expr repl, Expr flags) {
   return make<ReplaceExpression>(input, pattern, repl);
 }
 Expr makeContainsExpression(Expr child1, Expr child2) {
-  return make<ContainsExpression>(child1, child2);
+  return DistinctValueCachingExpression::wrapIfPossible(
+      make<ContainsExpression>(child1, child2));
 }
 Expr makeConcatExpression(std::vector<Expr> children) {
   return std::make_unique<ConcatExpression>(std::move(children));
@@ -27,9 +27,13 @@ RuntimeParameters::RuntimeParameters() {
   add(cacheMaxSizeSingleEntry_);
   add(lazyIndexScanQueueSize_);
   add(lazyIndexScanNumThreads_);
+  add(lazyIndexScanReadBatchSize_);
+  add(lazyIndexScanNumIoThreads_);
   add(lazyIndexScanMaxSizeMaterialization_);
   add(useBinsearchTransitivePath_);
   add(groupByHashMapEnabled_);
+  add(groupByHashMapNumThreads_);
+  add(groupByHashMapInMemoryThreshold_);
   add(groupByDisableIndexScanOptimizations_);
   add(serviceMaxValueRows_);
   add(serviceMaxRedirects_);
@@ -57,6 +61,18 @@ RuntimeParameters::RuntimeParameters() {
   add(serviceAllowedIriPrefixes_);
   add(permutationWriterNumThreads_);
   add(vacuumMinimumBlockSize_);
+  add(decompressedBlockCacheMaxSize_);
+  add(indexWarmupBudget_);
+  add(joinMaxNumThreads_);
+  add(joinParallelMinNumRows_);
+  add(hashJoinMinNumRowsToSort_);
+  add(hashDistinctMinNumRowsToSort_);
+  add(hashDistinctInMemoryThreshold_);
+  add(sortNumThreads_);
+  add(topKMaxNumRows_);
+  add(joinColumnSummaryMaxNumRanges_);
+  add(adaptiveReplanningMaxNumReplans_);
+  add(adaptiveReplanningThreshold_);
   add(disableCaching_);
   add(logLevel_);
 
@@ -66,6 +82,15 @@ RuntimeParameters::RuntimeParameters() {
   logLevel_.setOnUpdateAction(
       [](LogLevel level) { ad_utility::setRuntimeLogLevel(level); });
 
+  adaptiveReplanningThreshold_.setParameterConstraint(
+      [](double value, std::string_view parameterName) {
+        if (value <= 1.0) {
+          throw std::runtime_error{absl::StrCat(
+              "Parameter ", parameterName, " must be greater than 1, was ",
+              value)};
+        }
+      });
+
   defaultQueryTimeout_.setParameterConstraint(
       [](std::chrono::seconds value, std::string_view parameterName) {
         if (value <= std::chrono::seconds{0}) {
@@ -53,12 +53,27 @@ struct RuntimeParameters {
       ad_utility::MemorySize::gigabytes(5), "cache-max-size-single-entry"};
   SizeT lazyIndexScanQueueSize_{20, "lazy-index-scan-queue-size"};
   SizeT lazyIndexScanNumThreads_{10, "lazy-index-scan-num-threads"};
+  // The number of blocks that a lazy index scan reads from disk together in a
+  // single batch of (coalesced) reads, see `BatchedFileReader`.
+  SizeT lazyIndexScanReadBatchSize_{16, "lazy-index-scan-read-batch-size"};
+  // The number of threads that are used to perform a batch of reads if
+  // `io_uring` is not available.
+  SizeT lazyIndexScanNumIoThreads_{1, "lazy-index-scan-num-io-threads"};
   Duration<std::chrono::seconds> defaultQueryTimeout_{std::chrono::seconds(30),
                                                       "default-query-timeout"};
   SizeT lazyIndexScanMaxSizeMaterialization_{
       1'000'000, "lazy-index-scan-max-size-materialization"};
   Bool useBinsearchTransitivePath_{true, "use-binsearch-transitive-path"};
   Bool groupByHashMapEnabled_{false, "group-by-hash-map-enabled"};
+  // The number of threads that aggregate the hash partitions of a GROUP BY
+  // that uses the hash map optimization.
+  SizeT groupByHashMapNumThreads_{4, "group-by-hash-map-num-threads"};
+  // If the estimated size of the hash maps of a GROUP BY exceeds this
+  // threshold or half of the memory that is left for the query, the rows of
+  // new groups are spilled to disk.
+  MemorySizeParameter groupByHashMapInMemoryThreshold_{
+      ad_utility::MemorySize::gigabytes(5),
+      "group-by-hash-map-in-memory-threshold"};
   Bool groupByDisableIndexScanOptimizations_{
       false, "group-by-disable-index-scan-optimizations"};
   SizeT serviceMaxValueRows_{10'000, "service-max-value-rows"};
@@ -170,6 +185,68 @@ struct RuntimeParameters {
   // `qlever-index`doesn't expose a CLI flag to set this parameter.
   SizeT permutationWriterNumThreads_{2, "permutation-writer-num-threads"};
 
+  // The maximum size of the cache for decompressed blocks of the index
+  // permutations that is shared between all queries (see
+  // `DecompressedBlockCache.h`). A value of 0 disables the cache. Note that
+  // this memory is used in addition to the memory limit for queries.
+  MemorySizeParameter decompressedBlockCacheMaxSize_{
+      ad_utility::MemorySize::gigabytes(1),
+      "decompressed-block-cache-max-size"};
+
+  // The amount of the index (metadata, vocabulary offsets, and blocks of the
+  // permutations) that is prefetched into memory when the server is started
+  // (see `IndexWarmup.h`). A value of 0 disables the warm-up.
+  MemorySizeParameter indexWarmupBudget_{ad_utility::MemorySize::bytes(0),
+                                         "index-warmup-budget"};
+
+  // The maximal number of threads that are used to compute a single join of
+  // two fully materialized inputs. The inputs are split into partitions by
+  // their join columns, which are then joined in parallel. Joins with UNDEF
+  // values in the join columns are always computed by a single thread.
+  SizeT joinMaxNumThreads_{8, "join-max-num-threads"};
+  // Joins of inputs with fewer rows (in total) are computed by a single thread.
+  SizeT joinParallelMinNumRows_{1'000'000, "join-parallel-min-num-rows"};
+  // The query planner only considers a `HashJoin` instead of a sort-based join
+  // if the latter would have to sort at least this many rows (according to the
+  // size estimates).
+  SizeT hashJoinMinNumRowsToSort_{100'000, "hash-join-min-num-rows-to-sort"};
+  // The query planner only considers a `HashDistinct` instead of a sort
+  // followed by a `Distinct` if the sort would have at least this many rows
+  // (according to the size estimates).
+  SizeT hashDistinctMinNumRowsToSort_{100'000,
+                                      "hash-distinct-min-num-rows-to-sort"};
+  // If the estimated size of the hash set of a `HashDistinct` exceeds this
+  // threshold or half of the memory that is left for the query, the rows with
+  // new values are spilled to disk.
+  MemorySizeParameter hashDistinctInMemoryThreshold_{
+      ad_utility::MemorySize::gigabytes(5),
+      "hash-distinct-in-memory-threshold"};
+
+  // An `ORDER BY` followed by a `LIMIT` is computed by a `TopK` operation
+  // (instead of sorting the complete input) if the `LIMIT` plus the `OFFSET` is
+  // at most this value.
+  SizeT topKMaxNumRows_{100'000, "top-k-max-num-rows"};
+
+  // The maximal number of ranges of a `JoinColumnSummary`, which a `Join` with
+  // one fully materialized child passes to its other child (sideways
+  // information passing). A value of 0 disables the summaries.
+  SizeT joinColumnSummaryMaxNumRanges_{10'000,
+                                       "join-column-summary-max-num-ranges"};
+
+  // Adaptive re-planning: Before a query is executed, the results of the
+  // lowest joins of its plan are computed (see `AdaptiveReplanning.h`). If the
+  // actual size of such a result differs from its estimate by more than the
+  // given factor (in either direction), the query is planned again with the
+  // actual size. This happens at most `adaptiveReplanningMaxNumReplans_` times
+  // per query, a value of 0 disables adaptive re-planning.
+  SizeT adaptiveReplanningMaxNumReplans_{0,
+                                         "adaptive-replanning-max-num-replans"};
+  Double adaptiveReplanningThreshold_{10.0, "adaptive-replanning-threshold"};
+
+  // The number of threads that are used to sort a single `IdTable` in memory
+  // (see `IdTableUtils::sort`).
+  SizeT sortNumThreads_{4, "sort-num-threads"};
+
   // Only blocks of this size or larger will be considered for vacuuming.
   SizeT vacuumMinimumBlockSize_{100, "vacuum-minimum-block-size"};
 
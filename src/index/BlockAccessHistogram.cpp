@@ -0,0 +1,164 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#include "index/BlockAccessHistogram.h"
+
+#include <filesystem>
+#include <numeric>
+
+#include "backports/algorithm.h"
+#include "index/IndexImpl.h"
+#include "util/File.h"
+#include "util/Log.h"
+#include "util/Serializer/FileSerializer.h"
+#include "util/Serializer/SerializeVector.h"
+
+// _____________________________________________________________________________
+BlockAccessHistogram::BlockAccessHistogram(size_t numBlocks,
+                                           std::string filename)
+    : numBlocks_{numBlocks},
+      counts_{std::make_unique<std::atomic<uint64_t>[]>(numBlocks)},
+      filename_{std::move(filename)} {
+  clear();
+  readFromFile();
+}
+
+// _____________________________________________________________________________
+uint64_t BlockAccessHistogram::getCount(size_t blockIndex) const {
+  AD_CONTRACT_CHECK(blockIndex < numBlocks_);
+  return counts_[blockIndex].load(std::memory_order_relaxed);
+}
+
+// _____________________________________________________________________________
+std::vector<uint64_t> BlockAccessHistogram::getCounts() const {
+  std::vector<uint64_t> result;
+  result.reserve(numBlocks_);
+  for (size_t i = 0; i < numBlocks_; ++i) {
+    result.push_back(counts_[i].load(std::memory_order_relaxed));
+  }
+  return result;
+}
+
+// _____________________________________________________________________________
+void BlockAccessHistogram::clear() {
+  for (size_t i = 0; i < numBlocks_; ++i) {
+    counts_[i].store(0, std::memory_order_relaxed);
+  }
+}
+
+// _____________________________________________________________________________
+void BlockAccessHistogram::writeToFile() const {
+  auto tmpFilename = absl::StrCat(filename_, ".tmp");
+  {
+    ad_utility::serialization::FileWriteSerializer serializer{tmpFilename};
+    serializer << magicNumber;
+    serializer << getCounts();
+  }
+  std::filesystem::rename(tmpFilename, filename_);
+}
+
+// _____________________________________________________________________________
+bool BlockAccessHistogram::readFromFile() {
+  if (!std::filesystem::exists(filename_)) {
+    return false;
+  }
+  uint64_t magic = 0;
+  std::vector<uint64_t> counts;
+  try {
+    ad_utility::serialization::FileReadSerializer serializer{filename_};
+    serializer >> magic;
+    if (magic == magicNumber) {
+      serializer >> counts;
+    }
+  } catch (const std::exception& e) {
+    AD_LOG_WARN << "Could not read the block access histogram from "
+                << filename_ << ": " << e.what() << std::endl;
+    return false;
+  }
+  if (magic != magicNumber || counts.size() != numBlocks_) {
+    AD_LOG_WARN << "The block access histogram in " << filename_
+                << " does not match the index and is ignored" << std::endl;
+    return false;
+  }
+  for (size_t i = 0; i < numBlocks_; ++i) {
+    counts_[i].store(counts[i], std::memory_order_relaxed);
+  }
+  return true;
+}
+
+namespace {
+// Call `function(permutationEnum, permutation, histogram)` for each loaded
+// permutation of the `index` that has a `BlockAccessHistogram`.
+template <typename F>
+void forEachHistogram(const IndexImpl& index, const F& function) {
+  for (auto permutationEnum : Permutation::ALL) {
+    auto permutation = index.getPermutationPtr(permutationEnum);
+    if (permutation == nullptr || !permutation->isLoaded()) {
+      continue;
+    }
+    const auto* histogram = permutation->reader().blockAccessHistogram();
+    if (histogram != nullptr) {
+      function(permutationEnum, *permutation, *histogram);
+    }
+  }
+}
+}  // namespace
+
+// _____________________________________________________________________________
+nlohmann::json BlockAccessHistogram::getStatistics(const IndexImpl& index,
+                                                   size_t numHottestBlocks) {
+  auto result = nlohmann::json::object();
+  forEachHistogram(index, [&result, numHottestBlocks](
+                              Permutation::Enum permutationEnum,
+                              const Permutation& permutation,
+                              const BlockAccessHistogram& histogram) {
+    const auto& blocks = permutation.metaData().blockData();
+    auto counts = histogram.getCounts();
+    std::vector<size_t> indices(counts.size());
+    std::iota(indices.begin(), indices.end(), 0);
+    // The blocks with the most accesses come first, ties are broken by the
+    // block index.
+    ql::ranges::stable_sort(indices, std::greater{},
+                            [&counts](size_t i) { return counts[i]; });
+    auto hottestBlocks = nlohmann::json::array();
+    for (size_t i : indices) {
+      if (hottestBlocks.size() >= numHottestBlocks || counts[i] == 0) {
+        break;
+      }
+      hottestBlocks.push_back(
+          {{"block-index", i},
+           {"num-accesses", counts[i]},
+           {"num-rows", blocks.at(i).numRows_},
+           {"size-in-file",
+            CompressedRelationReader::getSizeInFile(blocks.at(i))}});
+    }
+    size_t numRows = 0;
+    for (const auto& block : blocks) {
+      numRows += block.numRows_;
+    }
+    auto numBlocksAccessed =
+        ql::ranges::count_if(counts, [](uint64_t c) { return c > 0; });
+    auto numAccesses =
+        std::accumulate(counts.begin(), counts.end(), uint64_t{0});
+    result[std::string{Permutation::toString(permutationEnum)}] = {
+        {"num-blocks", counts.size()},
+        {"num-blocks-accessed", numBlocksAccessed},
+        {"num-accesses", numAccesses},
+        {"average-num-rows-per-block",
+         blocks.empty() ? 0.0
+                        : static_cast<double>(numRows) /
+                              static_cast<double>(blocks.size())},
+        {"hottest-blocks", std::move(hottestBlocks)}};
+  });
+  return result;
+}
+
+// _____________________________________________________________________________
+void BlockAccessHistogram::writeAll(const IndexImpl& index) {
+  forEachHistogram(index, [](Permutation::Enum, const Permutation&,
+                             const BlockAccessHistogram& histogram) {
+    histogram.writeToFile();
+    AD_LOG_INFO << "Wrote the block access histogram to "
+                << histogram.filename() << std::endl;
+  });
+}
@@ -0,0 +1,87 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#ifndef QLEVER_SRC_INDEX_BLOCKACCESSHISTOGRAM_H
+#define QLEVER_SRC_INDEX_BLOCKACCESSHISTOGRAM_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "util/json.h"
+
+class IndexImpl;
+
+// Count how often each block of a permutation is read by a query. The
+// counters are updated without locks, so they can be used on the hot path of
+// the index scans. The histogram can be written to a sidecar file of the
+// permutation and is read again when the permutation is loaded, s.t. the
+// counts accumulate across restarts of the server. It is used to prefetch the
+// hottest blocks when the server is started (see `IndexWarmup.h`), and the
+// statistics (see `getStatistics` below) help to tune the block size.
+class BlockAccessHistogram {
+ public:
+  // The suffix that is appended to the name of the file of a permutation to
+  // get the name of the file of its histogram.
+  static constexpr std::string_view fileSuffix = ".block-access-histogram";
+
+ private:
+  // Identifies the file format (and its version).
+  static constexpr uint64_t magicNumber = 0x514c424148000001;
+
+  size_t numBlocks_;
+  std::unique_ptr<std::atomic<uint64_t>[]> counts_;
+  std::string filename_;
+
+ public:
+  // Create a histogram for a permutation with `numBlocks` blocks that is
+  // persisted in the file `filename`. If that file exists and matches the
+  // number of blocks, the counts are initialized from it.
+  BlockAccessHistogram(size_t numBlocks, std::string filename);
+
+  // Record that the block with the given `blockIndex` was read. Block indices
+  // that are out of range (e.g. for blocks that purely consist of located
+  // triples from updates) are ignored.
+  void recordAccess(size_t blockIndex) {
+    if (blockIndex < numBlocks_) {
+      counts_[blockIndex].fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  // Return the number of accesses of the block with the given `blockIndex`.
+  uint64_t getCount(size_t blockIndex) const;
+
+  // Return the number of accesses of all blocks.
+  std::vector<uint64_t> getCounts() const;
+
+  size_t numBlocks() const { return numBlocks_; }
+  const std::string& filename() const { return filename_; }
+
+  // Reset all the counts to zero.
+  void clear();
+
+  // Write the counts to the file of this histogram. The file is replaced
+  // atomically, s.t. a crash during the writing doesn't destroy the previously
+  // written histogram.
+  void writeToFile() const;
+
+  // Read the counts from the file of this histogram. Return false (and leave
+  // the counts unchanged) if the file doesn't exist or doesn't match this
+  // histogram, e.g. because the index was rebuilt in the meantime.
+  bool readFromFile();
+
+  // Return statistics about the block accesses for each loaded permutation of
+  // the `index`, including the `numHottestBlocks` blocks with the most
+  // accesses.
+  static nlohmann::json getStatistics(const IndexImpl& index,
+                                      size_t numHottestBlocks);
+
+  // Write the histograms of all the loaded permutations of the `index` to
+  // their files.
+  static void writeAll(const IndexImpl& index);
+};
+
+#endif  // QLEVER_SRC_INDEX_BLOCKACCESSHISTOGRAM_H
@@ -6,6 +6,7 @@
 
 #include "index/CompressedRelation.h"
 
+#include <deque>
 #include <thread>
 
 #include "engine/idTable/CompressedExternalIdTable.h"
@@ -17,7 +18,9 @@
 #include "index/GraphComputation.h"
 #include "index/IdTableUtils.h"
 #include "index/LocatedTriples.h"
+#include "util/BatchedFileReader.h"
 #include "util/CompressionUsingZstd/ZstdWrapper.h"
+#include "util/DeltaBitPacking.h"
 #include "util/Iterators.h"
 #include "util/ThreadSafeQueue.h"
 #include "util/Timer.h"
@@ -85,6 +88,24 @@ CompressedBlockMetadataNoBlockIndex::getOffsetAndCompressedSizeForColumn(
   return offsetsAndCompressedSize_.value().at(columnIndex);
 }
 
+// _____________________________________________________________________________
+auto CompressedBlockMetadataNoBlockIndex::ColumnStatistics::compute(
+    ql::span<const Id> column) -> ColumnStatistics {
+  AD_CONTRACT_CHECK(!column.empty());
+  ColumnStatistics statistics{column[0]};
+  for (Id id : column.subspan(1)) {
+    statistics.add(id);
+  }
+  return statistics;
+}
+
+// _____________________________________________________________________________
+void CompressedBlockMetadataNoBlockIndex::ColumnStatistics::add(Id id) {
+  min_ = std::min(min_, id);
+  max_ = std::max(max_, id);
+  datatypes_ |= datatypeBit(id.getDatatype());
+}
+
 // Return true iff the `triple` is contained in the `scanSpec`. For example, the
 // triple ` 42 0 3 ` is contained in the specs `U U U`, `42 U U` and `42 0 U` ,
 // but not in `42 2 U` where `U` means "scan for all possible values".
@@ -136,6 +157,69 @@ static void pruneBlock(T& block, LimitOffsetClause& limitOffset) {
   }
 }
 
+// Return the maximal ranges `[begin, end)` of rows of the sorted `column`,
+// the values of which occur in the sorted `joinColumn`.
+using RowRanges = std::vector<std::pair<size_t, size_t>>;
+static RowRanges getRowRangesMatchingJoinColumn(ql::span<const Id> column,
+                                                ql::span<const Id> joinColumn) {
+  AD_EXPENSIVE_CHECK(ql::ranges::is_sorted(column));
+  RowRanges result;
+  auto joinIt = joinColumn.begin();
+  size_t i = 0;
+  while (i < column.size()) {
+    joinIt = std::lower_bound(joinIt, joinColumn.end(), column[i]);
+    if (joinIt == joinColumn.end()) {
+      break;
+    }
+    // Skip all the rows that are smaller than the next value of the join
+    // column.
+    if (*joinIt != column[i]) {
+      i = std::lower_bound(column.begin() + i, column.end(), *joinIt) -
+          column.begin();
+      continue;
+    }
+    size_t end = std::upper_bound(column.begin() + i, column.end(), *joinIt) -
+                 column.begin();
+    if (!result.empty() && result.back().second == i) {
+      result.back().second = end;
+    } else {
+      result.emplace_back(i, end);
+    }
+    i = end;
+  }
+  return result;
+}
+
+// Return the rows of the `block` that lie in one of the `rowRanges`.
+static DecompressedBlock copyRowRanges(const DecompressedBlock& block,
+                                       const RowRanges& rowRanges) {
+  if (rowRanges.size() == 1 && rowRanges.front().first == 0 &&
+      rowRanges.front().second == block.numRows()) {
+    return block.clone();
+  }
+  DecompressedBlock result{block.numColumns(), block.getAllocator()};
+  for (const auto& [begin, end] : rowRanges) {
+    result.insertAtEnd(block, begin, end);
+  }
+  return result;
+}
+
+// Remove all the rows from the `block` whose first column doesn't occur in the
+// `joinColumn` (if specified).
+static void filterRowsByJoinColumn(
+    DecompressedBlock& block, std::optional<ql::span<const Id>> joinColumn) {
+  if (!joinColumn.has_value() || block.empty()) {
+    return;
+  }
+  auto rowRanges =
+      getRowRangesMatchingJoinColumn(block.getColumn(0), joinColumn.value());
+  if (rowRanges.size() == 1 && rowRanges.front().first == 0 &&
+      rowRanges.front().second == block.numRows()) {
+    return;
+  }
+  block = copyRowRanges(block, rowRanges);
+}
+
 // ____________________________________________________________________________
 template <typename T>
 CompressedRelationReader::IdTableGeneratorInputRange
@@ -160,6 +244,10 @@ CompressedRelationReader::asyncParallelBlockGenerator(
     ad_utility::Timer popTimer_{
         ad_utility::timer::Timer::InitialStatus::Stopped};
     std::mutex blockIteratorMutex_;
+    // Blocks that have already been read from disk by `readNextBatch`, but
+    // not yet decompressed, together with their index.
+    std::deque<std::pair<size_t, std::optional<CompressedBlock>>>
+        prefetchedBlocks_;
     ad_utility::InputRangeTypeErased<
         std::optional<DecompressedBlockAndMetadata>>
         queue_;
@@ -192,15 +280,76 @@ CompressedRelationReader::asyncParallelBlockGenerator(
           queueSize, numThreads, producer);
     }
 
-    std::optional<
-        std::pair<size_t, std::optional<DecompressedBlockAndMetadata>>>
-    readAndDecompressBlock() {
+    using IndexAndBlock =
+        std::pair<size_t, std::optional<DecompressedBlockAndMetadata>>;
+
+    std::optional<IndexAndBlock> readAndDecompressBlock() {
       cancellationHandle_->throwIfCancelled();
       std::unique_lock lock{blockIteratorMutex_};
-      if (blockMetadataIterator_ == endBlock_) {
-        return std::nullopt;
+      if (prefetchedBlocks_.empty()) {
+        if (blockMetadataIterator_ == endBlock_) {
+          return std::nullopt;
+        }
+        // For a scan with a join column, the blocks are typically read column
+        // by column (see `readAndDecompressBlockForJoin`), so we don't read
+        // them in batches.
+        if (scanConfig_.joinColumn_.has_value()) {
+          return readAndDecompressNextBlockForJoin(lock);
+        }
+        readNextBatch();
       }
+      auto [myIndex, compressedBlock] = std::move(prefetchedBlocks_.front());
+      prefetchedBlocks_.pop_front();
+      lock.unlock();
+      if (!compressedBlock.has_value()) {
+        return IndexAndBlock{myIndex, std::nullopt};
+      }
+      const auto& blockMetadata = *(beginBlock_ + myIndex);
+      return IndexAndBlock{myIndex, reader_->decompressAndPostprocessBlock(
+                                        compressedBlock.value(),
+                                        blockMetadata.numRows_, scanConfig_,
+                                        blockMetadata)};
+    };
 
+    // Read the next (up to) `lazy-index-scan-read-batch-size` many blocks from
+    // disk using a single batch of reads and append them to the
+    // `prefetchedBlocks_`. Blocks that can be skipped because of the graph
+    // filter are appended as `nullopt`. Must only be called while holding the
+    // `blockIteratorMutex_`. Note: the reading could also happen without
+    // holding the lock. We still perform it inside the lock to avoid
+    // contention of the file, and because the batching already allows the
+    // I/O of many blocks to be executed concurrently.
+    void readNextBatch() {
+      const size_t batchSize = std::max(
+          size_t{1}, getRuntimeParameter<
+                         &RuntimeParameters::lazyIndexScanReadBatchSize_>());
+      std::vector<CompressedBlockMetadata> blocksToRead;
+      std::vector<size_t> indicesOfBlocksToRead;
+      for (size_t i = 0; i < batchSize && blockMetadataIterator_ != endBlock_;
+           ++i, ++blockMetadataIterator_) {
+        auto myIndex =
+            static_cast<size_t>(blockMetadataIterator_ - beginBlock_);
+        if (scanConfig_.graphFilter_.canBlockBeSkipped(
+                *blockMetadataIterator_)) {
+          prefetchedBlocks_.emplace_back(myIndex, std::nullopt);
+          continue;
+        }
+        indicesOfBlocksToRead.push_back(prefetchedBlocks_.size());
+        prefetchedBlocks_.emplace_back(myIndex, CompressedBlock{});
+        blocksToRead.push_back(*blockMetadataIterator_);
+      }
+      auto compressedBlocks = reader_->readCompressedBlocksFromFile(
+          blocksToRead, scanConfig_.scanColumns_);
+      for (size_t i = 0; i < compressedBlocks.size(); ++i) {
+        prefetchedBlocks_[indicesOfBlocksToRead[i]].second =
+            std::move(compressedBlocks[i]);
+      }
+    }
+
+    // Read and decompress the next block of a scan with a join column (see
+    // `ScanImplConfig::joinColumn_`).
+    std::optional<IndexAndBlock> readAndDecompressNextBlockForJoin(
+        std::unique_lock<std::mutex>& lock) {
       // Note: taking a copy here is probably not necessary (the lifetime of
       // all the blocks is long enough, so a `const&` would suffice), but the
       // copy is cheap and makes the code more robust.
@@ -212,12 +361,15 @@ CompressedRelationReader::asyncParallelBlockGenerator(
       auto myIndex = static_cast<size_t>(blockMetadataIterator_ - beginBlock_);
       ++blockMetadataIterator_;
       if (scanConfig_.graphFilter_.canBlockBeSkipped(blockMetadata)) {
-        return std::pair{myIndex, std::nullopt};
+        return IndexAndBlock{myIndex, std::nullopt};
+      }
+      // Blocks with located triples are always read completely, because the
+      // merging of the located triples requires all the columns.
+      if (!scanConfig_.locatedTriples_.containsTriples(
+              blockMetadata.blockIndex_)) {
+        return IndexAndBlock{myIndex, reader_->readAndDecompressBlockForJoin(
+                                          blockMetadata, scanConfig_, lock)};
       }
-      // Note: the reading of the blockMetadata could also happen without
-      // holding the lock. We still perform it inside the lock to avoid
-      // contention of the file. On a fast SSD we could possibly change this,
-      // but this has to be investigated.
       auto compressedBlock = reader_->readCompressedBlockFromFile(
           blockMetadata, scanConfig_.scanColumns_);
 
@@ -226,9 +378,10 @@ CompressedRelationReader::asyncParallelBlockGenerator(
           reader_->decompressAndPostprocessBlock(compressedBlock,
                                                  blockMetadata.numRows_,
                                                  scanConfig_, blockMetadata);
-      return std::pair{myIndex,
-                       std::optional{std::move(decompressedBlockAndMetadata)}};
-    };
+      filterRowsByJoinColumn(decompressedBlockAndMetadata.block_,
+                             scanConfig_.joinColumn_);
+      return IndexAndBlock{myIndex, std::move(decompressedBlockAndMetadata)};
+    }
 
     std::optional<IdTable> get() override {
       if (std::exchange(needsStart_, false)) {
@@ -378,8 +531,10 @@ CompressedRelationReader::lazyScan(
     ColumnIndices additionalColumns,
     const CancellationHandle& cancellationHandle,
     const LocatedTriplesPerBlock& locatedTriplesPerBlock,
-    const LimitOffsetClause& limitOffset) const {
+    const LimitOffsetClause& limitOffset,
+    std::optional<ql::span<const Id>> joinColumn) const {
   AD_CONTRACT_CHECK(cancellationHandle);
+  AD_CONTRACT_CHECK(!joinColumn.has_value() || limitOffset.isUnconstrained());
 
   if (relevantBlockMetadata.empty()) {
     return IdTableGeneratorInputRange{};
@@ -450,6 +605,7 @@ CompressedRelationReader::lazyScan(
 
     auto getPrunedBlockAndUpdateDetails(CompressedBlockMetadataIterator it) {
       auto block = getIncompleteBlock(it);
+      filterRowsByJoinColumn(block, config_.joinColumn_);
       pruneBlock(block, limitOffset_);
       if (!block.empty()) {
         details().numElementsYielded_ += block.numRows();
@@ -536,6 +692,13 @@ CompressedRelationReader::lazyScan(
 
   auto config =
       getScanConfig(scanSpec, additionalColumns, locatedTriplesPerBlock);
+  if (joinColumn.has_value()) {
+    // The first column of the result has to be one of the triple columns.
+    AD_CONTRACT_CHECK(!config.scanColumns_.empty() &&
+                      config.scanColumns_.front() < 3);
+    AD_EXPENSIVE_CHECK(ql::ranges::is_sorted(joinColumn.value()));
+    config.joinColumn_ = joinColumn;
+  }
 
   return IdTableGeneratorInputRange{Generator{
       scanSpec, std::move(relevantBlockMetadata), additionalColumns,
@@ -1135,18 +1298,54 @@ void CompressedRelationWriter::writeBufferedRelationsToSingleBlock() {
 // _____________________________________________________________________________
 CompressedBlock CompressedRelationReader::readCompressedBlockFromFile(
     const CompressedBlockMetadata& blockMetaData,
-    ColumnIndicesRef columnIndices) const {
-  CompressedBlock compressedBuffer;
-  compressedBuffer.resize(columnIndices.size());
+    ColumnIndicesRef columnIndices, bool recordAccess) const {
+  auto blocks = readCompressedBlocksFromFile(
+      ql::span<const CompressedBlockMetadata>{&blockMetaData, 1},
+      columnIndices, recordAccess);
+  return std::move(blocks.front());
+}
+
+// _____________________________________________________________________________
+std::vector<CompressedBlock>
+CompressedRelationReader::readCompressedBlocksFromFile(
+    ql::span<const CompressedBlockMetadata> blocks,
+    ColumnIndicesRef columnIndices, bool recordAccess) const {
+  if (recordAccess && blockAccessHistogram_ != nullptr) {
+    for (const auto& block : blocks) {
+      blockAccessHistogram_->recordAccess(block.blockIndex_);
+    }
+  }
+  std::vector<CompressedBlock> result(blocks.size());
+  std::vector<ad_utility::FileReadRequest> readRequests;
+  auto& blockCache = DecompressedBlockCache::global();
   // TODO<C++23> Use `ql::views::zip`
-  for (size_t i = 0; i < compressedBuffer.size(); ++i) {
-    const auto& offset =
-        blockMetaData.getOffsetAndCompressedSizeForColumn(columnIndices[i]);
-    auto& currentCol = compressedBuffer[i];
-    currentCol.resize(offset.compressedSize_);
-    file_.read(currentCol.data(), offset.compressedSize_, offset.offsetInFile_);
+  for (size_t blockIdx = 0; blockIdx < blocks.size(); ++blockIdx) {
+    auto& compressedBuffer = result[blockIdx];
+    compressedBuffer.resize(columnIndices.size());
+    for (size_t i = 0; i < compressedBuffer.size(); ++i) {
+      const auto& offset =
+          blocks[blockIdx].getOffsetAndCompressedSizeForColumn(
+              columnIndices[i]);
+      auto& currentCol = compressedBuffer[i];
+      // Blocks that purely consist of located triples are not stored on disk.
+      if (offset.compressedSize_ > 0) {
+        DecompressedBlockCache::Key key{readerId_, offset.offsetInFile_};
+        currentCol.cachedColumn_ = blockCache.get(key);
+        if (currentCol.cachedColumn_) {
+          continue;
+        }
+        currentCol.cacheKey_ = key;
+      }
+      currentCol.codec_ = offset.codec_;
+      currentCol.data_.resize(offset.compressedSize_);
+      readRequests.push_back({offset.offsetInFile_, offset.compressedSize_,
+                              currentCol.data_.data()});
+    }
   }
-  return compressedBuffer;
+  ad_utility::BatchedFileReader reader{
+      getRuntimeParameter<&RuntimeParameters::lazyIndexScanNumIoThreads_>()};
+  reader.read(file_, std::move(readRequests));
+  return result;
 }
 
 // ____________________________________________________________________________
@@ -1154,9 +1353,20 @@ DecompressedBlock CompressedRelationReader::decompressBlock(
     const CompressedBlock& compressedBlock, size_t numRowsToRead) const {
   DecompressedBlock decompressedBlock{compressedBlock.size(), allocator_};
   decompressedBlock.resize(numRowsToRead);
+  auto& blockCache = DecompressedBlockCache::global();
   for (size_t i = 0; i < compressedBlock.size(); ++i) {
     auto col = decompressedBlock.getColumn(i);
-    decompressColumn(compressedBlock[i], numRowsToRead, col.data());
+    const auto& compressedColumn = compressedBlock[i];
+    if (compressedColumn.cachedColumn_) {
+      const auto& cached = *compressedColumn.cachedColumn_;
+      AD_CORRECTNESS_CHECK(cached.size() == numRowsToRead);
+      ql::ranges::copy(cached, col.begin());
+      continue;
+    }
+    decompressColumn(compressedColumn, numRowsToRead, col.data());
+    if (compressedColumn.cacheKey_.has_value()) {
+      blockCache.insert(compressedColumn.cacheKey_.value(), col);
+    }
   }
   return decompressedBlock;
 }
@@ -1167,7 +1377,15 @@ CompressedRelationReader::decompressAndPostprocessBlock(
     const CompressedBlock& compressedBlock, size_t numRowsToRead,
     const CompressedRelationReader::ScanImplConfig& scanConfig,
     const CompressedBlockMetadata& metadata) const {
-  auto decompressedBlock = decompressBlock(compressedBlock, numRowsToRead);
+  return postprocessBlock(decompressBlock(compressedBlock, numRowsToRead),
+                          scanConfig, metadata);
+}
+
+// ____________________________________________________________________________
+DecompressedBlockAndMetadata CompressedRelationReader::postprocessBlock(
+    DecompressedBlock decompressedBlock,
+    const CompressedRelationReader::ScanImplConfig& scanConfig,
+    const CompressedBlockMetadata& metadata) const {
   auto [numIndexColumns, includeGraphColumn] =
       prepareLocatedTriples(scanConfig.scanColumns_);
   bool hasUpdates = false;
@@ -1189,16 +1407,81 @@ CompressedRelationReader::decompressAndPostprocessBlock(
   return {std::move(decompressedBlock), wasPostprocessed, hasUpdates};
 }
 
+// ____________________________________________________________________________
+DecompressedBlockAndMetadata
+CompressedRelationReader::readAndDecompressBlockForJoin(
+    const CompressedBlockMetadata& blockMetadata,
+    const ScanImplConfig& scanConfig,
+    std::unique_lock<std::mutex>& lock) const {
+  AD_CORRECTNESS_CHECK(scanConfig.joinColumn_.has_value());
+  AD_CORRECTNESS_CHECK(
+      !scanConfig.locatedTriples_.containsTriples(blockMetadata.blockIndex_));
+  ColumnIndicesRef scanColumns = scanConfig.scanColumns_;
+  AD_CORRECTNESS_CHECK(!scanColumns.empty());
+  const size_t numRows = blockMetadata.numRows_;
+
+  // Phase 1: Only read and decompress the first column.
+  auto compressedFirstColumn =
+      readCompressedBlockFromFile(blockMetadata, scanColumns.subspan(0, 1));
+  lock.unlock();
+  auto firstColumn = decompressBlock(compressedFirstColumn, numRows);
+  auto rowRanges = getRowRangesMatchingJoinColumn(
+      firstColumn.getColumn(0), scanConfig.joinColumn_.value());
+  if (rowRanges.empty()) {
+    return {DecompressedBlock{scanColumns.size(), allocator_}, false, false,
+            true};
+  }
+
+  // Phase 2: There are matching rows, so read and decompress the remaining
+  // columns.
+  lock.lock();
+  auto compressedOtherColumns = readCompressedBlockFromFile(
+      blockMetadata, scanColumns.subspan(1), /*recordAccess=*/false);
+  lock.unlock();
+  auto otherColumns = decompressBlock(compressedOtherColumns, numRows);
+
+  // Only materialize the matching rows of the full block.
+  size_t numMatchingRows = 0;
+  for (const auto& [begin, end] : rowRanges) {
+    numMatchingRows += end - begin;
+  }
+  DecompressedBlock block{scanColumns.size(), allocator_};
+  block.resize(numMatchingRows);
+  auto copyMatchingRows = [&rowRanges](ql::span<const Id> source,
+                                       ql::span<Id> target) {
+    auto it = target.begin();
+    for (const auto& [begin, end] : rowRanges) {
+      it = std::copy(source.begin() + begin, source.begin() + end, it);
+    }
+  };
+  copyMatchingRows(firstColumn.getColumn(0), block.getColumn(0));
+  for (size_t i = 1; i < scanColumns.size(); ++i) {
+    copyMatchingRows(otherColumns.getColumn(i - 1), block.getColumn(i));
+  }
+  return postprocessBlock(std::move(block), scanConfig, blockMetadata);
+}
+
 // ____________________________________________________________________________
 template <typename Iterator>
 void CompressedRelationReader::decompressColumn(
-    const std::vector<char>& compressedBlock, size_t numRowsToRead,
+    const CompressedColumn& compressedColumn, size_t numRowsToRead,
     Iterator iterator) {
-  auto numBytesActuallyRead = ZstdWrapper::decompressToBuffer(
-      compressedBlock.data(), compressedBlock.size(), iterator,
-      numRowsToRead * sizeof(*iterator));
   static_assert(sizeof(Id) == sizeof(*iterator));
-  AD_CORRECTNESS_CHECK(numRowsToRead * sizeof(Id) == numBytesActuallyRead);
+  const auto& data = compressedColumn.data_;
+  switch (compressedColumn.codec_) {
+    case ColumnCodec::DeltaBitPacking:
+      ad_utility::DeltaBitPacking::decompress(data.data(), data.size(),
+                                              iterator, numRowsToRead);
+      return;
+    case ColumnCodec::Zstd: {
+      auto numBytesActuallyRead = ZstdWrapper::decompressToBuffer(
+          data.data(), data.size(), iterator,
+          numRowsToRead * sizeof(*iterator));
+      AD_CORRECTNESS_CHECK(numRowsToRead * sizeof(Id) == numBytesActuallyRead);
+      return;
+    }
+  }
+  AD_FAIL();
 }
 
 // ____________________________________________________________________________
@@ -1221,11 +1504,41 @@ CompressedBlockMetadata::OffsetAndCompressedSize
 CompressedRelationWriter::compressAndWriteColumn(ql::span<const Id> column) {
   std::vector<char> compressedBlock = ZstdWrapper::compress(
       (void*)(column.data()), column.size() * sizeof(column[0]));
+  auto codec = ColumnCodec::Zstd;
+  // Prefer the lightweight codec whenever it doesn't make the index larger.
+  auto packedBlock = ad_utility::DeltaBitPacking::compress(column);
+  if (packedBlock.size() <= compressedBlock.size()) {
+    compressedBlock = std::move(packedBlock);
+    codec = ColumnCodec::DeltaBitPacking;
+  }
   auto compressedSize = compressedBlock.size();
   auto file = outfile_.wlock();
   auto offsetInFile = file->tell();
   file->write(compressedBlock.data(), compressedBlock.size());
-  return {offsetInFile, compressedSize};
+  return {offsetInFile, compressedSize, codec};
+}
+
+// _____________________________________________________________________________
+// Compute a Bloom filter with the given `falsePositiveRate` for the `Id`s in
+// the second column of the `block`.
+static ad_utility::BloomFilter computeCol1BloomFilter(
+    const IdTable& block, double falsePositiveRate) {
+  // The filter is sized by the number of distinct `col1Id`s. Within a block
+  // with many `col0Id`s (e.g. the predicates in the SPO permutation), this is
+  // typically much smaller than the number of distinct `(col0Id, col1Id)`
+  // pairs.
+  std::vector<uint64_t> col1Ids;
+  col1Ids.reserve(block.numRows());
+  for (Id id : block.getColumn(1)) {
+    col1Ids.push_back(id.getBits());
+  }
+  ql::ranges::sort(col1Ids);
+  col1Ids.erase(std::unique(col1Ids.begin(), col1Ids.end()), col1Ids.end());
+  ad_utility::BloomFilter filter{col1Ids.size(), falsePositiveRate};
+  for (uint64_t bits : col1Ids) {
+    filter.add(bits);
+  }
+  return filter;
 }
 
 // _____________________________________________________________________________
@@ -1248,13 +1561,26 @@ void CompressedRelationWriter::compressAndWriteBlock(Id firstCol0Id,
     AD_CORRECTNESS_CHECK(lastCol0Id == last[0]);
 
     auto [hasDuplicates, graphInfo] = getGraphInfo(block);
+    using ColumnStatistics =
+        CompressedBlockMetadataNoBlockIndex::ColumnStatistics;
+    std::array<ColumnStatistics, 3> columnStatistics;
+    for (size_t i = 0; i < columnStatistics.size(); ++i) {
+      columnStatistics[i] = ColumnStatistics::compute(block.getColumn(i));
+    }
+    std::optional<ad_utility::BloomFilter> col1BloomFilter;
+    if (col1BloomFilterFalsePositiveRate_.has_value()) {
+      col1BloomFilter = computeCol1BloomFilter(
+          block, col1BloomFilterFalsePositiveRate_.value());
+    }
     blockBuffer_.wlock()->emplace_back(CompressedBlockMetadataNoBlockIndex{
         std::move(offsets),
         numRows,
         {first[0], first[1], first[2], first[3]},
         {last[0], last[1], last[2], last[3]},
         std::move(graphInfo),
-        hasDuplicates});
+        hasDuplicates,
+        columnStatistics,
+        std::move(col1BloomFilter)});
     if (invokeCallback && smallBlocksCallback_) {
       std::invoke(smallBlocksCallback_, std::move(block));
     }
@@ -1330,7 +1656,22 @@ BlockMetadataRanges CompressedRelationReader::getRelevantBlocks(
           resultBlocks.emplace_back(result.begin(), result.end());
         }
       });
-  return resultBlocks;
+
+  // If the `col1Id` is specified, additionally remove the blocks which
+  // certainly don't contain it according to their Bloom filter. This might
+  // split a range into multiple ranges. `LocalVocabIndex` `Id`s are skipped,
+  // because their bits are not unique for a given value (and they are never
+  // part of the blocks on disk).
+  const auto& col1Id = scanSpec.col1Id();
+  if (!col1Id.has_value() ||
+      col1Id.value().getDatatype() == Datatype::LocalVocabIndex) {
+    return resultBlocks;
+  }
+  return filterBlockMetadataRanges(
+      resultBlocks,
+      [col1Id = col1Id.value()](const CompressedBlockMetadata& block) {
+        return block.mayContainCol1Id(col1Id);
+      });
 }
 
 // _____________________________________________________________________________
@@ -1859,6 +2200,8 @@ void CompressedRelationReader::LazyScanMetadata::update(
       static_cast<size_t>(blockAndMetadata.wasPostprocessed_);
   numBlocksWithUpdate_ +=
       static_cast<size_t>(blockAndMetadata.containsUpdates_);
+  numBlocksSkippedBecauseOfJoin_ +=
+      static_cast<size_t>(blockAndMetadata.skippedBecauseOfJoin_);
   ++numBlocksRead_;
   numElementsRead_ += blockAndMetadata.block_.numRows();
 }
@@ -1884,4 +2227,60 @@ void CompressedRelationReader::LazyScanMetadata::aggregate(
   numBlocksSkippedBecauseOfGraph_ += newValue.numBlocksSkippedBecauseOfGraph_;
   numBlocksPostprocessed_ += newValue.numBlocksPostprocessed_;
   numBlocksWithUpdate_ += newValue.numBlocksWithUpdate_;
+  numBlocksSkippedBecauseOfJoin_ += newValue.numBlocksSkippedBecauseOfJoin_;
+}
+
+// _____________________________________________________________________________
+size_t CompressedRelationReader::getSizeInFile(
+    const CompressedBlockMetadataNoBlockIndex& block) {
+  if (!block.offsetsAndCompressedSize_.has_value()) {
+    return 0;
+  }
+  size_t result = 0;
+  for (const auto& column : block.offsetsAndCompressedSize_.value()) {
+    result += column.compressedSize_;
+  }
+  return result;
+}
+
+// _____________________________________________________________________________
+size_t CompressedRelationReader::prefetchBlocks(
+    ql::span<const CompressedBlockMetadata> blocks) const {
+  // The columns of a block and typically also consecutive blocks are stored
+  // adjacently in the file, so we merge adjacent ranges to issue only few
+  // calls to `adviseWillNeed`.
+  std::optional<std::pair<off_t, off_t>> currentRange;
+  auto flush = [this, &currentRange]() {
+    if (currentRange.has_value()) {
+      auto [begin, end] = currentRange.value();
+      file_.adviseWillNeed(begin, static_cast<size_t>(end - begin));
+    }
+  };
+  size_t numBytes = 0;
+  for (const auto& block : blocks) {
+    if (!block.offsetsAndCompressedSize_.has_value()) {
+      continue;
+    }
+    for (const auto& column : block.offsetsAndCompressedSize_.value()) {
+      off_t begin = column.offsetInFile_;
+      off_t end = begin + static_cast<off_t>(column.compressedSize_);
+      numBytes += column.compressedSize_;
+      if (currentRange.has_value() && currentRange->second == begin) {
+        currentRange->second = end;
+      } else {
+        flush();
+        currentRange.emplace(begin, end);
+      }
+    }
+  }
+  flush();
+  return numBytes;
+}
+
+// _____________________________________________________________________________
+void CompressedRelationReader::initializeBlockAccessHistogram(
+    size_t numBlocks) {
+  blockAccessHistogram_ = std::make_shared<BlockAccessHistogram>(
+      numBlocks,
+      absl::StrCat(file_.name(), BlockAccessHistogram::fileSuffix));
 }
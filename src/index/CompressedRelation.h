@@ -7,6 +7,8 @@
 
 #include <gtest/gtest_prod.h>
 
+#include <array>
+#include <mutex>
 #include <vector>
 
 #include "backports/algorithm.h"
@@ -14,9 +16,12 @@
 #include "backports/type_traits.h"
 #include "engine/idTable/IdTable.h"
 #include "global/Id.h"
+#include "index/BlockAccessHistogram.h"
+#include "index/DecompressedBlockCache.h"
 #include "index/KeyOrder.h"
 #include "index/ScanSpecification.h"
 #include "parser/data/LimitOffsetClause.h"
+#include "util/BloomFilter.h"
 #include "util/CancellationHandle.h"
 #include "util/File.h"
 #include "util/MemorySize/MemorySize.h"
@@ -48,11 +53,35 @@ struct DecompressedBlockAndMetadata {
   // True iff triples this block had to be merged with the `LocatedTriples`
   // because it contained updates.
   bool containsUpdates_;
+  // True iff only the first column of the block was decompressed, because
+  // none of its values occurred in the join column of the scan (see
+  // `ScanImplConfig::joinColumn_`). In this case `block_` is empty.
+  bool skippedBecauseOfJoin_ = false;
+};
+
+// The codec with which a single column of a block is compressed. Columns that
+// are (almost) sorted, like the col1 and col2 of most blocks, are typically
+// stored using `DeltaBitPacking` (see `util/DeltaBitPacking.h`), which is much
+// cheaper to decompress than `Zstd`. The values are stored in the index, so
+// they must not be changed.
+enum struct ColumnCodec : uint8_t { Zstd = 0, DeltaBitPacking = 1 };
+
+// A single compressed column of a block, together with the codec that was
+// used to compress it.
+struct CompressedColumn {
+  std::vector<char> data_;
+  ColumnCodec codec_ = ColumnCodec::Zstd;
+  // If the column was found in the `DecompressedBlockCache` when reading the
+  // block, then it is stored here, and `data_` is empty.
+  DecompressedBlockCache::ColumnPtr cachedColumn_;
+  // If set, the column is inserted into the `DecompressedBlockCache` with this
+  // key after it has been decompressed.
+  std::optional<DecompressedBlockCache::Key> cacheKey_;
 };
 
 // After compression the columns have different sizes, so we cannot use an
 // `IdTable`.
-using CompressedBlock = std::vector<std::vector<char>>;
+using CompressedBlock = std::vector<CompressedColumn>;
 
 // The metadata of a compressed block of ID triples in an index permutation.
 struct CompressedBlockMetadataNoBlockIndex {
@@ -61,8 +90,10 @@ struct CompressedBlockMetadataNoBlockIndex {
   struct OffsetAndCompressedSize {
     off_t offsetInFile_;
     size_t compressedSize_;
+    ColumnCodec codec_ = ColumnCodec::Zstd;
     QL_DEFINE_DEFAULTED_EQUALITY_OPERATOR_LOCAL(OffsetAndCompressedSize,
-                                                offsetInFile_, compressedSize_)
+                                                offsetInFile_, compressedSize_,
+                                                codec_)
   };
 
   using GraphInfo = std::optional<std::vector<Id>>;
@@ -116,6 +147,44 @@ struct CompressedBlockMetadataNoBlockIndex {
   PermutedTriple firstTriple_;
   PermutedTriple lastTriple_;
 
+  // Statistics about the `Id`s in one of the columns of a block (a "zone
+  // map"). Only the first column of a block is sorted, so for the other
+  // columns, `firstTriple_` and `lastTriple_` don't tell which `Id`s are
+  // contained in the block. The statistics are used to skip blocks when
+  // prefiltering on such an unsorted column (see `PrefilterExpressionIndex.h`).
+  struct ColumnStatistics {
+    // The smallest and the largest `Id` in the column.
+    Id min_;
+    Id max_;
+    // Bit `i` is set iff the column contains an `Id` with datatype `i`.
+    uint16_t datatypes_ = 0;
+    static_assert(static_cast<size_t>(Datatype::MaxValue) < 16);
+
+    ColumnStatistics() = default;
+
+    // Statistics for a column that consists of the single `id`.
+    explicit ColumnStatistics(Id id)
+        : min_{id}, max_{id}, datatypes_{datatypeBit(id.getDatatype())} {}
+
+    // Compute the statistics of the given `column`, which must not be empty.
+    static ColumnStatistics compute(ql::span<const Id> column);
+
+    // Update the statistics s.t. they also cover the given `id`.
+    void add(Id id);
+
+    // Return true iff the column contains an `Id` with the given `datatype`.
+    bool containsDatatype(Datatype datatype) const {
+      return (datatypes_ & datatypeBit(datatype)) != 0;
+    }
+
+    static constexpr uint16_t datatypeBit(Datatype datatype) {
+      return static_cast<uint16_t>(1u << static_cast<size_t>(datatype));
+    }
+
+    QL_DEFINE_DEFAULTED_EQUALITY_OPERATOR_LOCAL(ColumnStatistics, min_, max_,
+                                                datatypes_)
+  };
+
   // If there are only few graphs contained at all in this block, then
   // the IDs of those graphs are stored here. If there are many different graphs
   // inside this block, `std::nullopt` is stored.
@@ -125,6 +194,30 @@ struct CompressedBlockMetadataNoBlockIndex {
   // blocks.
   bool containsDuplicatesWithDifferentGraphs_;
 
+  // The statistics for the first three columns (the columns of the
+  // permutation, without the graph and other additional columns). Note that
+  // they are only an upper bound for the `Id`s that are actually contained
+  // (for example, deleted triples are not removed from the statistics).
+  // `std::nullopt` means that nothing is known about the contents of the
+  // columns.
+  std::optional<std::array<ColumnStatistics, 3>> columnStatistics_ =
+      std::nullopt;
+
+  // An optional Bloom filter for the `Id`s in the second column (`col1`) of
+  // the block. It is only written when the index was built with a
+  // false-positive rate for these filters, and it allows point lookups with a
+  // fixed `col1Id` to skip blocks that lie within the range of the lookup
+  // according to `firstTriple_` and `lastTriple_`, but don't contain the
+  // `col1Id`. `std::nullopt` means that the block might contain any `Id`.
+  std::optional<ad_utility::BloomFilter> col1BloomFilter_ = std::nullopt;
+
+  // Return false if this block certainly doesn't contain `col1Id` in its
+  // second column.
+  bool mayContainCol1Id(Id col1Id) const {
+    return !col1BloomFilter_.has_value() ||
+           col1BloomFilter_->mayContain(col1Id.getBits());
+  }
+
   // Check for constant values in `firstTriple_` and `lastTriple` over all
   // columns `< columnIndex`.
   // Returns `true` if the respective column values of `firstTriple_` and
@@ -144,7 +237,8 @@ struct CompressedBlockMetadataNoBlockIndex {
   QL_DEFINE_DEFAULTED_EQUALITY_OPERATOR_LOCAL(
       CompressedBlockMetadataNoBlockIndex, offsetsAndCompressedSize_, numRows_,
       firstTriple_, lastTriple_, graphInfo_,
-      containsDuplicatesWithDifferentGraphs_)
+      containsDuplicatesWithDifferentGraphs_, columnStatistics_,
+      col1BloomFilter_)
 
   // Format CompressedBlockMetadata contents for debugging.
   friend std::ostream& operator<<(
@@ -160,6 +254,17 @@ struct CompressedBlockMetadataNoBlockIndex {
     }
     str << "[possibly] contains duplicates: "
         << blockMetadata.containsDuplicatesWithDifferentGraphs_ << '\n';
+    if (blockMetadata.columnStatistics_.has_value()) {
+      for (const auto& statistics : blockMetadata.columnStatistics_.value()) {
+        str << "Column statistics: [" << statistics.min_ << ", "
+            << statistics.max_ << "], datatypes " << statistics.datatypes_
+            << '\n';
+      }
+    }
+    if (blockMetadata.col1BloomFilter_.has_value()) {
+      str << "Bloom filter for col1: "
+          << blockMetadata.col1BloomFilter_->numBits() << " bits\n";
+    }
     return str;
   }
 };
@@ -203,6 +308,14 @@ struct CompressedBlockMetadata : CompressedBlockMetadataNoBlockIndex {
 AD_SERIALIZE_FUNCTION(CompressedBlockMetadata::OffsetAndCompressedSize) {
   serializer | arg.offsetInFile_;
   serializer | arg.compressedSize_;
+  serializer | arg.codec_;
+}
+
+// Serialization of the `ColumnStatistics` subclass.
+AD_SERIALIZE_FUNCTION(CompressedBlockMetadata::ColumnStatistics) {
+  serializer | arg.min_;
+  serializer | arg.max_;
+  serializer | arg.datatypes_;
 }
 
 // Serialization of the block metadata.
@@ -222,6 +335,8 @@ AD_SERIALIZE_FUNCTION(CompressedBlockMetadata) {
   serializer | arg.lastTriple_;
   serializer | arg.graphInfo_;
   serializer | arg.containsDuplicatesWithDifferentGraphs_;
+  serializer | arg.columnStatistics_;
+  serializer | arg.col1BloomFilter_;
   serializer | arg.blockIndex_;
 }
 
@@ -235,6 +350,26 @@ using BlockMetadataRange = ql::ranges::subrange<BlockMetadataIt>;
 // Vector containing `BlockMetadataRange`s.
 using BlockMetadataRanges = std::vector<BlockMetadataRange>;
 
+// Return the (maximal) subranges of the `blockMetadata` that consist only of
+// blocks for which the `predicate` returns true.
+template <typename Predicate>
+BlockMetadataRanges filterBlockMetadataRanges(
+    const BlockMetadataRanges& blockMetadata, const Predicate& predicate) {
+  BlockMetadataRanges result;
+  for (const BlockMetadataRange& range : blockMetadata) {
+    auto it = range.begin();
+    while (it != range.end()) {
+      it = ql::ranges::find_if(it, range.end(), predicate);
+      auto end = ql::ranges::find_if_not(it, range.end(), predicate);
+      if (it != end) {
+        result.emplace_back(it, end);
+      }
+      it = end;
+    }
+  }
+  return result;
+}
+
 // The metadata of a whole compressed "relation", where relation refers to a
 // maximal sequence of triples with equal first component (e.g., P for the PSO
 // permutation).
@@ -299,6 +434,9 @@ class CompressedRelationWriter {
   // A buffer for small relations that will be stored in the same block.
   SmallRelationsBuffer smallRelationsBuffer_{numColumns_, allocator_};
   ad_utility::MemorySize uncompressedBlocksizePerColumn_;
+  // If set, a Bloom filter with this false-positive rate is written for the
+  // second column of each block (see `CompressedBlockMetadata`).
+  std::optional<double> col1BloomFilterFalsePositiveRate_;
 
   // When we store a large relation with multiple blocks then we keep track of
   // its `col0Id`, mostly for sanity checks.
@@ -322,10 +460,12 @@ class CompressedRelationWriter {
   /// Create using a filename, to which the relation data will be written.
   explicit CompressedRelationWriter(
       size_t numColumns, ad_utility::File f,
-      ad_utility::MemorySize uncompressedBlocksizePerColumn)
+      ad_utility::MemorySize uncompressedBlocksizePerColumn,
+      std::optional<double> col1BloomFilterFalsePositiveRate = std::nullopt)
       : outfile_{std::move(f)},
         numColumns_{numColumns},
-        uncompressedBlocksizePerColumn_{uncompressedBlocksizePerColumn} {}
+        uncompressedBlocksizePerColumn_{uncompressedBlocksizePerColumn},
+        col1BloomFilterFalsePositiveRate_{col1BloomFilterFalsePositiveRate} {}
   // Two helper types used to make the interface of the function
   // `createPermutationPair` below safer and more explicit.
   using MetadataCallback =
@@ -468,8 +608,10 @@ class CompressedRelationWriter {
   // data of the written block. Then clear `smallRelationsBuffer_`.
   void writeBufferedRelationsToSingleBlock();
 
-  // Compress the `column` and write it to the `outfile_`. Return the offset and
-  // size of the compressed column in the `outfile_`.
+  // Compress the `column` and write it to the `outfile_`. Return the offset,
+  // the size, and the codec of the compressed column in the `outfile_`. The
+  // codec is `DeltaBitPacking` if this leads to a result that is not larger
+  // than the one of `Zstd`, because it is much cheaper to decompress.
   CompressedBlockMetadata::OffsetAndCompressedSize compressAndWriteColumn(
       ql::span<const Id> column);
 
@@ -522,7 +664,8 @@ class CompressedRelationWriter {
   friend std::pair<std::vector<CompressedBlockMetadata>,
                    std::vector<CompressedRelationMetadata>>
   compressedRelationTestWriteCompressedRelations(
-      T inputs, std::string filename, ad_utility::MemorySize blocksize);
+      T inputs, std::string filename, ad_utility::MemorySize blocksize,
+      std::optional<double> col1BloomFilterFalsePositiveRate);
 
   // Create a `TaskQueue` for the compression and writing of blocks. The number
   // of threads is determined by the runtime parameter
@@ -596,6 +739,13 @@ class CompressedRelationReader {
     ColumnIndices scanColumns_;
     FilterDuplicatesAndGraphs graphFilter_;
     const LocatedTriplesPerBlock& locatedTriples_;
+    // If set, the scan is the input of a join of its first column with this
+    // sorted column (which must not contain UNDEF values), and only the rows
+    // whose first column occurs in the `joinColumn_` are part of the result.
+    // For a complete block, only the first column is decompressed at first,
+    // and the remaining columns are only read and decompressed if at least one
+    // row matches ("late materialization").
+    std::optional<ql::span<const Id>> joinColumn_ = std::nullopt;
   };
 
   // The specification of scan, together with the blocks on which this scan is
@@ -680,6 +830,10 @@ class CompressedRelationReader {
     size_t numBlocksPostprocessed_ = 0;
     // The number of blocks that contain updated (inserted or deleted) triples.
     size_t numBlocksWithUpdate_ = 0;
+    // The number of blocks of which only the first column was decompressed
+    // because none of its values matched the join column of the scan. These
+    // blocks are also counted in `numBlocksRead_`.
+    size_t numBlocksSkippedBecauseOfJoin_ = 0;
     // If a LIMIT or OFFSET is present we possibly read more rows than we
     // actually yield.
     size_t numElementsRead_ = 0;
@@ -714,6 +868,14 @@ class CompressedRelationReader {
   // used for materialized views where repeated rows are meaningful.
   bool useGraphPostProcessing_;
 
+  // Identifies the `file_` in the `DecompressedBlockCache`.
+  uint64_t readerId_ = DecompressedBlockCache::getUniqueReaderId();
+
+  // Counts the accesses to the blocks (see `BlockAccessHistogram.h`). It is
+  // shared between all the copies of a reader and only set for the readers of
+  // loaded permutations (see `initializeBlockAccessHistogram`).
+  std::shared_ptr<BlockAccessHistogram> blockAccessHistogram_;
+
  public:
   explicit CompressedRelationReader(Allocator allocator, ad_utility::File file,
                                     bool useGraphPostProcessing = true)
@@ -787,13 +949,21 @@ class CompressedRelationReader {
   // Similar to `scan` (directly above), but the result of the scan is lazily
   // computed and returned as a generator of the single blocks that are scanned.
   // The blocks are guaranteed to be in order.
+  //
+  // If a `joinColumn` is specified, only the rows whose first column occurs in
+  // it are yielded, and the remaining columns of blocks without any such row
+  // are never decompressed (see `ScanImplConfig::joinColumn_`). The
+  // `joinColumn` must be sorted, must not contain UNDEF values, and must
+  // outlive the returned generator. It can't be combined with a constraining
+  // `limitOffset`.
   CompressedRelationReader::IdTableGeneratorInputRange lazyScan(
       const ScanSpecification& scanSpec,
       std::vector<CompressedBlockMetadata> relevantBlockMetadata,
       ColumnIndices additionalColumns,
       const CancellationHandle& cancellationHandle,
       const LocatedTriplesPerBlock& locatedTriplesPerBlock,
-      const LimitOffsetClause& limitOffset = {}) const;
+      const LimitOffsetClause& limitOffset = {},
+      std::optional<ql::span<const Id>> joinColumn = std::nullopt) const;
 
   // Retrieve all triples in the given block, ignoring updates. This is used in
   // `DeltaTriples::vacuum` to determine update triples that have no effect and
@@ -850,7 +1020,8 @@ class CompressedRelationReader {
   // `BlockMetadataRanges blockMetadata` for the blocks that contain the
   // triples that have the relationId/col0Id specified by
   // `ScanSpecification scanSpec`. If the `col1Id` is specified (not `nullopt`),
-  // then the blocks are additionally filtered by the given `col1Id`.
+  // then the blocks are additionally filtered by the given `col1Id`, also using
+  // the Bloom filters of the blocks (if present).
   static BlockMetadataRanges getRelevantBlocks(
       const ScanSpecification& scanSpec,
       const BlockMetadataRanges& blockMetadata);
@@ -867,6 +1038,27 @@ class CompressedRelationReader {
       const ScanSpecAndBlocks& metadataAndBlocks,
       const LocatedTriplesPerBlock& locatedTriplesPerBlock) const;
 
+  // Ask the kernel to asynchronously read the `blocks` from disk into the page
+  // cache (see `File::adviseWillNeed`), s.t. later scans of these blocks don't
+  // have to wait for the disk. This is used to warm up the index after a
+  // restart. Return the number of bytes for which this was requested.
+  size_t prefetchBlocks(ql::span<const CompressedBlockMetadata> blocks) const;
+
+  // Return the number of bytes that the columns of the `block` occupy in the
+  // file.
+  static size_t getSizeInFile(const CompressedBlockMetadataNoBlockIndex& block);
+
+  // Start counting the accesses to the `numBlocks` blocks of this reader. The
+  // counts are persisted in a sidecar file of the file of this reader and
+  // initialized from it, if it already exists.
+  void initializeBlockAccessHistogram(size_t numBlocks);
+
+  // Return the histogram of the block accesses, or `nullptr` if
+  // `initializeBlockAccessHistogram` hasn't been called.
+  const BlockAccessHistogram* blockAccessHistogram() const {
+    return blockAccessHistogram_.get();
+  }
+
   // Get access to the underlying allocator
   const Allocator& allocator() const { return allocator_; }
 
@@ -874,31 +1066,49 @@ class CompressedRelationReader {
   // allocator.
   CompressedRelationReader makeReaderWithReboundAllocator(
       Allocator allocator) const {
-    return CompressedRelationReader{std::move(allocator),
+    CompressedRelationReader result{std::move(allocator),
                                     ad_utility::File{file_.name(), "r"},
                                     useGraphPostProcessing_};
+    // The new reader reads the same file, so it can share the cached blocks
+    // and the histogram of the block accesses.
+    result.readerId_ = readerId_;
+    result.blockAccessHistogram_ = blockAccessHistogram_;
+    return result;
   }
 
  private:
   // Read the block that is identified by the `blockMetaData` from the `file`.
-  // Only the columns specified by `columnIndices` are read.
+  // Only the columns specified by `columnIndices` are read. Columns that are
+  // contained in the `DecompressedBlockCache` are not read from disk, but
+  // taken from the cache. If `recordAccess` is true, the read is counted in
+  // the `blockAccessHistogram_`. It has to be false when further columns of
+  // a block are read that was already counted.
   CompressedBlock readCompressedBlockFromFile(
       const CompressedBlockMetadata& blockMetaData,
-      ColumnIndicesRef columnIndices) const;
+      ColumnIndicesRef columnIndices, bool recordAccess = true) const;
+
+  // Like `readCompressedBlockFromFile`, but for several blocks at once. All
+  // the columns are read by a single batch of reads, in which the reads of
+  // adjacent columns (and blocks) are coalesced (see `BatchedFileReader`).
+  std::vector<CompressedBlock> readCompressedBlocksFromFile(
+      ql::span<const CompressedBlockMetadata> blocks,
+      ColumnIndicesRef columnIndices, bool recordAccess = true) const;
 
   // Decompress the `compressedBlock`. The number of rows that the block will
   // have after decompression must be passed in via the `numRowsToRead`
   // argument. It is typically obtained from the corresponding
-  // `CompressedBlockMetaData`.
+  // `CompressedBlockMetaData`. Columns that were taken from the
+  // `DecompressedBlockCache` are copied, all other columns are decompressed
+  // and then inserted into the cache.
   DecompressedBlock decompressBlock(const CompressedBlock& compressedBlock,
                                     size_t numRowsToRead) const;
 
-  // Helper function used by `decompressBlock` and
-  // `decompressBlockToExistingIdTable`. Decompress the `compressedColumn` and
-  // store the result at the `iterator`. For the `numRowsToRead` argument, see
-  // the documentation of `decompressBlock`.
+  // Helper function used by `decompressBlock`. Decompress the
+  // `compressedColumn` using its codec and store the result at the `iterator`.
+  // For the `numRowsToRead` argument, see the documentation of
+  // `decompressBlock`.
   template <typename Iterator>
-  static void decompressColumn(const std::vector<char>& compressedColumn,
+  static void decompressColumn(const CompressedColumn& compressedColumn,
                                size_t numRowsToRead, Iterator iterator);
 
   // Read and decompress the parts of the block given by `blockMetaData` (which
@@ -916,6 +1126,24 @@ class CompressedRelationReader {
       const CompressedRelationReader::ScanImplConfig& scanConfig,
       const CompressedBlockMetadata& metadata) const;
 
+  // The postprocessing part of `decompressAndPostprocessBlock`.
+  DecompressedBlockAndMetadata postprocessBlock(
+      DecompressedBlock decompressedBlock,
+      const CompressedRelationReader::ScanImplConfig& scanConfig,
+      const CompressedBlockMetadata& metadata) const;
+
+  // Read and decompress the complete block given by `blockMetadata` for a
+  // scan with a `joinColumn_` (see `ScanImplConfig`), which must not contain
+  // any located triples. First only the first of the `scanColumns_` is read
+  // and decompressed. The remaining columns are only read and decompressed if
+  // at least one of the values of the first column occurs in the
+  // `joinColumn_`, and only the matching rows are materialized. The `lock` is
+  // held while reading from the file and released while decompressing.
+  DecompressedBlockAndMetadata readAndDecompressBlockForJoin(
+      const CompressedBlockMetadata& blockMetadata,
+      const ScanImplConfig& scanConfig,
+      std::unique_lock<std::mutex>& lock) const;
+
   // Read, decompress, and postprocess the part of the block according to
   // `blockMetadata` (which identifies the block) and `scanConfig` (which
   // specifies the part of that block, graph filters, and located triples).
@@ -58,6 +58,24 @@ constexpr inline std::string_view PARTIAL_VOCAB_WORDS_INFIX =
     ".partial-vocab.words.tmp.";
 constexpr inline std::string_view PARTIAL_VOCAB_IDMAP_INFIX =
     ".partial-vocab.idmap.tmp.";
+// Every partial vocabulary has a small file with samples of its words, which
+// is used to split the merging of the vocabularies into ranges (see
+// `mergeVocabulary`).
+constexpr inline std::string_view PARTIAL_VOCAB_SAMPLES_SUFFIX = ".samples";
+// The words of a range of the merged vocabulary, before they are written to the
+// actual vocabulary.
+constexpr inline std::string_view MERGED_VOCAB_RANGE_INFIX =
+    ".merged-vocab.range.tmp.";
+
+// The file in which a shard of a sharded index build (see
+// `IndexImpl::createShardFromFiles`) stores its triples with partial IDs.
+constexpr inline std::string_view SHARD_TRIPLES_SUFFIX = ".shard-triples.dat";
+// The header of each of these files starts with the magic number and the
+// version of the format. The version has to be increased whenever the format
+// of the files changes.
+constexpr inline uint64_t SHARD_TRIPLES_MAGIC_NUMBER =
+    0x51'4C'53'48'41'52'44'53;
+constexpr inline uint64_t SHARD_TRIPLES_FORMAT_VERSION = 1;
 
 // _________________________________________________________________
 constexpr inline std::string_view QLEVER_INTERNAL_INDEX_INFIX = ".internal";
@@ -88,6 +106,22 @@ constexpr inline size_t QUEUE_SIZE_AFTER_PARALLEL_PARSING = 10;
 // performance negatively.
 constexpr inline size_t BLOCKSIZE_VOCABULARY_MERGING = 100;
 
+// The number of disjoint ranges of words that are merged in parallel when
+// merging the partial vocabularies. Note that each range keeps all the partial
+// vocabularies open at the same time, so the number of open files during the
+// merge is this factor times the number of partial vocabularies. For very
+// large inputs, this might require a higher limit for the number of open
+// files (`ulimit -n`).
+constexpr inline size_t NUM_PARALLEL_VOCABULARY_MERGE_RANGES = 4;
+
+// Every partial vocabulary stores every `PARTIAL_VOCAB_SAMPLE_DISTANCE`-th word
+// as a sample. It is not const, so we can set it to a much lower value for unit
+// tests to increase the test coverage.
+inline std::atomic<size_t>& PARTIAL_VOCAB_SAMPLE_DISTANCE() {
+  static std::atomic<size_t> value = 10'000;
+  return value;
+}
+
 // A buffer size used during the second pass of the Index build.
 // It is not const, so we can set it to a much lower value for unit tests to
 // increase the test coverage.
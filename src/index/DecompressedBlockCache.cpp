@@ -0,0 +1,82 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#include "index/DecompressedBlockCache.h"
+
+#include "global/RuntimeParameters.h"
+
+// _____________________________________________________________________________
+DecompressedBlockCache::DecompressedBlockCache(ad_utility::MemorySize maxSize)
+    : cache_{ad_utility::size_t_max, maxSize, maxSize},
+      maxSizeInBytes_{maxSize.getBytes()} {}
+
+// _____________________________________________________________________________
+DecompressedBlockCache& DecompressedBlockCache::global() {
+  static DecompressedBlockCache cache{getRuntimeParameter<
+      &RuntimeParameters::decompressedBlockCacheMaxSize_>()};
+  return cache;
+}
+
+// _____________________________________________________________________________
+uint64_t DecompressedBlockCache::getUniqueReaderId() {
+  static std::atomic<uint64_t> nextId = 0;
+  return nextId++;
+}
+
+// _____________________________________________________________________________
+auto DecompressedBlockCache::get(const Key& key) -> ColumnPtr {
+  if (maxSizeInBytes_ == 0) {
+    return nullptr;
+  }
+  auto result = (*cache_.wlock())[key];
+  if (result) {
+    ++numHits_;
+  } else {
+    ++numMisses_;
+  }
+  return result;
+}
+
+// _____________________________________________________________________________
+void DecompressedBlockCache::insert(const Key& key,
+                                    ql::span<const Id> column) {
+  if (column.size() * sizeof(Id) > maxSizeInBytes_) {
+    return;
+  }
+  // Copy the column before acquiring the lock to keep the critical section
+  // short.
+  Column copy(column.begin(), column.end());
+  cache_.withWriteLock([&key, &copy](Cache& cache) {
+    // Two threads might have concurrently decompressed the same column.
+    if (!cache.contains(key)) {
+      cache.insert(key, std::move(copy));
+    }
+  });
+}
+
+// _____________________________________________________________________________
+void DecompressedBlockCache::setMaxSize(ad_utility::MemorySize maxSize) {
+  cache_.withWriteLock([maxSize](Cache& cache) {
+    cache.setMaxSize(maxSize);
+    cache.setMaxSizeSingleEntry(maxSize);
+    if (maxSize.getBytes() == 0) {
+      cache.clearAll();
+    }
+  });
+  maxSizeInBytes_ = maxSize.getBytes();
+}
+
+// _____________________________________________________________________________
+void DecompressedBlockCache::clear() {
+  cache_.wlock()->clearAll();
+  numHits_ = 0;
+  numMisses_ = 0;
+}
+
+// _____________________________________________________________________________
+auto DecompressedBlockCache::getStatistics() const -> Statistics {
+  auto cache = cache_.rlock();
+  return {numHits_, numMisses_, cache->numNonPinnedEntries(),
+          cache->nonPinnedSize(),
+          ad_utility::MemorySize::bytes(maxSizeInBytes_)};
+}
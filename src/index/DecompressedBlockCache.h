@@ -0,0 +1,100 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#ifndef QLEVER_SRC_INDEX_DECOMPRESSEDBLOCKCACHE_H
+#define QLEVER_SRC_INDEX_DECOMPRESSEDBLOCKCACHE_H
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "backports/span.h"
+#include "global/Id.h"
+#include "util/Cache.h"
+#include "util/MemorySize/MemorySize.h"
+#include "util/Synchronized.h"
+
+// A bounded, thread-safe LRU cache for the decompressed columns of the blocks
+// of index permutations. It is shared between all queries (and all
+// `CompressedRelationReader`s), s.t. the blocks of hot predicates are only
+// read and decompressed once instead of once per query.
+//
+// The cache stores single columns exactly as they are stored on disk, that is,
+// BEFORE the located triples (updates) are merged and before any graph
+// filtering. This makes the entries independent of the current version of the
+// `DeltaTriples`, so they never have to be invalidated because of an update,
+// and a column can be reused by scans that request different sets of columns.
+//
+// The cache has its own memory budget (its maximum size), which is independent
+// of the memory limit for queries. In particular, cached columns are NOT
+// allocated using the allocator of the query that inserted them, as their
+// memory would otherwise remain charged to the queries after that query has
+// finished.
+class DecompressedBlockCache {
+ public:
+  using Column = std::vector<Id>;
+  using ColumnPtr = std::shared_ptr<const Column>;
+  // A column is identified by the unique ID of the reader (see
+  // `getUniqueReaderId` below) and its offset in the file of that reader.
+  using Key = std::pair<uint64_t, off_t>;
+
+  // Statistics that are reported by the server together with the statistics
+  // of the query cache.
+  struct Statistics {
+    uint64_t numHits_ = 0;
+    uint64_t numMisses_ = 0;
+    size_t numEntries_ = 0;
+    ad_utility::MemorySize size_ = ad_utility::MemorySize::bytes(0);
+    ad_utility::MemorySize maxSize_ = ad_utility::MemorySize::bytes(0);
+  };
+
+ private:
+  // The size of a cached column is the size of its payload.
+  struct ColumnSizeGetter {
+    ad_utility::MemorySize operator()(const Column& column) const {
+      return ad_utility::MemorySize::bytes(column.size() * sizeof(Id));
+    }
+  };
+  using Cache = ad_utility::HeapBasedLRUCache<Key, Column, ColumnSizeGetter>;
+
+  ad_utility::Synchronized<Cache> cache_;
+  // The maximum size in bytes is stored separately, s.t. the lock doesn't have
+  // to be acquired when the cache is disabled (`maxSize == 0`).
+  std::atomic<size_t> maxSizeInBytes_;
+  std::atomic<uint64_t> numHits_ = 0;
+  std::atomic<uint64_t> numMisses_ = 0;
+
+ public:
+  // Create a cache with the given maximum size. A size of zero disables the
+  // cache.
+  explicit DecompressedBlockCache(ad_utility::MemorySize maxSize);
+
+  // The single instance that is shared by all readers. Its initial size is
+  // determined by the runtime parameter
+  // `decompressed-block-cache-max-size`.
+  static DecompressedBlockCache& global();
+
+  // Return a unique ID for a newly opened permutation file. The IDs are never
+  // reused, so entries of files that have been closed (or overwritten) can
+  // never be returned by mistake, but are eventually evicted.
+  static uint64_t getUniqueReaderId();
+
+  // Return the column for the `key` or `nullptr` if it is not contained in the
+  // cache. Update the hit and miss counters accordingly.
+  ColumnPtr get(const Key& key);
+
+  // Insert a copy of the `column` for the `key`. Do nothing if the cache is
+  // disabled, if the key is already contained, or if the column is too large.
+  void insert(const Key& key, ql::span<const Id> column);
+
+  // Change the maximum size. A size of zero disables the cache and removes all
+  // entries.
+  void setMaxSize(ad_utility::MemorySize maxSize);
+
+  // Remove all entries from the cache and reset the statistics.
+  void clear();
+
+  Statistics getStatistics() const;
+};
+
+#endif  // QLEVER_SRC_INDEX_DECOMPRESSEDBLOCKCACHE_H
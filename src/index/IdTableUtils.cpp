@@ -14,14 +14,24 @@ void IdTableUtils::sort(IdTable& idTable,
                         const std::vector<ColumnIndex>& sortCols) {
   size_t width = idTable.numColumns();
 
+  // Only `Id`s from a local vocabulary are not ordered by their bits.
+  auto columnIsOrderedByBits = [&idTable](ColumnIndex col) {
+    return ql::ranges::none_of(idTable.getColumn(col), [](Id id) {
+      return id.getDatatype() == Datatype::LocalVocabIndex;
+    });
+  };
+  if (idTable.numRows() >= minNumRowsForRadixSort &&
+      ql::ranges::all_of(sortCols, columnIsOrderedByBits)) {
+    radixSort(idTable, sortCols, [](Id id, size_t) { return id.getBits(); });
+    return;
+  }
+
   // Instantiate specialized comparison lambdas for one and two sort columns
   // and use a generic comparison for a higher number of sort columns.
   // TODO<joka921> As soon as we have merged the benchmark, measure whether
   // this is in fact beneficial and whether it should also be applied for a
   // higher number of columns, maybe even using `CALL_FIXED_SIZE` for the
   // number of sort columns.
-  // TODO<joka921> Also experiment with sorting algorithms that take the
-  // column-based structure of the `IdTable` into account.
   if (sortCols.size() == 1) {
     ad_utility::callFixedSizeVi(width, [&idTable, col = sortCols[0]](auto I) {
       IdTableUtils::sort<I>(&idTable, col);
@@ -55,6 +65,25 @@ void IdTableUtils::sort(IdTable& idTable,
   }
 }
 
+// _____________________________________________________________________________
+void IdTableUtils::permuteRows(IdTable& idTable,
+                               const ad_utility::KeysAndRows& permutation,
+                               size_t numThreads) {
+  AD_CORRECTNESS_CHECK(permutation.size() == idTable.numRows());
+  std::vector<Id, ad_utility::AllocatorWithLimit<Id>> buffer(
+      idTable.numRows(), idTable.getAllocator());
+  for (auto column : idTable.getColumns()) {
+    ad_utility::forEachRangeInParallel(
+        idTable.numRows(), numThreads,
+        [&buffer, &column, &permutation](size_t begin, size_t end) {
+          for (size_t i = begin; i < end; ++i) {
+            buffer[i] = column[permutation[i].row_];
+          }
+        });
+    ql::ranges::copy(buffer, column.begin());
+  }
+}
+
 // ___________________________________________________________________________
 size_t IdTableUtils::countDistinct(
     const IdTable& input, const std::function<void()>& checkCancellation) {
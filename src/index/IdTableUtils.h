@@ -10,10 +10,16 @@
 #include "backports/type_traits.h"
 #include "engine/idTable/IdTable.h"
 #include "global/Constants.h"
+#include "global/RuntimeParameters.h"
 #include "util/Log.h"
+#include "util/RadixSort.h"
 
 class IdTableUtils {
  public:
+  // Tables with fewer rows are sorted via comparisons also if a radix sort
+  // would be possible.
+  static constexpr size_t minNumRowsForRadixSort = 1'000;
+
   template <size_t WIDTH>
   static void sort(IdTable* tab, const size_t keyColumn) {
     AD_LOG_DEBUG << "Sorting " << tab->size() << " elements ..." << std::endl;
@@ -24,7 +30,7 @@ class IdTableUtils {
           [keyColumn](const auto& a, const auto& b) {
             return a[keyColumn] < b[keyColumn];
           },
-          ad_utility::parallel_tag(NUM_SORT_THREADS));
+          ad_utility::parallel_tag(numSortThreads()));
     } else {
       std::sort(stab.begin(), stab.end(),
                 [keyColumn](const auto& a, const auto& b) {
@@ -48,7 +54,7 @@ class IdTableUtils {
     IdTableStatic<WIDTH> stab = std::move(*tab).toStatic<WIDTH>();
     if constexpr (USE_PARALLEL_SORT) {
       ad_utility::parallel_sort(stab.begin(), stab.end(), comp,
-                                ad_utility::parallel_tag(NUM_SORT_THREADS));
+                                ad_utility::parallel_tag(numSortThreads()));
     } else {
       std::sort(stab.begin(), stab.end(), comp);
     }
@@ -56,14 +62,66 @@ class IdTableUtils {
     AD_LOG_DEBUG << "Sort done.\n";
   }
 
+  // Sort the `idTable` lexicographically by the `sortCols`. Columns that don't
+  // contain `Id`s from a local vocabulary are ordered by the bits of their
+  // `Id`s, so for those a `radixSort` is used.
   static void sort(IdTable& idTable, const std::vector<ColumnIndex>& sortCols);
 
+  // Sort the rows of the `idTable` lexicographically by the 64-bit keys of
+  // their values in the `sortCols`, where `getKey(id, i)` has to return the key
+  // of the value `id` in the `i`-th of the `sortCols`. Instead of comparing and
+  // swapping whole rows (the columns of which are scattered in memory), the
+  // keys are extracted column by column and sorted together with the indices
+  // of their rows by `ad_utility::radixSortByKey`, starting with the last of
+  // the `sortCols`. Then each column is permuted once. The sort is stable.
+  template <typename GetKey>
+  static void radixSort(IdTable& idTable,
+                        const std::vector<ColumnIndex>& sortCols,
+                        const GetKey& getKey) {
+    size_t numRows = idTable.numRows();
+    size_t numThreads = numSortThreads();
+    ad_utility::KeysAndRows keysAndRows(numRows, idTable.getAllocator());
+    ad_utility::forEachRangeInParallel(
+        numRows, numThreads, [&keysAndRows](size_t begin, size_t end) {
+          for (size_t i = begin; i < end; ++i) {
+            keysAndRows[i].row_ = i;
+          }
+        });
+    for (size_t i = sortCols.size(); i-- > 0;) {
+      ql::span<const Id> column = idTable.getColumn(sortCols[i]);
+      ad_utility::forEachRangeInParallel(
+          numRows, numThreads,
+          [&keysAndRows, &column, &getKey, i](size_t begin, size_t end) {
+            for (size_t j = begin; j < end; ++j) {
+              auto& keyAndRow = keysAndRows[j];
+              keyAndRow.key_ = getKey(column[keyAndRow.row_], i);
+            }
+          });
+      ad_utility::radixSortByKey(keysAndRows, numThreads);
+    }
+    permuteRows(idTable, keysAndRows, numThreads);
+  }
+
   // Return the number of distinct rows in the `input`. The input must have all
   // duplicates adjacent to each other (e.g. by being sorted), otherwise the
   // behavior is undefined. `checkCancellation()` is invoked regularly and can
   // be used to implement a cancellation mechanism that throws on cancellation.
   static size_t countDistinct(const IdTable& input,
                               const std::function<void()>& checkCancellation);
+
+ private:
+  // The number of threads for a single sort, see `sortNumThreads_`.
+  static size_t numSortThreads() {
+    return std::max(
+        size_t{1},
+        getRuntimeParameter<&RuntimeParameters::sortNumThreads_>());
+  }
+
+  // Reorder the rows of the `idTable` s.t. the `i`-th row of the result is the
+  // `permutation[i].row_`-th row of the input.
+  static void permuteRows(IdTable& idTable,
+                          const ad_utility::KeysAndRows& permutation,
+                          size_t numThreads);
 };
 
 #endif  // QLEVER_SRC_INDEX_IDTABLEUTILS_H
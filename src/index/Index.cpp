@@ -180,6 +180,11 @@ ad_utility::MemorySize& Index::blocksizePermutationsPerColumn() {
   return pimpl_->blocksizePermutationPerColumn();
 }
 
+// ____________________________________________________________________________
+std::optional<double>& Index::col1BloomFilterFalsePositiveRate() {
+  return pimpl_->col1BloomFilterFalsePositiveRate();
+}
+
 // ____________________________________________________________________________
 void Index::setOnDiskBase(const std::string& onDiskBase) {
   return pimpl_->setOnDiskBase(onDiskBase);
@@ -282,6 +287,17 @@ void Index::createFromFiles(const std::vector<InputFileSpecification>& files) {
   return pimpl_->createFromFiles(files);
 }
 
+// ____________________________________________________________________________
+void Index::createShardFromFiles(
+    const std::vector<InputFileSpecification>& files, size_t shardIndex) {
+  return pimpl_->createShardFromFiles(files, shardIndex);
+}
+
+// ____________________________________________________________________________
+void Index::createFromShards(const std::vector<std::string>& shardBasenames) {
+  return pimpl_->createFromShards(shardBasenames);
+}
+
 // ____________________________________________________________________________
 const DeltaTriplesManager& Index::deltaTriplesManager() const {
   return pimpl_->deltaTriplesManager();
@@ -94,6 +94,12 @@ class Index {
   // setup by `createFromOnDiskIndex` after this call.
   void createFromFiles(const std::vector<InputFileSpecification>& files);
 
+  // Sharded index building, see `IndexImpl::createShardFromFiles` and
+  // `IndexImpl::createFromShards`.
+  void createShardFromFiles(const std::vector<InputFileSpecification>& files,
+                            size_t shardIndex);
+  void createFromShards(const std::vector<std::string>& shardBasenames);
+
   // Create an index object from an on-disk index that has previously been
   // constructed using the `createFromFile` method which is typically called via
   // `IndexBuilderMain`. Read necessary metadata into memory and open file
@@ -203,6 +209,8 @@ class Index {
 
   ad_utility::MemorySize& blocksizePermutationsPerColumn();
 
+  std::optional<double>& col1BloomFilterFalsePositiveRate();
+
   void setOnDiskBase(const std::string& onDiskBase);
 
   void setSettingsFile(const std::string& filename);
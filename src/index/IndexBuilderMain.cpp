@@ -192,6 +192,7 @@ int main(int argc, char** argv) {
   std::vector<string> defaultGraphs;
   std::vector<bool> parseParallel;
   std::string materializedViewsJson;
+  size_t shardIndex = 0;
 
   boost::program_options::options_description boostOptions(
       "Options for qlever-index");
@@ -287,6 +288,12 @@ int main(int argc, char** argv) {
       "large enough to hold a single input triple. Default: 10 MB.");
   add("keep-temporary-files,k", po::bool_switch(&config.keepTemporaryFiles_),
       "Do not delete temporary files from index creation for debugging.");
+  add("shard-index", po::value(&shardIndex),
+      "Only build the shard with this index of a sharded index build, which "
+      "consists of the partial vocabularies and the triples of the input "
+      "files. The shards of an index must have pairwise different indices and "
+      "disjoint input files. Use `IndexShardMergerMain` with the same "
+      "settings to build the final index from all the shards.");
   add("materialized-views", po::value(&materializedViewsJson),
       "create materialized views after index building. Takes a JSON object "
       "mapping view names to SELECT queries for writing the view, for example: "
@@ -321,6 +328,9 @@ int main(int argc, char** argv) {
   try {
     config.inputFiles_ = getFileSpecifications(filetype, inputFile,
                                                defaultGraphs, parseParallel);
+    if (optionsMap.count("shard-index")) {
+      config.shardIndex_ = shardIndex;
+    }
     config.writeMaterializedViews_ =
         parseMaterializedViewsJson(materializedViewsJson);
     config.validate();
@@ -5,10 +5,12 @@
 
 #include "index/IndexImpl.h"
 
+#include <absl/cleanup/cleanup.h>
 #include <absl/strings/str_join.h>
 
 #include <atomic>
 #include <cstdio>
+#include <filesystem>
 #include <future>
 #include <numeric>
 #include <optional>
@@ -31,6 +33,9 @@
 #include "util/JoinAlgorithms/JoinAlgorithms.h"
 #include "util/ParallelExecutor.h"
 #include "util/ProgressBar.h"
+#include "util/Serializer/FileSerializer.h"
+#include "util/Serializer/SerializeString.h"
+#include "util/Serializer/SerializeVector.h"
 #include "util/ThreadSafeQueue.h"
 #include "util/Timer.h"
 #include "util/TypeTraits.h"
@@ -45,6 +50,11 @@ using namespace ad_utility::memory_literals;
 // sorter.
 static constexpr size_t NUM_EXTERNAL_SORTERS_AT_SAME_TIME = 2u;
 
+// The number of `Id`s that are buffered when the triples of a shard of a
+// sharded index build are written to or read from disk.
+static constexpr size_t BUFFER_SIZE_SHARD_TRIPLES = 1'000'000;
+static_assert(BUFFER_SIZE_SHARD_TRIPLES % NumColumnsIndexBuilding == 0);
+
 // The name of this JSON property no longer holds up as soon as blank nodes are
 // added or removed via updates. For backwards compatibility we keep the name.
 constexpr std::string_view BLANK_NODE_ALLOCATION_START =
@@ -58,9 +68,8 @@ IndexImpl::IndexImpl(ad_utility::AllocatorWithLimit<Id> allocator)
 
 // _____________________________________________________________________________
 IndexBuilderDataAsFirstPermutationSorter IndexImpl::createIdTriplesAndVocab(
-    std::shared_ptr<RdfParserBase> parser) {
-  auto indexBuilderData =
-      passFileForVocabulary(std::move(parser), numTriplesPerBatch_);
+    BuildPartialVocabulariesResult parsedTriples) {
+  auto indexBuilderData = passFileForVocabulary(std::move(parsedTriples));
 
   auto isQleverInternalTriple = [&indexBuilderData](const auto& triple) {
     auto internal = [&indexBuilderData](Id id) {
@@ -374,8 +383,7 @@ void IndexImpl::updateInputFileSpecificationsAndLog(
 }
 
 // _____________________________________________________________________________
-void IndexImpl::createFromFiles(
-    std::vector<Index::InputFileSpecification> files) {
+void IndexImpl::initializeIndexBuilding() {
   if (!loadAllPermutations_ && usePatterns_) {
     throw std::runtime_error{
         "The patterns can only be built when all 6 permutations are created"};
@@ -386,11 +394,211 @@ void IndexImpl::createFromFiles(
   vocab_.resetToType(vocabularyTypeForIndexBuilding_);
 
   readIndexBuilderSettingsFromFile();
+}
+
+// _____________________________________________________________________________
+void IndexImpl::createFromFiles(
+    std::vector<Index::InputFileSpecification> files) {
+  initializeIndexBuilding();
+  updateInputFileSpecificationsAndLog(files, useParallelParser_);
+  createPermutationsAndWriteConfiguration(createIdTriplesAndVocab(
+      buildPartialVocabularies(makeRdfParser(files), numTriplesPerBatch_)));
+}
 
+// _____________________________________________________________________________
+void IndexImpl::createShardFromFiles(
+    std::vector<Index::InputFileSpecification> files, size_t shardIndex) {
+  initializeIndexBuilding();
   updateInputFileSpecificationsAndLog(files, useParallelParser_);
-  IndexBuilderDataAsFirstPermutationSorter indexBuilderData =
-      createIdTriplesAndVocab(makeRdfParser(files));
+  shardIndexDuringIndexBuilding_ = shardIndex;
+  absl::Cleanup resetShardIndex{
+      [this]() { shardIndexDuringIndexBuilding_ = std::nullopt; }};
+  auto parsedTriples =
+      buildPartialVocabularies(makeRdfParser(files), numTriplesPerBatch_);
+  writeShardTriples(parsedTriples,
+                    absl::StrCat(onDiskBase_, SHARD_TRIPLES_SUFFIX),
+                    shardIndex);
+  AD_LOG_INFO << "Shard " << shardIndex << " of the index build completed"
+              << std::endl;
+}
+
+// _____________________________________________________________________________
+void IndexImpl::createFromShards(
+    const std::vector<std::string>& shardBasenames) {
+  initializeIndexBuilding();
+  createPermutationsAndWriteConfiguration(
+      createIdTriplesAndVocab(readShards(shardBasenames)));
+}
+
+// _____________________________________________________________________________
+nlohmann::json IndexImpl::getShardSettings() const {
+  nlohmann::json settings;
+  for (const std::string key : {"locale", "prefixes-external",
+                                "languages-internal", "encoded-iri-prefixes"}) {
+    if (configurationJson_.contains(key)) {
+      settings[key] = configurationJson_[key];
+    }
+  }
+  settings["vocabulary-type"] = vocabularyTypeForIndexBuilding_;
+  settings["parser-integer-overflow-behavior"] =
+      static_cast<int>(turtleParserIntegerOverflowBehavior_);
+  return settings;
+}
+
+// _____________________________________________________________________________
+void IndexImpl::writeShardTriples(BuildPartialVocabulariesResult& parsedTriples,
+                                  const std::string& filename,
+                                  size_t shardIndex) const {
+  AD_LOG_INFO << "Writing the triples of the shard to " << filename << " ..."
+              << std::endl;
+  ad_utility::serialization::FileWriteSerializer serializer{filename};
+  serializer << SHARD_TRIPLES_MAGIC_NUMBER;
+  serializer << SHARD_TRIPLES_FORMAT_VERSION;
+  serializer << getShardSettings().dump();
+  serializer << static_cast<uint64_t>(shardIndex);
+  serializer << parsedTriples.numTriplesPerPartialVocab_;
+  uint64_t numTriples = parsedTriples.idTriples_->size();
+  serializer << numTriples;
+  // Write the `Id`s in blocks, calling `serializeBytes` for each single `Id`
+  // is much slower.
+  std::vector<Id::T> buffer;
+  auto flush = [&serializer, &buffer]() {
+    serializer.serializeBytes(reinterpret_cast<const char*>(buffer.data()),
+                              buffer.size() * sizeof(Id::T));
+    buffer.clear();
+  };
+  for (const auto& triple : parsedTriples.idTriples_->getRows()) {
+    for (Id id : triple) {
+      buffer.push_back(id.getBits());
+    }
+    if (buffer.size() >= BUFFER_SIZE_SHARD_TRIPLES) {
+      flush();
+    }
+  }
+  flush();
+}
+
+// _____________________________________________________________________________
+BuildPartialVocabulariesResult IndexImpl::readShards(
+    const std::vector<std::string>& shardBasenames) {
+  AD_CONTRACT_CHECK(!shardBasenames.empty(),
+                    "At least one shard is required to build an index");
+
+  using ad_utility::serialization::FileReadSerializer;
+  // Read the header of the given shard, check that its format version and
+  // settings match this index build, and return its shard index.
+  auto settings = getShardSettings();
+  auto readHeader = [&settings](FileReadSerializer& serializer,
+                                const std::string& shard) {
+    uint64_t magicNumber = 0;
+    uint64_t formatVersion = 0;
+    serializer >> magicNumber;
+    serializer >> formatVersion;
+    if (magicNumber != SHARD_TRIPLES_MAGIC_NUMBER ||
+        formatVersion != SHARD_TRIPLES_FORMAT_VERSION) {
+      throw std::runtime_error{absl::StrCat(
+          "The file ", shard, SHARD_TRIPLES_SUFFIX,
+          " is not a shard of an index build with format version ",
+          SHARD_TRIPLES_FORMAT_VERSION, ", please rebuild the shard")};
+    }
+    std::string settingsOfShard;
+    serializer >> settingsOfShard;
+    if (nlohmann::json::parse(settingsOfShard) != settings) {
+      throw std::runtime_error{absl::StrCat(
+          "The shard ", shard,
+          " was built with settings that differ from the settings of this "
+          "index build. Settings of the shard: ",
+          settingsOfShard,
+          ", settings of this index build: ", settings.dump())};
+    }
+    uint64_t shardIndex = 0;
+    serializer >> shardIndex;
+    return shardIndex;
+  };
 
+  // Check all the headers before anything is copied. Shards with the same
+  // shard index would have the same labels for different blank nodes.
+  ad_utility::HashMap<uint64_t, std::string> shardIndices;
+  for (const auto& shard : shardBasenames) {
+    FileReadSerializer serializer{absl::StrCat(shard, SHARD_TRIPLES_SUFFIX)};
+    auto [it, isNew] =
+        shardIndices.emplace(readHeader(serializer, shard), shard);
+    if (!isNew) {
+      throw std::runtime_error{absl::StrCat(
+          "The shards ", it->second, " and ", shard,
+          " have the same shard index ", it->first,
+          ", but the shard indices of an index build must be different")};
+    }
+  }
+
+  auto idTriples = std::make_unique<TripleVec>(
+      onDiskBase_ + ".unsorted-triples.dat", 2_MB * NumColumnsIndexBuilding,
+      allocator_);
+  std::vector<size_t> numTriplesPerPartialVocab;
+  for (const auto& shard : shardBasenames) {
+    AD_LOG_INFO << "Reading the partial vocabularies and triples of shard "
+                << shard << " ..." << std::endl;
+    FileReadSerializer serializer{absl::StrCat(shard, SHARD_TRIPLES_SUFFIX)};
+    readHeader(serializer, shard);
+    std::vector<size_t> numTriplesPerPartialVocabOfShard;
+    serializer >> numTriplesPerPartialVocabOfShard;
+    uint64_t numTriples = 0;
+    serializer >> numTriples;
+    AD_CORRECTNESS_CHECK(
+        numTriples == std::accumulate(numTriplesPerPartialVocabOfShard.begin(),
+                                      numTriplesPerPartialVocabOfShard.end(),
+                                      size_t{0}));
+
+    // The local IDs in the triples refer to the partial vocabularies of the
+    // shard, so the partial vocabularies and triples of all shards can simply
+    // be concatenated.
+    // The samples of the partial vocabularies are copied as well (they are
+    // needed to merge the vocabulary in parallel ranges). A stale samples file
+    // from an earlier build would refer to different words, so it is deleted
+    // if the shard has no samples.
+    for (size_t n = 0; n < numTriplesPerPartialVocabOfShard.size(); ++n) {
+      auto source = absl::StrCat(shard, PARTIAL_VOCAB_WORDS_INFIX, n);
+      auto target = absl::StrCat(onDiskBase_, PARTIAL_VOCAB_WORDS_INFIX,
+                                 numTriplesPerPartialVocab.size() + n);
+      std::filesystem::copy_file(
+          source, target, std::filesystem::copy_options::overwrite_existing);
+      auto sourceSamples = absl::StrCat(source, PARTIAL_VOCAB_SAMPLES_SUFFIX);
+      auto targetSamples = absl::StrCat(target, PARTIAL_VOCAB_SAMPLES_SUFFIX);
+      if (std::filesystem::exists(sourceSamples)) {
+        std::filesystem::copy_file(
+            sourceSamples, targetSamples,
+            std::filesystem::copy_options::overwrite_existing);
+      } else {
+        std::filesystem::remove(targetSamples);
+      }
+    }
+    ql::ranges::copy(numTriplesPerPartialVocabOfShard,
+                     std::back_inserter(numTriplesPerPartialVocab));
+
+    std::vector<Id::T> buffer;
+    size_t numIdsRemaining = numTriples * NumColumnsIndexBuilding;
+    while (numIdsRemaining > 0) {
+      buffer.resize(std::min(numIdsRemaining, BUFFER_SIZE_SHARD_TRIPLES));
+      serializer.serializeBytes(reinterpret_cast<char*>(buffer.data()),
+                                buffer.size() * sizeof(Id::T));
+      numIdsRemaining -= buffer.size();
+      for (size_t i = 0; i < buffer.size(); i += NumColumnsIndexBuilding) {
+        std::array<Id, NumColumnsIndexBuilding> triple;
+        for (size_t k = 0; k < NumColumnsIndexBuilding; ++k) {
+          triple[k] = Id::fromBits(buffer[i + k]);
+        }
+        idTriples->push(triple);
+      }
+    }
+  }
+  AD_LOG_INFO << "Number of partial vocabularies of all shards: "
+              << numTriplesPerPartialVocab.size() << std::endl;
+  return {std::move(numTriplesPerPartialVocab), std::move(idTriples)};
+}
+
+// _____________________________________________________________________________
+void IndexImpl::createPermutationsAndWriteConfiguration(
+    IndexBuilderDataAsFirstPermutationSorter indexBuilderData) {
   // Write the configuration already at this point, so we have it available in
   // case any of the permutations fail.
   writeConfiguration();
@@ -422,20 +630,21 @@ void IndexImpl::createFromFiles(
     configurationJson_["has-all-permutations"] = false;
   } else if (!usePatterns_) {
     createInternalPsoAndPosAndSetMetadata();
-    // Without patterns, we explicitly have to pass in the next sorters to all
-    // permutation creating functions.
-    auto secondSorter = makeSorter<SecondPermutation>("second");
+    // Without patterns, the second and third pair of permutations only depend
+    // on the triples. We therefore push the sorted output of the first sorter
+    // to the sorters of both pairs, and then create the two pairs
+    // concurrently. While the first sorter is merged, three sorters are in use
+    // at the same time, so the two additional sorters only get half of the
+    // usual amount of memory.
+    auto secondSorter = makeSorter<SecondPermutation>(
+        "second", 2 * NUM_EXTERNAL_SORTERS_AT_SAME_TIME);
+    auto thirdSorter = makeSorter<ThirdPermutation>(
+        "third", 2 * NUM_EXTERNAL_SORTERS_AT_SAME_TIME);
     createFirstPermutationPair(NumColumnsIndexBuilding,
-                               std::move(firstSorterWithUnique), secondSorter);
+                               std::move(firstSorterWithUnique), secondSorter,
+                               thirdSorter);
     firstSorter.clearUnderlying();
-
-    auto thirdSorter = makeSorter<ThirdPermutation>("third");
-    createSecondPermutationPair(NumColumnsIndexBuilding,
-                                secondSorter.getSortedBlocks<0>(), thirdSorter);
-    secondSorter.clear();
-    createThirdPermutationPair(NumColumnsIndexBuilding,
-                               thirdSorter.getSortedBlocks<0>());
-    configurationJson_["has-all-permutations"] = true;
+    createSecondAndThirdPermutationPairConcurrently(secondSorter, thirdSorter);
   } else {
     // Load all permutations and also load the patterns. In this case the
     // `createFirstPermutationPair` function returns the next sorter, already
@@ -610,8 +819,7 @@ BuildPartialVocabulariesResult IndexImpl::buildPartialVocabularies(
 
 // _____________________________________________________________________________
 IndexBuilderDataAsExternalVector IndexImpl::passFileForVocabulary(
-    std::shared_ptr<RdfParserBase> parser, size_t linesPerPartial) {
-  auto parsedTriples = buildPartialVocabularies(parser, linesPerPartial);
+    BuildPartialVocabulariesResult parsedTriples) {
   const auto numPartialVocabs = parsedTriples.numTriplesPerPartialVocab_.size();
 
   size_t sizeInternalVocabulary = 0;
@@ -645,9 +853,11 @@ IndexBuilderDataAsExternalVector IndexImpl::passFileForVocabulary(
   for (size_t n = 0; n < numPartialVocabs; ++n) {
     deleteTemporaryFile(
         absl::StrCat(onDiskBase_, PARTIAL_VOCAB_WORDS_INFIX, n));
+    deleteTemporaryFile(absl::StrCat(onDiskBase_, PARTIAL_VOCAB_WORDS_INFIX, n,
+                                     PARTIAL_VOCAB_SAMPLES_SUFFIX));
   }
 
-  AD_LOG_DEBUG << "Triples per partial vocabulary: " << linesPerPartial
+  AD_LOG_DEBUG << "Triples per partial vocabulary: " << numTriplesPerBatch_
                << std::endl;
 
   return {std::move(mergeRes), std::move(parsedTriples)};
@@ -856,7 +1066,7 @@ CompressedRelationWriter::WriterAndCallback IndexImpl::getWriterAndCallback(
 
   auto writer = std::make_unique<CompressedRelationWriter>(
       numColumns, ad_utility::File(fileName, "w"),
-      blocksizePermutationPerColumn_);
+      blocksizePermutationPerColumn_, col1BloomFilterFalsePositiveRate_);
 
   auto callback =
       liftCallback([&metaData](const auto& md) { metaData.add(md); });
@@ -1312,6 +1522,10 @@ void IndexImpl::readConfiguration() {
                  EncodedIriManager{});
   loadDataMember("graphNameManager", graphNameManager_,
                  GraphNameManager(std::string(QLEVER_NEW_GRAPH_PREFIX), 1));
+  if (auto it = configurationJson_.find("bloom-filter-false-positive-rate");
+      it != configurationJson_.end()) {
+    col1BloomFilterFalsePositiveRate_ = static_cast<double>(*it);
+  }
 
   // Compute unique ID for this index.
   //
@@ -1352,6 +1566,14 @@ ProcessedTriple IndexImpl::processTriple(TurtleTriple&& triple) const {
     // If the object of the triple can be directly folded into an ID, do so.
     // Note that the actual folding is done by the `TripleComponent`.
     auto& el = std::invoke(getter, triple);
+    // Blank nodes from different shards must be different (the parser only
+    // makes them unique within a single process).
+    if (shardIndexDuringIndexBuilding_.has_value() && el.isString() &&
+        ql::starts_with(el.getString(), "_:")) {
+      el = TripleComponent{absl::StrCat(
+          "_:s", shardIndexDuringIndexBuilding_.value(), "_",
+          std::string_view{el.getString()}.substr(2))};
+    }
     std::optional<Id> idIfNotString =
         el.toValueIdIfNotString(&encodedIriManager());
 
@@ -1475,6 +1697,20 @@ void IndexImpl::readIndexBuilderSettingsFromFile() {
         << std::endl;
   }
 
+  if (j.count("bloom-filter-false-positive-rate")) {
+    auto rate = static_cast<double>(j["bloom-filter-false-positive-rate"]);
+    if (!(rate > 0.0 && rate < 1.0)) {
+      throw std::runtime_error(
+          "The value of \"bloom-filter-false-positive-rate\" in the settings "
+          "JSON must be strictly between 0 and 1");
+    }
+    col1BloomFilterFalsePositiveRate_ = rate;
+    configurationJson_["bloom-filter-false-positive-rate"] = rate;
+    AD_LOG_INFO << "The blocks of the permutations will have Bloom filters "
+                   "for their second column with a false-positive rate of "
+                << rate << std::endl;
+  }
+
   if (j.count("parser-batch-size")) {
     parserBatchSize_ = size_t{j["parser-batch-size"]};
     AD_LOG_INFO << "Overriding setting parser-batch-size to "
@@ -1819,7 +2055,7 @@ CPP_template_def(typename... NextSorter)(
 }
 
 // _____________________________________________________________________________
-CPP_template_def(typename... NextSorter)(requires(sizeof...(NextSorter) <= 1))
+CPP_template_def(typename... NextSorter)(requires(sizeof...(NextSorter) <= 2))
     std::optional<PatternCreator::TripleSorter> IndexImpl::createSPOAndSOP(
         size_t numColumns, BlocksOfTriples sortedTriples,
         NextSorter&&... nextSorter) {
@@ -1849,7 +2085,7 @@ CPP_template_def(typename... NextSorter)(requires(sizeof...(NextSorter) <= 1))
     writeConfiguration();
     result = std::move(patternCreator).getTripleSorter();
   } else {
-    AD_CORRECTNESS_CHECK(sizeof...(nextSorter) == 1);
+    AD_CORRECTNESS_CHECK(sizeof...(nextSorter) >= 1);
     size_t numSubjects =
         createPermutationPair(numColumns, AD_FWD(sortedTriples), *spo_, *sop_,
                               nextSorter.makePushCallback()...);
@@ -1877,9 +2113,35 @@ CPP_template_def(typename... NextSorter)(
   writeConfiguration();
 }
 
+// _____________________________________________________________________________
+template <typename SecondSorter, typename ThirdSorter>
+void IndexImpl::createSecondAndThirdPermutationPairConcurrently(
+    SecondSorter& secondSorter, ThirdSorter& thirdSorter) {
+  static_assert(std::is_same_v<SecondPermutation, SortByOSP>);
+  // The OSP and OPS permutations are written by a separate thread, which
+  // doesn't touch the `configurationJson_`. The number of objects is stored
+  // in the configuration by this thread after the other one has finished.
+  auto numObjectsFuture =
+      std::async(std::launch::async, [this, &secondSorter]() {
+        size_t numObjects = createPermutationPair(
+            NumColumnsIndexBuilding,
+            secondSorter.template getSortedBlocks<0>(), *osp_, *ops_);
+        secondSorter.clear();
+        return numObjects;
+      });
+  createThirdPermutationPair(NumColumnsIndexBuilding,
+                             thirdSorter.template getSortedBlocks<0>());
+  configurationJson_["num-objects"] =
+      NumNormalAndInternal::fromNormal(numObjectsFuture.get());
+  configurationJson_["has-all-permutations"] = true;
+  writeConfiguration();
+}
+
 // _____________________________________________________________________________
 template <typename Comparator, size_t I, bool returnPtr>
-auto IndexImpl::makeSorterImpl(std::string_view permutationName) const {
+auto IndexImpl::makeSorterImpl(
+    std::string_view permutationName,
+    std::optional<size_t> numSortersAtSameTime) const {
   using Sorter = ExternalSorter<Comparator, I>;
   auto apply = [](auto&&... args) {
     if constexpr (returnPtr) {
@@ -1889,21 +2151,27 @@ auto IndexImpl::makeSorterImpl(std::string_view permutationName) const {
     }
   };
   return apply(absl::StrCat(onDiskBase_, ".", permutationName, "-sorter.dat"),
-               memoryLimitIndexBuilding() / NUM_EXTERNAL_SORTERS_AT_SAME_TIME,
+               memoryLimitIndexBuilding() /
+                   numSortersAtSameTime.value_or(
+                       NUM_EXTERNAL_SORTERS_AT_SAME_TIME),
                allocator_);
 }
 
 // _____________________________________________________________________________
 template <typename Comparator, size_t I>
 ExternalSorter<Comparator, I> IndexImpl::makeSorter(
-    std::string_view permutationName) const {
-  return makeSorterImpl<Comparator, I, false>(permutationName);
+    std::string_view permutationName,
+    std::optional<size_t> numSortersAtSameTime) const {
+  return makeSorterImpl<Comparator, I, false>(permutationName,
+                                              numSortersAtSameTime);
 }
 // _____________________________________________________________________________
 template <typename Comparator, size_t I>
 std::unique_ptr<ExternalSorter<Comparator, I>> IndexImpl::makeSorterPtr(
-    std::string_view permutationName) const {
-  return makeSorterImpl<Comparator, I, true>(permutationName);
+    std::string_view permutationName,
+    std::optional<size_t> numSortersAtSameTime) const {
+  return makeSorterImpl<Comparator, I, true>(permutationName,
+                                             numSortersAtSameTime);
 }
 
 // _____________________________________________________________________________
@@ -1941,6 +2209,11 @@ void IndexImpl::loadConfigFromOldIndex(const std::string& newName,
   setKbName(other.getKbName());
   blocksizePermutationPerColumn() = other.blocksizePermutationPerColumn();
   configurationJson_ = newStats;
+  col1BloomFilterFalsePositiveRate() = other.col1BloomFilterFalsePositiveRate();
+  if (col1BloomFilterFalsePositiveRate().has_value()) {
+    configurationJson_["bloom-filter-false-positive-rate"] =
+        col1BloomFilterFalsePositiveRate().value();
+  }
   numTriples_ = static_cast<NumNormalAndInternal>(newStats.at("num-triples"));
   numPredicates_ =
       static_cast<NumNormalAndInternal>(newStats.at("num-predicates"));
@@ -2027,11 +2300,19 @@ nlohmann::json IndexImpl::recomputeStatistics(
     tasks.push_back(getCounterTask(numObjects, *osp_, ad_utility::noop));
   }
   ad_utility::runTasksInParallel(std::move(tasks));
+  return configurationWithStatistics(
+      NumNormalAndInternal{numTriples, numTriplesInternal},
+      NumNormalAndInternal{numPredicates, numPredicatesInternal}, numSubjects,
+      numObjects);
+}
+
+// _____________________________________________________________________________
+nlohmann::json IndexImpl::configurationWithStatistics(
+    NumNormalAndInternal numTriples, NumNormalAndInternal numPredicates,
+    size_t numSubjects, size_t numObjects) const {
   auto configuration = configurationJson_;
-  configuration["num-triples"] =
-      NumNormalAndInternal{numTriples, numTriplesInternal};
-  configuration["num-predicates"] =
-      NumNormalAndInternal{numPredicates, numPredicatesInternal};
+  configuration["num-triples"] = numTriples;
+  configuration["num-predicates"] = numPredicates;
   if (hasAllPermutations()) {
     // These are unused.
     AD_CORRECTNESS_CHECK(numSubjects_.internal == 0);
@@ -117,6 +117,9 @@ class IndexImpl {
   ad_utility::MemorySize parserBufferSize_ = DEFAULT_PARSER_BUFFER_SIZE;
   ad_utility::MemorySize blocksizePermutationPerColumn_ =
       UNCOMPRESSED_BLOCKSIZE_COMPRESSED_METADATA_PER_COLUMN;
+  // If set, the blocks of the permutations get a Bloom filter for their second
+  // column with this false-positive rate.
+  std::optional<double> col1BloomFilterFalsePositiveRate_ = std::nullopt;
   nlohmann::json configurationJson_;
   Index::Vocab vocab_;
   Index::TextVocab textVocab_;
@@ -143,6 +146,11 @@ class IndexImpl {
   size_t parserBatchSize_ = PARSER_BATCH_SIZE;
   size_t numTriplesPerBatch_ = NUM_TRIPLES_PER_PARTIAL_VOCAB;
 
+  // Only set while a shard of a sharded index build is parsed (see
+  // `createShardFromFiles`), in which case it is added to the labels of all
+  // blank nodes.
+  std::optional<size_t> shardIndexDuringIndexBuilding_ = std::nullopt;
+
   NumNormalAndInternal numSubjects_;
   NumNormalAndInternal numPredicates_;
   NumNormalAndInternal numObjects_;
@@ -240,6 +248,22 @@ class IndexImpl {
   // by createFromOnDiskIndex after this call.
   void createFromFiles(std::vector<Index::InputFileSpecification> files);
 
+  // Sharded index building: Parse the given input files (which must be
+  // disjoint from the input files of all other shards) and only write the
+  // partial vocabularies and the triples with partial IDs to disk (using the
+  // `onDiskBase_` of this shard). The shards can be created independently of
+  // each other, e.g. in separate processes or on separate machines. The labels
+  // of blank nodes are made unique via the `shardIndex`, which therefore must
+  // be different for all shards of the same index.
+  void createShardFromFiles(std::vector<Index::InputFileSpecification> files,
+                            size_t shardIndex);
+
+  // Create the complete index (in the same way as `createFromFiles`) from the
+  // shards with the given basenames, which have previously been created via
+  // `createShardFromFiles` with the same settings (see `getShardSettings`,
+  // which is checked). The shard files are not modified.
+  void createFromShards(const std::vector<std::string>& shardBasenames);
+
   // Creates an index object from an on disk index that has previously been
   // constructed. Read necessary meta data into memory and opens file handles.
   void createFromOnDiskIndex(const std::string& onDiskBase,
@@ -462,6 +486,14 @@ class IndexImpl {
     return blocksizePermutationPerColumn_;
   }
 
+  std::optional<double>& col1BloomFilterFalsePositiveRate() {
+    return col1BloomFilterFalsePositiveRate_;
+  }
+
+  const std::optional<double>& col1BloomFilterFalsePositiveRate() const {
+    return col1BloomFilterFalsePositiveRate_;
+  }
+
   void setOnDiskBase(const std::string& onDiskBase);
 
   void setSettingsFile(const std::string& filename);
@@ -510,7 +542,7 @@ class IndexImpl {
   // needed for index creation once the TripleVec is set up and it would be a
   // waste of RAM.
   IndexBuilderDataAsFirstPermutationSorter createIdTriplesAndVocab(
-      std::shared_ptr<RdfParserBase> parser);
+      BuildPartialVocabulariesResult parsedTriples);
 
   // Parse all triples from `parser` in batches of `linesPerPartial`, write one
   // partial vocabulary file per batch, and return the accumulated ID triples
@@ -519,14 +551,42 @@ class IndexImpl {
   BuildPartialVocabulariesResult buildPartialVocabularies(
       std::shared_ptr<RdfParserBase> parser, size_t linesPerPartial);
 
-  // ___________________________________________________________________
+  // Merge the partial vocabularies that belong to the `parsedTriples` into the
+  // final vocabulary.
   IndexBuilderDataAsExternalVector passFileForVocabulary(
-      std::shared_ptr<RdfParserBase> parser, size_t linesPerPartial);
+      BuildPartialVocabulariesResult parsedTriples);
+
+  // The settings that determine the partial IDs or the order of the partial
+  // vocabularies of a shard, and therefore have to be the same for all the
+  // shards and the step that merges them.
+  nlohmann::json getShardSettings() const;
+
+  // Write the triples with partial IDs from `parsedTriples` together with the
+  // number of triples per partial vocabulary to `filename`. The file starts
+  // with a header that contains the format version, the `getShardSettings()`,
+  // and the `shardIndex`.
+  void writeShardTriples(BuildPartialVocabulariesResult& parsedTriples,
+                         const std::string& filename, size_t shardIndex) const;
+
+  // Copy the partial vocabularies of the shards with the given basenames to
+  // this index (numbered consecutively) and collect the triples of all shards,
+  // s.t. the result is the same as if a single `buildPartialVocabularies` had
+  // parsed the input of all the shards. Throw before anything is copied if
+  // the header of one of the shards has the wrong format version or different
+  // settings, or if two of the shards have the same shard index.
+  BuildPartialVocabulariesResult readShards(
+      const std::vector<std::string>& shardBasenames);
+
+  // The steps that are common to all the ways of building an index, before and
+  // after the triples have been converted to (global) IDs.
+  void initializeIndexBuilding();
+  void createPermutationsAndWriteConfiguration(
+      IndexBuilderDataAsFirstPermutationSorter indexBuilderData);
 
   /**
    * @brief Everything that has to be done when we have seen all the triples
    * that belong to one partial vocabulary, including Log output used inside
-   * passFileForVocabulary
+   * buildPartialVocabularies
    *
    * @param numLines How many Lines from the KB have we already parsed (only for
    * Logging)
@@ -772,8 +832,10 @@ class IndexImpl {
 
   // Create the SPO and SOP permutations. Additionally, count the number of
   // distinct actual (not internal) subjects in the input and write it to the
-  // metadata. Also builds the patterns if specified.
-  CPP_template(typename... NextSorter)(requires(sizeof...(NextSorter) <= 1))
+  // metadata. Also builds the patterns if specified. Without patterns, the
+  // triples can be pushed to the sorters of both subsequent pairs of
+  // permutations at once.
+  CPP_template(typename... NextSorter)(requires(sizeof...(NextSorter) <= 2))
       std::optional<PatternCreator::TripleSorter> createSPOAndSOP(
           size_t numColumns, BlocksOfTriples sortedTriples,
           NextSorter&&... nextSorter);
@@ -812,17 +874,22 @@ class IndexImpl {
 
   // Set up one of the permutation sorters with the appropriate memory limit.
   // The `permutationName` is used to determine the filename and must be unique
-  // for each call during one index build.
+  // for each call during one index build. The memory limit is split between
+  // `numSortersAtSameTime` sorters (by default, the usual number of sorters
+  // that are used at the same time).
   template <typename Comparator, size_t N = NumColumnsIndexBuilding>
   ExternalSorter<Comparator, N> makeSorter(
-      std::string_view permutationName) const;
+      std::string_view permutationName,
+      std::optional<size_t> numSortersAtSameTime = std::nullopt) const;
   // Same as the same function, but return a `unique_ptr`.
   template <typename Comparator, size_t N = NumColumnsIndexBuilding>
   std::unique_ptr<ExternalSorter<Comparator, N>> makeSorterPtr(
-      std::string_view permutationName) const;
+      std::string_view permutationName,
+      std::optional<size_t> numSortersAtSameTime = std::nullopt) const;
   // The common implementation of the above two functions.
   template <typename Comparator, size_t N, bool returnPtr>
-  auto makeSorterImpl(std::string_view permutationName) const;
+  auto makeSorterImpl(std::string_view permutationName,
+                      std::optional<size_t> numSortersAtSameTime) const;
 
   // Aliases for the three functions above that should be consistently used.
   // They assert that the order of the permutations as communicated by the
@@ -857,6 +924,14 @@ class IndexImpl {
     return createPSOAndPOS(AD_FWD(args)...);
   }
 
+  // Create the second and the third pair of permutations concurrently from
+  // the given sorters, which must already contain all the triples. Only used
+  // when no patterns are built, because otherwise the third pair depends on
+  // the patterns that are computed while creating the first pair.
+  template <typename SecondSorter, typename ThirdSorter>
+  void createSecondAndThirdPermutationPairConcurrently(
+      SecondSorter& secondSorter, ThirdSorter& thirdSorter);
+
   // Build the OSP and OPS permutations from the output of the `PatternCreator`.
   // The permutations will have two additional columns: The subject pattern of
   // the subject (which is already created by the `PatternCreator`) and the
@@ -905,6 +980,13 @@ class IndexImpl {
   // triples shared state.
   nlohmann::json recomputeStatistics(
       const LocatedTriplesSharedState& locatedTriplesSharedState) const;
+
+  // Return a copy of the configuration of this index with the statistics
+  // replaced by the given values. The number of subjects and objects is only
+  // stored if the index has all permutations.
+  nlohmann::json configurationWithStatistics(
+      NumNormalAndInternal numTriples, NumNormalAndInternal numPredicates,
+      size_t numSubjects, size_t numObjects) const;
 };
 
 #endif  // QLEVER_SRC_INDEX_INDEXIMPL_H
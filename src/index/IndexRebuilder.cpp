@@ -10,6 +10,8 @@
 #ifndef QLEVER_REDUCED_FEATURE_SET_FOR_CPP17
 #include "index/IndexRebuilder.h"
 
+#include <absl/strings/str_cat.h>
+
 #include <array>
 #include <boost/asio/awaitable.hpp>
 #include <boost/asio/co_spawn.hpp>
@@ -19,23 +21,36 @@
 #include <boost/asio/use_awaitable.hpp>
 #include <cstdint>
 #include <fstream>
+#include <iterator>
+#include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "backports/algorithm.h"
+#include "engine/idTable/CompressedExternalIdTable.h"
 #include "engine/idTable/IdTable.h"
+#include "global/Constants.h"
 #include "global/Id.h"
+#include "index/ExternalSortFunctors.h"
 #include "index/IndexImpl.h"
 #include "index/IndexRebuilderImpl.h"
+#include "index/KeyOrder.h"
+#include "index/LocalVocab.h"
 #include "index/LocalVocabEntry.h"
 #include "index/Permutation.h"
+#include "parser/RdfParser.h"
+#include "util/AllocatorWithLimit.h"
 #include "util/CancellationHandle.h"
+#include "util/Conversions.h"
 #include "util/Exception.h"
 #include "util/ExceptionHandling.h"
 #include "util/HashMap.h"
 #include "util/InputRangeUtils.h"
+#include "util/Iterators.h"
 #include "util/Log.h"
 
 namespace qlever::indexRebuilder {
@@ -181,6 +196,36 @@ Id remapBlankNodeId(Id original, const BlankNodeBlocks& blankNodeBlocks,
   return value.value();
 }
 
+namespace {
+// Return a callable that remaps an `Id` in place from the current index to the
+// new index. The last mapping is cached, because consecutive `Id`s in a column
+// are often equal.
+auto makeIdRemapper(const LocalVocabMapping& localVocabMapping,
+                    const InsertionPositions& insertionPositions,
+                    const BlankNodeBlocks& blankNodeBlocks,
+                    uint64_t minBlankNodeIndex) {
+  return [&insertionPositions, &localVocabMapping, &blankNodeBlocks,
+          minBlankNodeIndex, lastId = Id::makeUndefined(),
+          mappedId = Id::makeUndefined()](Id& id) mutable {
+    if (lastId.getBits() == id.getBits()) {
+      id = mappedId;
+      return;
+    }
+    lastId = id;
+    using enum Datatype;
+    auto datatype = id.getDatatype();
+    if (datatype == VocabIndex) [[likely]] {
+      id = remapVocabId(id, insertionPositions);
+    } else if (datatype == LocalVocabIndex) {
+      id = localVocabMapping.at(id.getBits());
+    } else if (datatype == BlankNodeIndex) {
+      id = remapBlankNodeId(id, blankNodeBlocks, minBlankNodeIndex);
+    }
+    mappedId = id;
+  };
+}
+}  // namespace
+
 // _____________________________________________________________________________
 ad_utility::InputRangeTypeErased<IdTableStatic<0>> readIndexAndRemap(
     const Permutation& permutation,
@@ -200,25 +245,8 @@ ad_utility::InputRangeTypeErased<IdTableStatic<0>> readIndexAndRemap(
       scanSpecAndBlocks, additionalColumns, cancellationHandle,
       *locatedTriplesSharedState);
 
-  auto remapId = [&insertionPositions, &localVocabMapping, &blankNodeBlocks,
-                  minBlankNodeIndex, lastId = Id::makeUndefined(),
-                  mappedId = Id::makeUndefined()](Id& id) mutable {
-    if (lastId.getBits() == id.getBits()) {
-      id = mappedId;
-      return;
-    }
-    lastId = id;
-    using enum Datatype;
-    auto datatype = id.getDatatype();
-    if (datatype == VocabIndex) [[likely]] {
-      id = remapVocabId(id, insertionPositions);
-    } else if (datatype == LocalVocabIndex) {
-      id = localVocabMapping.at(id.getBits());
-    } else if (datatype == BlankNodeIndex) {
-      id = remapBlankNodeId(id, blankNodeBlocks, minBlankNodeIndex);
-    }
-    mappedId = id;
-  };
+  auto remapId = makeIdRemapper(localVocabMapping, insertionPositions,
+                                blankNodeBlocks, minBlankNodeIndex);
 
   return ad_utility::InputRangeTypeErased{
       ad_utility::CachingTransformInputRange{
@@ -275,6 +303,118 @@ getNumberOfColumnsAndAdditionalColumns(
   return std::make_pair(numColumns, additionalColumns);
 }
 
+namespace {
+// Iterate over the rows of a range of blocks, see `mergeSortedTriples`.
+class BlockCursor {
+  using Block = IdTableStatic<0>;
+  ad_utility::InputRangeTypeErased<Block> blocks_;
+  std::optional<Block> block_;
+  size_t row_ = 0;
+  bool exhausted_ = false;
+
+ public:
+  explicit BlockCursor(ad_utility::InputRangeTypeErased<Block> blocks)
+      : blocks_{std::move(blocks)} {}
+
+  // Return true iff there is a current row. Empty blocks are skipped.
+  bool hasRow() {
+    while (!exhausted_ && (!block_.has_value() || row_ == block_->numRows())) {
+      block_ = blocks_.get();
+      row_ = 0;
+      exhausted_ = !block_.has_value();
+    }
+    return !exhausted_;
+  }
+
+  // The current row and the last row of the current block. Both require
+  // `hasRow()` to be true.
+  decltype(auto) row() const { return (*block_)[row_]; }
+  decltype(auto) lastRowOfBlock() const { return block_->back(); }
+
+  // Advance to the next row.
+  void advance() { ++row_; }
+
+  // Remove the remaining rows of the current block and return them.
+  Block takeRestOfBlock() {
+    Block rest = std::move(block_.value());
+    block_.reset();
+    if (row_ > 0) {
+      Block tail{rest.numColumns(), rest.getAllocator()};
+      tail.insertAtEnd(rest, row_);
+      rest = std::move(tail);
+    }
+    return rest;
+  }
+};
+}  // namespace
+
+// _____________________________________________________________________________
+ad_utility::InputRangeTypeErased<IdTableStatic<0>> mergeSortedTriples(
+    ad_utility::InputRangeTypeErased<IdTableStatic<0>> existing,
+    ad_utility::InputRangeTypeErased<IdTableStatic<0>> appended,
+    size_t numColumns) {
+  // The maximal number of rows of a block that contains appended triples.
+  constexpr size_t blockSize = 100'000;
+  using Row = std::array<Id, NumColumnsIndexBuilding>;
+  auto get = [existing = BlockCursor{std::move(existing)},
+              appended = BlockCursor{std::move(appended)}, numColumns,
+              lastRow = std::optional<Row>{}]() mutable
+      -> std::optional<IdTableStatic<0>> {
+    // Compare by the three key columns and then by the graph column.
+    SortBySPO less;
+    auto rememberLastRow = [&lastRow](const auto& row) {
+      lastRow = Row{row[0], row[1], row[2], row[3]};
+    };
+    auto isLastRow = [&lastRow, &less](const auto& row) {
+      return lastRow.has_value() && !less(row, lastRow.value()) &&
+             !less(lastRow.value(), row);
+    };
+    IdTableStatic<0> result{numColumns,
+                            ad_utility::makeUnlimitedAllocator<Id>()};
+    auto writeRow = [&result, &rememberLastRow](const auto& row) {
+      result.emplace_back();
+      size_t rowIndex = result.numRows() - 1;
+      for (size_t col = 0; col < result.numColumns(); ++col) {
+        result(rowIndex, col) =
+            col < row.size() ? row[col] : Id::makeUndefined();
+      }
+      rememberLastRow(row);
+    };
+    while (result.numRows() < blockSize &&
+           (existing.hasRow() || appended.hasRow())) {
+      if (existing.hasRow() &&
+          (!appended.hasRow() ||
+           !less(appended.row(), existing.lastRowOfBlock()))) {
+        // No appended triple has to be inserted into the rest of the current
+        // block, so it can be passed on unchanged.
+        if (!result.empty()) {
+          break;
+        }
+        auto block = existing.takeRestOfBlock();
+        rememberLastRow(block.back());
+        return block;
+      }
+      // On ties, the existing triple is written first, so that the appended
+      // triple is skipped as a duplicate.
+      if (existing.hasRow() && !less(appended.row(), existing.row())) {
+        writeRow(existing.row());
+        existing.advance();
+      } else {
+        if (!isLastRow(appended.row())) {
+          writeRow(appended.row());
+        }
+        appended.advance();
+      }
+    }
+    if (result.empty()) {
+      return std::nullopt;
+    }
+    return result;
+  };
+  return ad_utility::InputRangeTypeErased{
+      ad_utility::InputRangeFromGetCallable{std::move(get)}};
+}
+
 namespace {
 template <typename Func>
 boost::asio::awaitable<std::invoke_result_t<Func>> asCoroutine(Func func) {
@@ -290,24 +430,37 @@ boost::asio::awaitable<void> createPermutationWriterTask(
     const LocalVocabMapping& localVocabMapping,
     const InsertionPositions& insertionPositions,
     const BlankNodeBlocks& blankNodeBlocks, uint64_t minBlankNodeIndex,
-    const ad_utility::SharedCancellationHandle& cancellationHandle) {
+    const ad_utility::SharedCancellationHandle& cancellationHandle,
+    AppendedTriples* appendedTriples) {
   namespace net = boost::asio;
   auto ex = co_await net::this_coro::executor;
   auto makeTaskForPermutation = [&](const Permutation& permutation) {
     return [&newIndex, &permutation, isInternal, &locatedTriplesSharedState,
             &localVocabMapping, &insertionPositions, &blankNodeBlocks,
-            minBlankNodeIndex, &cancellationHandle]() {
+            minBlankNodeIndex, &cancellationHandle, appendedTriples]() {
       auto blockMetadataRanges = permutation.getAugmentedMetadataForPermutation(
           *locatedTriplesSharedState);
       auto [numColumns, additionalColumns] =
           getNumberOfColumnsAndAdditionalColumns(blockMetadataRanges);
-      return newIndex.createPermutationWithoutMetadata(
+      auto triples = readIndexAndRemap(
+          permutation, blockMetadataRanges, locatedTriplesSharedState,
+          localVocabMapping, insertionPositions, blankNodeBlocks,
+          minBlankNodeIndex, cancellationHandle, additionalColumns);
+      if (appendedTriples == nullptr) {
+        return newIndex.createPermutationWithoutMetadata(
+            numColumns, std::move(triples), permutation, isInternal);
+      }
+      auto result = newIndex.createPermutationWithoutMetadata(
           numColumns,
-          readIndexAndRemap(
-              permutation, blockMetadataRanges, locatedTriplesSharedState,
-              localVocabMapping, insertionPositions, blankNodeBlocks,
-              minBlankNodeIndex, cancellationHandle, additionalColumns),
+          mergeSortedTriples(
+              std::move(triples),
+              appendedTriples->getSortedTriples_(permutation, isInternal),
+              numColumns),
           permutation, isInternal);
+      appendedTriples->counts_
+          .at(static_cast<size_t>(permutation.permutation()))
+          .at(isInternal) = {result.second.totalElements(), result.first};
+      return result;
     };
   };
   auto taskA =
@@ -343,6 +496,89 @@ boost::asio::awaitable<void> createPermutationWriterTask(
 
 // _____________________________________________________________________________
 namespace qlever {
+namespace {
+using PermutationSettings = std::vector<
+    std::pair<std::pair<Permutation::Enum, Permutation::Enum>, bool>>;
+
+// Return the pairs of permutations that are written for a new index based on
+// `index`, with the information whether the attached internal permutation
+// should be used.
+PermutationSettings getPermutationSettings(const IndexImpl& index) {
+  using enum Permutation::Enum;
+  PermutationSettings permutationSettings{{{PSO, POS}, false},
+                                          {{PSO, POS}, true}};
+  if (index.hasAllPermutations()) {
+    permutationSettings.push_back({{SPO, SOP}, false});
+    permutationSettings.push_back({{OPS, OSP}, false});
+  }
+  return permutationSettings;
+}
+
+// Write the patterns and all permutations of `newIndex` (which already has its
+// configuration) based on the data of `index`. The other arguments are passed
+// on to `createPermutationWriterTask`. If there are `appendedTriples`, no
+// patterns are written, because the patterns of the subjects of the appended
+// triples are not computed (see `appendToIndex`).
+void writePatternsAndPermutations(
+    IndexImpl& newIndex, const IndexImpl& index,
+    const LocatedTriplesSharedState& locatedTriplesSharedState,
+    const indexRebuilder::LocalVocabMapping& localVocabMapping,
+    const indexRebuilder::InsertionPositions& insertionPositions,
+    const indexRebuilder::BlankNodeBlocks& blankNodeBlocks,
+    uint64_t minBlankNodeIndex,
+    const ad_utility::SharedCancellationHandle& cancellationHandle,
+    indexRebuilder::AppendedTriples* appendedTriples) {
+  using namespace indexRebuilder;
+  auto permutationSettings = getPermutationSettings(index);
+  bool writePatterns = index.usePatterns() && appendedTriples == nullptr;
+  auto patternThreads = static_cast<size_t>(writePatterns);
+  size_t numberOfPermutations = 2 * permutationSettings.size();
+  namespace net = boost::asio;
+  net::thread_pool threadPool{patternThreads + numberOfPermutations};
+
+  // Collect the first exception thrown by any worker so it can be rethrown to
+  // the caller after `threadPool.join()`. Without this, exceptions escaping a
+  // `net::post` handler call `std::terminate` and exceptions from a detached
+  // `co_spawn` are silently swallowed. NOTE: `exceptionCollector` must outlive
+  // `threadPool`, since the worker callables capture a pointer to it via
+  // `wrap()` / `std::ref`; the declaration order here guarantees that.
+  ad_utility::ExceptionCollector exceptionCollector;
+
+  if (writePatterns) {
+    net::post(threadPool, exceptionCollector.wrap([&newIndex, &index,
+                                                   &insertionPositions]() {
+      newIndex.getPatterns() = index.getPatterns().cloneAndRemap(
+          [&insertionPositions](const Id& oldId) {
+            return remapVocabId(oldId, insertionPositions);
+          });
+      newIndex.writePatternsToFile();
+    }));
+  }
+
+  for (const auto& [permutationEnums, isInternal] : permutationSettings) {
+    auto [a, b] = permutationEnums;
+    auto getPermutation =
+        [&index, isInternal](Permutation::Enum permEnum) -> const Permutation& {
+      const auto& perm = index.getPermutation(permEnum);
+      return isInternal ? perm.internalPermutation() : perm;
+    };
+
+    net::co_spawn(
+        threadPool,
+        createPermutationWriterTask(
+            newIndex, getPermutation(a), getPermutation(b), isInternal,
+            locatedTriplesSharedState, localVocabMapping, insertionPositions,
+            blankNodeBlocks, minBlankNodeIndex, cancellationHandle,
+            appendedTriples),
+        std::ref(exceptionCollector));
+  }
+
+  threadPool.join();
+  exceptionCollector.rethrowIfException();
+}
+}  // namespace
+
+// _____________________________________________________________________________
 indexRebuilder::IndexRebuildMapping materializeToIndex(
     const IndexImpl& index, const std::string& newIndexName,
     const LocatedTriplesSharedState& locatedTriplesSharedState,
@@ -388,63 +624,254 @@ indexRebuilder::IndexRebuildMapping materializeToIndex(
 
   REBUILD_LOG_INFO << "Writing new permutations ..." << std::endl;
 
-  auto patternThreads = static_cast<size_t>(index.usePatterns());
-  size_t numberOfPermutations = index.hasAllPermutations() ? 8 : 4;
-  namespace net = boost::asio;
-  net::thread_pool threadPool{patternThreads + numberOfPermutations};
+  writePatternsAndPermutations(newIndex, index, locatedTriplesSharedState,
+                               localVocabMapping, insertionPositions,
+                               blankNodeBlocks, minBlankNodeIndex,
+                               cancellationHandle, nullptr);
 
-  // Collect the first exception thrown by any worker so it can be rethrown to
-  // the caller after `threadPool.join()`. Without this, exceptions escaping a
-  // `net::post` handler call `std::terminate` and exceptions from a detached
-  // `co_spawn` are silently swallowed. NOTE: `exceptionCollector` must outlive
-  // `threadPool`, since the worker callables capture a pointer to it via
-  // `wrap()` / `std::ref`; the declaration order here guarantees that.
-  ad_utility::ExceptionCollector exceptionCollector;
+  REBUILD_LOG_INFO << "Index rebuild completed" << std::endl;
 
-  if (index.usePatterns()) {
-    net::post(threadPool, exceptionCollector.wrap([&newIndex, &index,
-                                                   &insertionPositions]() {
-      newIndex.getPatterns() = index.getPatterns().cloneAndRemap(
-          [&insertionPositions](const Id& oldId) {
-            return remapVocabId(oldId, insertionPositions);
-          });
-      newIndex.writePatternsToFile();
-    }));
+#undef REBUILD_LOG_INFO
+  return {std::move(insertionPositions), std::move(localVocabMapping),
+          std::move(blankNodeBlocks), minBlankNodeIndex};
+}
+
+// _____________________________________________________________________________
+indexRebuilder::IndexRebuildMapping appendToIndex(
+    const IndexImpl& index, const std::string& newIndexName,
+    const std::vector<InputFileSpecification>& files,
+    const ad_utility::SharedCancellationHandle& cancellationHandle,
+    const std::string& logFileName) {
+  using namespace indexRebuilder;
+  using ad_utility::triple_component::Iri;
+  AD_CONTRACT_CHECK(!files.empty(), "No input files to append were specified");
+  AD_CONTRACT_CHECK(!logFileName.empty(), "Log file name must not be empty");
+
+  auto logFile = ad_utility::makeOfstream(logFileName);
+
+  // Macro for rebuild-specific logging with the same syntax as AD_LOG_INFO
+#define REBUILD_LOG_INFO \
+  logFile << ad_utility::Log::getTimeStamp() << " - INFO: "
+
+  REBUILD_LOG_INFO << "Appending to index (including updates)" << std::endl;
+
+  // The updates of the `index` are only read, the `index` is not modified.
+  auto [locatedTriplesSharedState, deltaEntries, ownedBlocks] =
+      index.deltaTriplesManager()
+          .getCurrentLocatedTriplesSharedStateWithVocab();
+
+  // The words of the updates and of the new triples that are not contained in
+  // the vocabulary of the `index`. Apart from the blank node labels, this is
+  // the only part of the input that is kept in RAM. The words of the updates
+  // are copied first, so that each word is only written once.
+  LocalVocab vocabDelta;
+  std::vector<std::pair<Id, Id>> deltaEntryIds;
+  deltaEntryIds.reserve(deltaEntries.size());
+  for (auto* entry : deltaEntries) {
+    deltaEntryIds.emplace_back(Id::makeFromLocalVocabIndex(entry),
+                               Id::makeFromLocalVocabIndex(
+                                   vocabDelta.getIndexAndAddIfNotContained(
+                                       *entry)));
   }
 
-  using enum Permutation::Enum;
+  // The memory limit for the index building is split between one sorter per
+  // written permutation and the two unsorted tables below.
+  auto permutationSettings = getPermutationSettings(index);
+  auto memoryPerTable = index.memoryLimitIndexBuilding() /
+                        (2 * permutationSettings.size() + 2);
+  auto allocator = ad_utility::makeUnlimitedAllocator<Id>();
+
+  // The new triples (in the order SPO + graph) and the internal triples for
+  // their language tags, with the `Id`s of the `vocabDelta`.
+  using UnsortedTriples =
+      ad_utility::CompressedExternalIdTable<NumColumnsIndexBuilding>;
+  UnsortedTriples newTriples{newIndexName + ".append-triples.dat",
+                             memoryPerTable, allocator};
+  UnsortedTriples newInternalTriples{
+      newIndexName + ".append-internal-triples.dat", memoryPerTable,
+      allocator};
+
+  REBUILD_LOG_INFO << "Parsing new triples ..." << std::endl;
+  {
+    // Blank nodes are stored as strings by the parser. The same label refers
+    // to the same blank node across all batches and files.
+    ad_utility::HashMap<std::string, Id> blankNodeIds;
+    auto toId = [&index, &vocabDelta, &blankNodeIds](TripleComponent tc) {
+      if (tc.isString()) {
+        auto [it, isNew] =
+            blankNodeIds.try_emplace(tc.getString(), Id::makeUndefined());
+        if (isNew) {
+          it->second = Id::makeFromBlankNodeIndex(
+              vocabDelta.getBlankNodeIndex(index.getBlankNodeManager()));
+        }
+        return it->second;
+      }
+      return std::move(tc).toValueId(index, vocabDelta);
+    };
+    Id languagePredicate =
+        toId(TripleComponent{Iri::fromIriref(LANGUAGE_PREDICATE)});
+    RdfMultifileParser parser{files, &index.encodedIriManager()};
+    size_t numTriples = 0;
+    while (auto batch = parser.getBatch()) {
+      cancellationHandle->throwIfCancelled();
+      for (auto& triple : batch.value()) {
+        // NOTE: The internal triples for language tags are the same as in
+        // `getIdMapLambdas` in `IndexBuilderTypes.h` and in
+        // `DeltaTriples::makeInternalTriples`.
+        std::optional<std::pair<TripleComponent, TripleComponent>>
+            langtagComponents;
+        const auto& object = triple.object_;
+        if (object.isLiteral() && object.getLiteral().hasLanguageTag()) {
+          auto langtag =
+              asStringViewUnsafe(object.getLiteral().getLanguageTag());
+          langtagComponents.emplace(
+              TripleComponent{ad_utility::convertToLanguageTaggedPredicate(
+                  triple.predicate_.getIri(), langtag)},
+              TripleComponent{ad_utility::convertLangtagToEntityUri(langtag)});
+        }
+        std::array ids{toId(std::move(triple.subject_)),
+                       toId(std::move(triple.predicate_)),
+                       toId(std::move(triple.object_)),
+                       toId(std::move(triple.graphIri_))};
+        newTriples.push(ids);
+        if (langtagComponents.has_value()) {
+          auto& [langTaggedPredicate, langtagEntity] =
+              langtagComponents.value();
+          // `<subject> @language@<predicate> "object"@language`.
+          newInternalTriples.push(
+              std::array{ids[0], toId(std::move(langTaggedPredicate)), ids[2],
+                         ids[3]});
+          // `"object"@language ql:langtag <@language>`.
+          newInternalTriples.push(
+              std::array{ids[2], languagePredicate,
+                         toId(std::move(langtagEntity)), ids[3]});
+        }
+      }
+      numTriples += batch.value().size();
+    }
+    REBUILD_LOG_INFO << "Number of triples parsed for appending: "
+                     << numTriples << std::endl;
+  }
 
-  // List of permutation pairs, with the information whether the attached
-  // internal permutation should be used.
-  std::vector<std::pair<std::pair<Permutation::Enum, Permutation::Enum>, bool>>
-      permutationSettings{{{PSO, POS}, false}, {{PSO, POS}, true}};
+  REBUILD_LOG_INFO << "Writing new vocabulary ..." << std::endl;
 
-  if (index.hasAllPermutations()) {
-    permutationSettings.push_back({{SPO, SOP}, false});
-    permutationSettings.push_back({{OPS, OSP}, false});
+  auto entries = ::ranges::to<std::vector>(
+      vocabDelta.primaryWordSet() |
+      ql::views::transform(
+          [](const LocalVocabEntry& entry) { return &entry; }));
+  auto [insertionPositions, localVocabMapping] =
+      materializeLocalVocab(entries, index.getVocab(), newIndexName);
+  for (const auto& [deltaId, vocabDeltaId] : deltaEntryIds) {
+    Id newId = localVocabMapping.at(vocabDeltaId.getBits());
+    localVocabMapping.emplace(deltaId.getBits(), newId);
   }
 
+  ql::ranges::copy(vocabDelta.getOwnedLocalBlankNodeBlocks(),
+                   std::back_inserter(ownedBlocks));
+  auto blankNodeBlocks = flattenBlankNodeBlocks(ownedBlocks);
+  auto minBlankNodeIndex = index.getBlankNodeManager()->minIndex_;
+
+  REBUILD_LOG_INFO << "Sorting new triples ..." << std::endl;
+
+  using Sorter = ExternalSorter<SortBySPO>;
+  std::array<std::array<std::unique_ptr<Sorter>, 2>, Permutation::ALL.size()>
+      sorters;
   for (const auto& [permutationEnums, isInternal] : permutationSettings) {
-    auto [a, b] = permutationEnums;
-    auto getPermutation =
-        [&index, isInternal](Permutation::Enum permEnum) -> const Permutation& {
-      const auto& perm = index.getPermutation(permEnum);
-      return isInternal ? perm.internalPermutation() : perm;
+    for (auto permutation : {permutationEnums.first, permutationEnums.second}) {
+      sorters.at(static_cast<size_t>(permutation)).at(isInternal) =
+          std::make_unique<Sorter>(
+              absl::StrCat(newIndexName, ".append-",
+                           Permutation::toString(permutation),
+                           isInternal ? "-internal" : "", "-sorter.dat"),
+              memoryPerTable, allocator);
+    }
+  }
+
+  // Remap the `triples` to the `Id`s of the new index and push them to the
+  // sorters of all permutations that are internal iff `isInternal`, with the
+  // columns in the key order of the respective permutation.
+  auto sortTriples = [&](UnsortedTriples& triples, bool isInternal) {
+    std::vector<std::pair<Sorter*, KeyOrder::Array>> targets;
+    for (auto permutation : Permutation::ALL) {
+      const auto& sorter =
+          sorters.at(static_cast<size_t>(permutation)).at(isInternal);
+      if (sorter != nullptr) {
+        targets.emplace_back(sorter.get(),
+                             Permutation::toKeyOrder(permutation).keys());
+      }
+    }
+    // One remapper per column, such that each one profits from its cache.
+    auto makeRemapper = [&]() {
+      return makeIdRemapper(localVocabMapping, insertionPositions,
+                            blankNodeBlocks, minBlankNodeIndex);
     };
+    std::array remappers{makeRemapper(), makeRemapper(), makeRemapper(),
+                         makeRemapper()};
+    for (const auto& row : triples.getRows()) {
+      std::array ids{row[0], row[1], row[2], row[3]};
+      for (size_t i = 0; i < ids.size(); ++i) {
+        remappers[i](ids[i]);
+      }
+      for (const auto& [sorter, keys] : targets) {
+        sorter->push(std::array{ids[keys[0]], ids[keys[1]], ids[keys[2]],
+                                ids[keys[3]]});
+      }
+    }
+  };
+  sortTriples(newTriples, false);
+  sortTriples(newInternalTriples, true);
+
+  AppendedTriples appendedTriples;
+  appendedTriples.getSortedTriples_ = [&sorters](
+                                          const Permutation& permutation,
+                                          bool isInternal) {
+    return sorters.at(static_cast<size_t>(permutation.permutation()))
+        .at(isInternal)
+        ->getSortedBlocks<0>();
+  };
 
-    net::co_spawn(
-        threadPool,
-        createPermutationWriterTask(
-            newIndex, getPermutation(a), getPermutation(b), isInternal,
-            locatedTriplesSharedState, localVocabMapping, insertionPositions,
-            blankNodeBlocks, minBlankNodeIndex, cancellationHandle),
-        std::ref(exceptionCollector));
+  // The statistics are computed while the permutations are written, see
+  // `AppendedTriples::counts_`.
+  auto numBlankNodesTotal =
+      minBlankNodeIndex +
+      blankNodeBlocks.size() * ad_utility::BlankNodeManager::blockSize_;
+  auto makeStatistics = [&index, &appendedTriples, numBlankNodesTotal]() {
+    auto counts = [&appendedTriples](Permutation::Enum permutation,
+                                     bool isInternal) {
+      return appendedTriples.counts_.at(static_cast<size_t>(permutation))
+          .at(isInternal);
+    };
+    using enum Permutation::Enum;
+    using Counts = IndexImpl::NumNormalAndInternal;
+    auto statistics = index.configurationWithStatistics(
+        Counts{counts(PSO, false).numTriples_, counts(PSO, true).numTriples_},
+        Counts{counts(PSO, false).numDistinctCol0_,
+               counts(PSO, true).numDistinctCol0_},
+        counts(SPO, false).numDistinctCol0_,
+        counts(OSP, false).numDistinctCol0_);
+    statistics["num-blank-nodes-total"] = numBlankNodesTotal;
+    return statistics;
+  };
+
+  // See `materializeToIndex` for the 0-byte allocator. The configuration is
+  // written again with the final statistics after the permutations.
+  IndexImpl newIndex{ad_utility::makeAllocatorWithLimit<Id>(0_B)};
+  newIndex.loadConfigFromOldIndex(newIndexName, index, makeStatistics());
+
+  if (index.usePatterns()) {
+    REBUILD_LOG_INFO << "The patterns are not written for the new index, "
+                        "start the server with `--no-patterns`"
+                     << std::endl;
   }
+  REBUILD_LOG_INFO << "Writing new permutations ..." << std::endl;
 
-  threadPool.join();
-  exceptionCollector.rethrowIfException();
+  writePatternsAndPermutations(newIndex, index, locatedTriplesSharedState,
+                               localVocabMapping, insertionPositions,
+                               blankNodeBlocks, minBlankNodeIndex,
+                               cancellationHandle, &appendedTriples);
+  newIndex.loadConfigFromOldIndex(newIndexName, index, makeStatistics());
 
-  REBUILD_LOG_INFO << "Index rebuild completed" << std::endl;
+  REBUILD_LOG_INFO << "Appending to index completed" << std::endl;
 
 #undef REBUILD_LOG_INFO
   return {std::move(insertionPositions), std::move(localVocabMapping),
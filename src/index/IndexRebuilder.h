@@ -18,6 +18,7 @@
 #include "index/DeltaTriples.h"
 #include "index/IndexImpl.h"
 #include "index/IndexRebuilderTypes.h"
+#include "index/InputFileSpecification.h"
 #include "util/CancellationHandle.h"
 
 namespace qlever {
@@ -63,6 +64,25 @@ indexRebuilder::IndexRebuildMapping materializeToIndex(
     const ad_utility::SharedCancellationHandle& cancellationHandle,
     const std::string& logFileName);
 
+// Build a new index at `newIndexName` that consists of the `index` (including
+// its current updates) and the triples from the `files`, without a full index
+// build. Only the new input is parsed. Its vocabulary is merged into the
+// existing vocabulary, the existing `Id`s are remapped monotonically, and the
+// new triples are merged into the existing permutations block by block (see
+// `materializeToIndex` above, the arguments have the same meaning). The new
+// triples are sorted for each permutation by external sorters next to the new
+// index, only the new words and the blank node labels are kept in RAM. The
+// `index` and its updates are not modified. As for updates, no `ql:has-word`
+// triples are created for the new triples. The patterns of the subjects of the
+// new triples are not computed, so the new index has no patterns at all (its
+// permutations still have the pattern columns, which are UNDEF for the new
+// triples, but they are not used without the patterns).
+indexRebuilder::IndexRebuildMapping appendToIndex(
+    const IndexImpl& index, const std::string& newIndexName,
+    const std::vector<InputFileSpecification>& files,
+    const ad_utility::SharedCancellationHandle& cancellationHandle,
+    const std::string& logFileName);
+
 }  // namespace qlever
 
 #endif  // QLEVER_SRC_INDEX_INDEXREBUILDER_H
@@ -10,8 +10,10 @@
 #ifndef QLEVER_SRC_INDEX_INDEXREBUILDERIMPL_H
 #define QLEVER_SRC_INDEX_INDEXREBUILDERIMPL_H
 
+#include <array>
 #include <boost/asio/awaitable.hpp>
 #include <cstdint>
+#include <functional>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -60,9 +62,46 @@ ad_utility::InputRangeTypeErased<IdTableStatic<0>> readIndexAndRemap(
 // `Id::makeUndefined()`.
 size_t getNumColumns(const BlockMetadataRanges& blockMetadataRanges);
 
+// The number of triples and of distinct `Id`s in the first column of a
+// permutation that was written by `createPermutationWriterTask`.
+struct PermutationCounts {
+  size_t numTriples_ = 0;
+  size_t numDistinctCol0_ = 0;
+};
+
+// Additional triples that `createPermutationWriterTask` merges into the
+// permutations it writes, see `appendToIndex`.
+struct AppendedTriples {
+  using SortedTriples = ad_utility::InputRangeTypeErased<IdTableStatic<0>>;
+  // Return the triples that are to be added to the given permutation (which is
+  // internal iff `isInternal` is true). They have to be sorted by the key order
+  // of the permutation and consist of the three key columns and the graph
+  // column. This is called exactly once per written permutation.
+  std::function<SortedTriples(const Permutation& permutation, bool isInternal)>
+      getSortedTriples_;
+  // The counts of the written permutations, indexed by the
+  // `Permutation::Enum` and by `isInternal`. Each entry is written by a
+  // single task, so no synchronization is required.
+  std::array<std::array<PermutationCounts, 2>, Permutation::ALL.size()>
+      counts_{};
+};
+
+// Merge the `appended` triples (see `AppendedTriples` above) into the
+// `existing` blocks of a permutation, which have `numColumns` columns. Both
+// inputs have to be sorted by the first four columns. Appended triples that
+// are already contained in `existing` or occur multiple times are only
+// written once, and their remaining columns are filled with
+// `Id::makeUndefined()`. Blocks of `existing` that contain no appended
+// triples are passed on unchanged.
+ad_utility::InputRangeTypeErased<IdTableStatic<0>> mergeSortedTriples(
+    ad_utility::InputRangeTypeErased<IdTableStatic<0>> existing,
+    ad_utility::InputRangeTypeErased<IdTableStatic<0>> appended,
+    size_t numColumns);
+
 // Create a `boost::asio::awaitable<void>` that writes a pair of new
 // permutations according to the settings of `newIndex`, based on the data of
-// the current index.
+// the current index. If `appendedTriples` is not null, its triples are merged
+// into the written permutations and its `counts_` are set.
 boost::asio::awaitable<void> createPermutationWriterTask(
     IndexImpl& newIndex, const Permutation& permutationA,
     const Permutation& permutationB, bool isInternal,
@@ -70,7 +109,8 @@ boost::asio::awaitable<void> createPermutationWriterTask(
     const LocalVocabMapping& localVocabMapping,
     const InsertionPositions& insertionPositions,
     const BlankNodeBlocks& blankNodeBlocks, uint64_t minBlankNodeIndex,
-    const ad_utility::SharedCancellationHandle& cancellationHandle);
+    const ad_utility::SharedCancellationHandle& cancellationHandle,
+    AppendedTriples* appendedTriples = nullptr);
 
 // Analyze how many columns the new permutation will have and which additional
 // columns it will have based on the given `blockMetadataRanges`. The number of
@@ -0,0 +1,167 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#include "index/IndexWarmup.h"
+
+#include <absl/strings/match.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <memory>
+#include <system_error>
+#include <tuple>
+
+#include "backports/algorithm.h"
+#include "global/Constants.h"
+#include "index/IndexImpl.h"
+#include "util/File.h"
+#include "util/Log.h"
+
+using ad_utility::MemorySize;
+
+// _____________________________________________________________________________
+std::vector<IndexWarmup::Block> IndexWarmup::selectBlocks(
+    std::vector<Block> candidates, size_t budget) {
+  ql::ranges::stable_sort(candidates, std::greater{}, &Block::priority_);
+  std::vector<Block> result;
+  for (const auto& block : candidates) {
+    // Blocks that don't fit are skipped, s.t. a smaller block with a lower
+    // priority can still use the rest of the budget.
+    if (block.numBytes_ <= budget) {
+      budget -= block.numBytes_;
+      result.push_back(block);
+    }
+  }
+  ql::ranges::sort(result, [](const Block& a, const Block& b) {
+    return std::tie(a.permutation_, a.blockIndex_) <
+           std::tie(b.permutation_, b.blockIndex_);
+  });
+  return result;
+}
+
+// _____________________________________________________________________________
+std::vector<std::string> IndexWarmup::getVocabularyOffsetsFiles(
+    const std::string& onDiskBase) {
+  // The different vocabulary implementations store their words in different
+  // files, but all of them end with the suffix of `VocabularyOnDisk`.
+  std::filesystem::path basePath{onDiskBase};
+  std::filesystem::path directory = basePath.parent_path();
+  if (directory.empty()) {
+    directory = ".";
+  }
+  std::string prefix =
+      absl::StrCat(basePath.filename().string(), VOCAB_SUFFIX);
+  std::vector<std::string> result;
+  std::error_code errorCode;
+  for (const auto& entry :
+       std::filesystem::directory_iterator{directory, errorCode}) {
+    auto filename = entry.path().filename().string();
+    if (entry.is_regular_file(errorCode) &&
+        absl::StartsWith(filename, prefix) &&
+        absl::EndsWith(filename, ".offsets")) {
+      result.push_back(entry.path().string());
+    }
+  }
+  ql::ranges::sort(result);
+  return result;
+}
+
+// _____________________________________________________________________________
+IndexWarmup::Statistics IndexWarmup::warmUp(const IndexImpl& index,
+                                            MemorySize budget) {
+  Statistics statistics;
+  size_t remaining = budget.getBytes();
+  if (remaining == 0) {
+    return statistics;
+  }
+  AD_LOG_INFO << "Warming up the index with a budget of " << budget.asString()
+              << " ..." << std::endl;
+
+  std::vector<std::shared_ptr<const Permutation>> permutations;
+  for (auto permutation : Permutation::ALL) {
+    auto ptr = index.getPermutationPtr(permutation);
+    if (ptr != nullptr && ptr->isLoaded()) {
+      permutations.push_back(std::move(ptr));
+    }
+  }
+
+  // 1. The metadata of the relations.
+  for (const auto& permutation : permutations) {
+    size_t numBytes = permutation->metaData().data().prefetch(remaining);
+    remaining -= numBytes;
+    statistics.metadata_ += MemorySize::bytes(numBytes);
+  }
+
+  // 2. The offsets of the vocabularies.
+  for (const auto& filename :
+       getVocabularyOffsetsFiles(index.getOnDiskBase())) {
+    ad_utility::File file{filename, "r"};
+    size_t numBytes =
+        std::min(static_cast<size_t>(file.sizeOfFile()), remaining);
+    file.adviseWillNeed(0, numBytes);
+    remaining -= numBytes;
+    statistics.vocabulary_ += MemorySize::bytes(numBytes);
+  }
+
+  // 3. The blocks of the permutations. If accesses to the blocks have been
+  // recorded (see `BlockAccessHistogram.h`), the blocks with the most accesses
+  // are prefetched first. Otherwise, we prefetch the first blocks of all the
+  // permutations in a round-robin fashion (the order of `Permutation::ALL`
+  // breaks the ties, so `PSO` and `POS`, which are used by most queries, come
+  // first).
+  std::vector<std::vector<uint64_t>> accessCounts;
+  bool hasAccessCounts = false;
+  size_t maxNumBlocks = 0;
+  for (const auto& permutation : permutations) {
+    const auto* histogram = permutation->reader().blockAccessHistogram();
+    auto& counts = accessCounts.emplace_back();
+    if (histogram != nullptr) {
+      counts = histogram->getCounts();
+      hasAccessCounts |=
+          ql::ranges::any_of(counts, [](uint64_t c) { return c > 0; });
+    }
+    maxNumBlocks =
+        std::max(maxNumBlocks, permutation->metaData().blockData().size());
+  }
+  std::vector<Block> candidates;
+  for (size_t i = 0; i < permutations.size(); ++i) {
+    const auto& blocks = permutations[i]->metaData().blockData();
+    const auto& counts = accessCounts[i];
+    for (size_t j = 0; j < blocks.size(); ++j) {
+      uint64_t priority = maxNumBlocks - j;
+      if (hasAccessCounts) {
+        priority = j < counts.size() ? counts[j] : 0;
+      }
+      candidates.push_back(
+          {i, j, CompressedRelationReader::getSizeInFile(blocks[j]), priority});
+    }
+  }
+  auto selected = selectBlocks(std::move(candidates), remaining);
+  // Prefetch runs of consecutive blocks with a single call.
+  for (auto it = selected.begin(); it != selected.end();) {
+    auto runEnd = std::next(it);
+    while (runEnd != selected.end() &&
+           runEnd->permutation_ == it->permutation_ &&
+           runEnd->blockIndex_ ==
+               it->blockIndex_ + static_cast<size_t>(runEnd - it)) {
+      ++runEnd;
+    }
+    const auto& permutation = *permutations.at(it->permutation_);
+    ql::span<const CompressedBlockMetadata> blocks{
+        permutation.metaData().blockData()};
+    size_t numBlocks = static_cast<size_t>(runEnd - it);
+    size_t numBytes = permutation.reader().prefetchBlocks(
+        blocks.subspan(it->blockIndex_, numBlocks));
+    statistics.blocks_ += MemorySize::bytes(numBytes);
+    statistics.numBlocks_ += numBlocks;
+    it = runEnd;
+  }
+
+  AD_LOG_INFO << "Requested the prefetching of "
+              << statistics.metadata_.asString() << " of metadata, "
+              << statistics.vocabulary_.asString()
+              << " of vocabulary offsets, and " << statistics.numBlocks_
+              << " blocks (" << statistics.blocks_.asString() << ")"
+              << std::endl;
+  return statistics;
+}
@@ -0,0 +1,77 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#ifndef QLEVER_SRC_INDEX_INDEXWARMUP_H
+#define QLEVER_SRC_INDEX_INDEXWARMUP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "backports/three_way_comparison.h"
+#include "util/MemorySize/MemorySize.h"
+
+class IndexImpl;
+
+// Warm up the index after a (re)start of the server. Without a warm-up, the
+// first queries after a restart cause many random page faults and reads
+// (of the metadata, the vocabulary, and the blocks of the permutations),
+// which leads to high latencies until the page cache of the kernel is filled.
+//
+// The warm-up asks the kernel to asynchronously prefetch the following parts
+// of the index into memory, in this order, until the given budget is used up:
+//
+// 1. The (memory-mapped) metadata of the relations of the permutations, which
+//    is accessed by the query planner for every triple. For the mapping, huge
+//    pages are requested, to reduce the number of TLB misses.
+// 2. The offsets files of the vocabularies, which are accessed by the binary
+//    searches for every IRI and literal in a query.
+// 3. The blocks of the permutations, selected via `selectBlocks` below. The
+//    blocks that were accessed most often (according to the persisted
+//    `BlockAccessHistogram`s) come first.
+//
+// The prefetching is asynchronous (via `madvise` and `posix_fadvise`), so the
+// server can already answer queries while the warm-up is still in progress.
+class IndexWarmup {
+ public:
+  // A block that is a candidate for the warm-up. Blocks with a higher
+  // `priority_` are warmed up first.
+  struct Block {
+    size_t permutation_;
+    size_t blockIndex_;
+    size_t numBytes_;
+    uint64_t priority_;
+    QL_DEFINE_DEFAULTED_EQUALITY_OPERATOR_LOCAL(Block, permutation_,
+                                                blockIndex_, numBytes_,
+                                                priority_)
+  };
+
+  // Statistics about a finished warm-up.
+  struct Statistics {
+    ad_utility::MemorySize metadata_ = ad_utility::MemorySize::bytes(0);
+    ad_utility::MemorySize vocabulary_ = ad_utility::MemorySize::bytes(0);
+    ad_utility::MemorySize blocks_ = ad_utility::MemorySize::bytes(0);
+    size_t numBlocks_ = 0;
+  };
+
+  // Prefetch the `index` as described above, using at most `budget` bytes of
+  // memory. A budget of zero disables the warm-up.
+  static Statistics warmUp(const IndexImpl& index,
+                           ad_utility::MemorySize budget);
+
+  // Select the blocks with the highest priority, the total size of which is at
+  // most `budget` bytes. Blocks with equal priority are selected in the order
+  // in which they are given. The result is sorted by the permutation and the
+  // block index, s.t. the blocks can be prefetched in the order in which they
+  // are stored.
+  static std::vector<Block> selectBlocks(std::vector<Block> candidates,
+                                         size_t budget);
+
+  // Return the names of the files with the offsets of the on-disk vocabularies
+  // of the index with the given `onDiskBase`, sorted by name.
+  static std::vector<std::string> getVocabularyOffsetsFiles(
+      const std::string& onDiskBase);
+};
+
+#endif  // QLEVER_SRC_INDEX_INDEXWARMUP_H
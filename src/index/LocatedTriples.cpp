@@ -427,6 +427,25 @@ void updateGraphMetadata(CompressedBlockMetadata& blockMetadata,
   }
 }
 
+// Update the column statistics of the `blockMetadata`, such that they also
+// cover the `locatedTriples` which are inserted into that block. Deleted
+// triples are not removed from the statistics, as this would require reading
+// the block.
+static void updateColumnStatistics(CompressedBlockMetadata& blockMetadata,
+                                   const LocatedTriples& locatedTriples) {
+  auto& statistics = blockMetadata.columnStatistics_;
+  if (!statistics.has_value()) {
+    return;
+  }
+  for (const LocatedTriple& locatedTriple :
+       locatedTriples | ql::views::filter(&LocatedTriple::insertOrDelete_)) {
+    const auto& ids = locatedTriple.triple_.ids();
+    for (size_t i = 0; i < statistics->size(); ++i) {
+      statistics.value()[i].add(ids[i]);
+    }
+  }
+}
+
 // ____________________________________________________________________________
 void LocatedTriplesPerBlock::updateAugmentedMetadata() {
   // TODO<C++23> use view::enumerate
@@ -448,6 +467,10 @@ void LocatedTriplesPerBlock::updateAugmentedMetadata() {
           std::max(blockMetadata.lastTriple_,
                    blockUpdates->rbegin()->triple_.toPermutedTriple());
       updateGraphMetadata(blockMetadata, *blockUpdates);
+      updateColumnStatistics(blockMetadata, *blockUpdates);
+      // The Bloom filter doesn't know about the inserted triples, so the block
+      // must not be skipped because of it.
+      blockMetadata.col1BloomFilter_.reset();
     }
     blockIndex++;
   }
@@ -458,7 +481,8 @@ void LocatedTriplesPerBlock::updateAugmentedMetadata() {
     auto lastTriple = blockUpdates->rbegin()->triple_.toPermutedTriple();
 
     // The first `std::nullopt` means that this block contains only
-    // `LocatedTriple`s.
+    // `LocatedTriple`s. It has no column statistics, so it is never skipped
+    // by the prefiltering on unsorted columns.
     CompressedBlockMetadataNoBlockIndex lastBlockN{
         std::nullopt, 0, firstTriple, lastTriple, std::nullopt, true};
     lastBlockN.graphInfo_.emplace();
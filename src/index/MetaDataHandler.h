@@ -81,6 +81,12 @@ class MetaDataWrapperDense {
   // ___________________________________________________________
   size_t size() const { return _vec.size(); }
 
+  // Prefetch (at most `maxNumBytes` of) the underlying vector, see
+  // `MmapVector::prefetch`.
+  size_t prefetch(size_t maxNumBytes) const {
+    return _vec.prefetch(maxNumBytes);
+  }
+
   // __________________________________________________________________
   ConstIterator cbegin() const { return _vec.begin(); }
 
@@ -48,8 +48,8 @@ void Permutation::loadFromDisk(
     internalPermutation_ =
         std::make_unique<Permutation>(permutation_, allocator_);
     internalPermutation_->loadFromDisk(
-        absl::StrCat(onDiskBase, QLEVER_INTERNAL_INDEX_INFIX), false);
-    internalPermutation_->permutationType_ = Type::INTERNAL;
+        absl::StrCat(onDiskBase, QLEVER_INTERNAL_INDEX_INFIX), false,
+        Type::INTERNAL);
   }
   if constexpr (MetaData::isMmapBased_) {
     meta_.setup(onDiskBase + ".index" + fileSuffix_ + MMAP_FILE_SUFFIX,
@@ -72,6 +72,11 @@ void Permutation::loadFromDisk(
   // internal permutations always use it.
   bool useGraphPostProcessing = permutationType != Type::MATERIALIZED_VIEW;
   reader_.emplace(allocator_, std::move(file), useGraphPostProcessing);
+  // The accesses are only counted for the (non-internal) permutations of the
+  // index itself (see `BlockAccessHistogram::writeAll`).
+  if (permutationType == Type::NORMAL) {
+    reader_->initializeBlockAccessHistogram(meta_.blockData().size());
+  }
   AD_LOG_INFO << "Registered " << readableName_
               << " permutation: " << meta_.statistics() << std::endl;
   isLoaded_ = true;
@@ -217,10 +222,11 @@ CompressedRelationReader::IdTableGeneratorInputRange Permutation::lazyScan(
     ColumnIndicesRef additionalColumns,
     const CancellationHandle& cancellationHandle,
     const LocatedTriplesState& locatedTriplesState,
-    const LimitOffsetClause& limitOffset) const {
+    const LimitOffsetClause& limitOffset,
+    std::optional<ql::span<const Id>> joinColumn) const {
   return lazyScanImpl(reader(), scanSpecAndBlocks, std::move(optBlocks),
                       additionalColumns, cancellationHandle,
-                      locatedTriplesState, limitOffset);
+                      locatedTriplesState, limitOffset, joinColumn);
 }
 
 // _____________________________________________________________________________
@@ -231,7 +237,8 @@ CompressedRelationReader::IdTableGeneratorInputRange Permutation::lazyScanImpl(
     ColumnIndicesRef additionalColumns,
     const CancellationHandle& cancellationHandle,
     const LocatedTriplesState& locatedTriplesState,
-    const LimitOffsetClause& limitOffset) const {
+    const LimitOffsetClause& limitOffset,
+    std::optional<ql::span<const Id>> joinColumn) const {
   ColumnIndices columns{additionalColumns.begin(), additionalColumns.end()};
   if (!optBlocks.has_value()) {
     optBlocks = CompressedRelationReader::convertBlockMetadataRangesToVector(
@@ -240,7 +247,8 @@ CompressedRelationReader::IdTableGeneratorInputRange Permutation::lazyScanImpl(
   return reader.lazyScan(
       scanSpecAndBlocks.scanSpec_, std::move(optBlocks.value()),
       std::move(columns), cancellationHandle,
-      getLocatedTriplesForPermutation(locatedTriplesState), limitOffset);
+      getLocatedTriplesForPermutation(locatedTriplesState), limitOffset,
+      joinColumn);
 }
 
 // _____________________________________________________________________________
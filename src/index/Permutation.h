@@ -138,6 +138,8 @@ class Permutation {
   //   in `ScanSpecAndBlocks`. The `BlockMetadatRanges` of the
   //   `ScanSpecAndBlocks` are ignored for scanning if `optBlocks` contains the
   //   join-specific prefiltered block metadata.
+  // - If a `joinColumn` is given, only the rows whose first column occurs in
+  //   it are yielded (see `CompressedRelationReader::lazyScan` for details).
   //
   // TODO<joka921> We should only communicate this interface via the
   // `ScanSpecAndBlocksAndBounds` class and make this a strong class that always
@@ -148,7 +150,8 @@ class Permutation {
       ColumnIndicesRef additionalColumns,
       const CancellationHandle& cancellationHandle,
       const LocatedTriplesState& locatedTriplesState,
-      const LimitOffsetClause& limitOffset = {}) const;
+      const LimitOffsetClause& limitOffset = {},
+      std::optional<ql::span<const Id>> joinColumn = std::nullopt) const;
 
   // A lazy scan together with the independent `CompressedRelationReader` it
   // reads from. The `reader_` owns the file handle and allocator that `blocks_`
@@ -271,7 +274,8 @@ class Permutation {
       ColumnIndicesRef additionalColumns,
       const CancellationHandle& cancellationHandle,
       const LocatedTriplesState& locatedTriplesState,
-      const LimitOffsetClause& limitOffset) const;
+      const LimitOffsetClause& limitOffset,
+      std::optional<ql::span<const Id>> joinColumn = std::nullopt) const;
 
   // The base filename of the permutation without the suffix below
   std::string onDiskBase_;
@@ -167,6 +167,23 @@ struct VocabularyMetaData {
   const ad_utility::HashMap<std::string, Id>* globalSpecialIds_ =
       &qlever::specialIds();
 };
+
+// A word from a partial vocabulary together with its position and its byte
+// offset in the file of the partial vocabulary. Every partial vocabulary
+// stores a sorted sample of its words (see `writePartialVocabularyToFile`),
+// which is used to split the merging into ranges that are merged in parallel.
+struct PartialVocabularySample {
+  TripleComponentWithIndex word_;
+  uint64_t positionInFile_ = 0;
+  uint64_t byteOffset_ = 0;
+
+  AD_SERIALIZE_FRIEND_FUNCTION(PartialVocabularySample) {
+    serializer | arg.word_;
+    serializer | arg.positionInFile_;
+    serializer | arg.byteOffset_;
+  }
+};
+
 // _______________________________________________________________
 // Merge the partial vocabularies in the  binary files
 // `basename + PARTIAL_VOCAB_WORDS_INFIX + to_string(i)`
@@ -176,9 +193,15 @@ struct VocabularyMetaData {
 // strings (case-sensitive or not). Argument `wordCallback`
 // is called for each merged word in the vocabulary in the order of their
 // appearance.
+//
+// If the partial vocabularies have samples (see `PartialVocabularySample`),
+// then the words are split into `numRanges` disjoint ranges, which are merged
+// in parallel. The `wordCallback` is still called for all words in order.
 template <typename W, typename C>
-auto mergeVocabulary(const std::string& basename, size_t numFiles, W comparator,
-                     C& wordCallback, ad_utility::MemorySize memoryToUse)
+auto mergeVocabulary(
+    const std::string& basename, size_t numFiles, W comparator,
+    C& wordCallback, ad_utility::MemorySize memoryToUse,
+    size_t numRanges = NUM_PARALLEL_VOCABULARY_MERGE_RANGES)
     -> CPP_ret(VocabularyMetaData)(
         requires WordComparator<W>&& WordCallback<C>);
 
@@ -199,7 +222,8 @@ class VocabularyMerger {
   template <typename W, typename C>
   friend auto mergeVocabulary(const std::string& basename, size_t numFiles,
                               W comparator, C& wordCallback,
-                              ad_utility::MemorySize memoryToUse)
+                              ad_utility::MemorySize memoryToUse,
+                              size_t numRanges)
       -> CPP_ret(VocabularyMetaData)(
           requires WordComparator<W>&& WordCallback<C>);
   VocabularyMerger() = default;
@@ -210,7 +234,7 @@ class VocabularyMerger {
   template <typename W, typename C>
   auto mergeVocabulary(const std::string& basename, size_t numFiles,
                        W comparator, C& wordCallback,
-                       ad_utility::MemorySize memoryToUse)
+                       ad_utility::MemorySize memoryToUse, size_t numRanges)
       -> CPP_ret(VocabularyMetaData)(
           requires WordComparator<W>&& WordCallback<C>);
 
@@ -243,6 +267,63 @@ class VocabularyMerger {
   };
   constexpr static SizeOfQueueWord sizeOfQueueWord{};
 
+  // A distinct word of the merged vocabulary together with the partial
+  // vocabularies in which it occurs and its (partial) IDs in them.
+  struct MergedWord {
+    TripleComponentWithIndex entry_;
+    std::vector<std::pair<uint64_t, uint64_t>> partialFileIdsAndIds_;
+
+    AD_SERIALIZE_FRIEND_FUNCTION(MergedWord) {
+      serializer | arg.entry_;
+      serializer | arg.partialFileIdsAndIds_;
+    }
+  };
+
+  // The samples of all the partial vocabularies and the words at which the
+  // merging is split into ranges. If `splitWords_` is empty, then there is
+  // only a single range.
+  struct SplitWords {
+    std::vector<std::vector<PartialVocabularySample>> samplesPerFile_;
+    std::vector<TripleComponentWithIndex> splitWords_;
+  };
+
+  // Read the samples of the partial vocabularies and choose the words at which
+  // the merging is split into (at most) `numRanges` ranges of approximately
+  // equal size.
+  template <typename L>
+  static SplitWords computeSplitWords(const std::string& basename,
+                                      size_t numFiles, size_t numRanges,
+                                      const L& lessThan);
+
+  // Merge the `wordRanges` (which all contain only words of the same range)
+  // and write the distinct `MergedWord`s to the file `filename`.
+  template <typename R, typename L>
+  static void mergeRange(const std::string& filename,
+                         std::vector<R> wordRanges,
+                         ad_utility::MemorySize memoryToUse, const L& lessThan);
+
+  // Read the `MergedWord`s from the file `filename`, which was written by
+  // `mergeRange`, add them to the vocabulary, and write their IDs to the
+  // `idMaps_`.
+  template <typename C>
+  void writeMergedRangeToIdMap(const std::string& filename, C& wordCallback,
+                               ad_utility::ProgressBar& progressBar);
+
+  // Set the index of the `word` in the merged vocabulary (which is computed
+  // via the `wordCallback` for all words except for blank nodes) and update the
+  // `progressBar`.
+  template <typename C>
+  void addWordToVocabulary(TripleComponentWithIndex& word, C& wordCallback,
+                           ad_utility::ProgressBar& progressBar);
+
+  // Return the `Id` of the `word`, the index of which has been set by
+  // `addWordToVocabulary`.
+  static Id getGlobalId(const TripleComponentWithIndex& word) {
+    return word.isBlankNode()
+               ? Id::makeFromBlankNodeIndex(BlankNodeIndex::make(word.index_))
+               : Id::makeFromVocabIndex(VocabIndex::make(word.index_));
+  }
+
   // Write the queue words in the buffer to their corresponding `idMaps`.
   // The `QueueWord`s must be passed in alphabetical order wrt `lessThan` (also
   // across multiple calls).
@@ -295,6 +376,9 @@ void writeMappedIdsToExtVec(
  * For each string first writes the size of the string (64 bits). Then the
  * actual string content (no trailing zero) and then the Id (sizeof(Id)
  *
+ * Additionally writes every `PARTIAL_VOCAB_SAMPLE_DISTANCE()`-th word as a
+ * `PartialVocabularySample` to `fileName + PARTIAL_VOCAB_SAMPLES_SUFFIX`.
+ *
  * @param els The input
  * @param fileName will write to this file. If it exists it will be overwritten
  */
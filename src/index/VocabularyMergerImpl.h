@@ -5,6 +5,9 @@
 #ifndef QLEVER_SRC_INDEX_VOCABULARYMERGERIMPL_H
 #define QLEVER_SRC_INDEX_VOCABULARYMERGERIMPL_H
 
+#include <absl/cleanup/cleanup.h>
+
+#include <filesystem>
 #include <future>
 #include <string>
 #include <utility>
@@ -14,8 +17,10 @@
 #include "index/ConstantsIndexBuilding.h"
 #include "index/VocabularyMerger.h"
 #include "util/Exception.h"
+#include "util/File.h"
 #include "util/HashMap.h"
 #include "util/InputRangeUtils.h"
+#include "util/Iterators.h"
 #include "util/Log.h"
 #include "util/ParallelMultiwayMerge.h"
 #include "util/ProgressBar.h"
@@ -29,12 +34,12 @@ namespace ad_utility::vocabulary_merger {
 template <typename W, typename C>
 auto mergeVocabulary(const std::string& basename, size_t numFiles, W comparator,
                      C& internalWordCallback,
-                     ad_utility::MemorySize memoryToUse)
+                     ad_utility::MemorySize memoryToUse, size_t numRanges)
     -> CPP_ret(VocabularyMetaData)(
         requires WordComparator<W>&& WordCallback<C>) {
   VocabularyMerger merger;
   return merger.mergeVocabulary(basename, numFiles, std::move(comparator),
-                                internalWordCallback, memoryToUse);
+                                internalWordCallback, memoryToUse, numRanges);
 }
 
 // _________________________________________________________________
@@ -42,7 +47,8 @@ template <typename W, typename C>
 auto VocabularyMerger::mergeVocabulary(const std::string& basename,
                                        size_t numFiles, W comparator,
                                        C& wordCallback,
-                                       ad_utility::MemorySize memoryToUse)
+                                       ad_utility::MemorySize memoryToUse,
+                                       size_t numRanges)
     -> CPP_ret(VocabularyMetaData)(
         requires WordComparator<W>&& WordCallback<C>) {
   // Return true iff p1 >= p2 according to the lexicographic order of the IRI
@@ -57,42 +63,122 @@ auto VocabularyMerger::mergeVocabulary(const std::string& basename,
     return lessThan(p1.entry_, p2.entry_);
   };
 
-  // Open and prepare all infiles and file-based output vectors.
-  auto makeWordRangeFromFile = [&basename](size_t fileIndex) {
+  auto splitResult = computeSplitWords(basename, numFiles, numRanges, lessThan);
+  const auto& samplesPerFile = splitResult.samplesPerFile_;
+  const auto& splitWords = splitResult.splitWords_;
+  const size_t actualNumRanges = splitWords.size() + 1;
+
+  // Open and prepare all infiles and file-based output vectors. The range
+  // for a given `fileIndex` and `rangeIndex` yields all the words from the
+  // partial vocabulary that are `>=` the previous split word and `<` the next
+  // split word.
+  auto makeWordRangeFromFile = [&basename, &lessThan, &samplesPerFile,
+                                &splitWords](size_t fileIndex,
+                                             size_t rangeIndex) {
     ad_utility::serialization::FileReadSerializer infile{
         absl::StrCat(basename, PARTIAL_VOCAB_WORDS_INFIX, fileIndex)};
     uint64_t numWords;
     infile >> numWords;
+    uint64_t position = 0;
+
+    std::optional<TripleComponentWithIndex> lowerBound;
+    std::optional<TripleComponentWithIndex> upperBound;
+    if (rangeIndex > 0) {
+      lowerBound = splitWords.at(rangeIndex - 1);
+      // Start reading at the last sample that is smaller than the lower bound.
+      const auto& samples = samplesPerFile.at(fileIndex);
+      auto it = ql::ranges::partition_point(
+          samples, [&](const PartialVocabularySample& sample) {
+            return lessThan(sample.word_, lowerBound.value());
+          });
+      if (it != samples.begin()) {
+        --it;
+        infile.setSerializationPosition(it->byteOffset_);
+        position = it->positionInFile_;
+      }
+    }
+    if (rangeIndex < splitWords.size()) {
+      upperBound = splitWords.at(rangeIndex);
+    }
 
-    return ad_utility::CachingTransformInputRange{
-        ad_utility::integerRange(numWords),
-        [fileIndex, infile{std::move(infile)}](
-            [[maybe_unused]] const std::size_t i) mutable {
-          TripleComponentWithIndex val;
-          infile >> val;
-          return QueueWord{std::move(val), fileIndex};
+    return ad_utility::InputRangeFromGetCallable{
+        [fileIndex, infile{std::move(infile)}, numWords, position, lowerBound,
+         upperBound, &lessThan]() mutable -> std::optional<QueueWord> {
+          while (position < numWords) {
+            TripleComponentWithIndex val;
+            infile >> val;
+            ++position;
+            if (lowerBound.has_value() && lessThan(val, lowerBound.value())) {
+              continue;
+            }
+            if (upperBound.has_value() && !lessThan(val, upperBound.value())) {
+              position = numWords;
+              return std::nullopt;
+            }
+            return QueueWord{std::move(val), fileIndex};
+          }
+          return std::nullopt;
         }};
   };
-  std::vector<decltype(makeWordRangeFromFile(0))> generators;
-  generators.reserve(numFiles);
+  auto makeWordRanges = [&makeWordRangeFromFile, numFiles](size_t rangeIndex) {
+    std::vector<decltype(makeWordRangeFromFile(0, 0))> generators;
+    generators.reserve(numFiles);
+    for (std::size_t i : ad_utility::integerRange(numFiles)) {
+      generators.push_back(makeWordRangeFromFile(i, rangeIndex));
+    }
+    return generators;
+  };
 
   for (std::size_t i : ad_utility::integerRange(numFiles)) {
-    generators.push_back(makeWordRangeFromFile(i));
     idMaps_.emplace_back(absl::StrCat(basename, PARTIAL_VOCAB_IDMAP_INFIX, i));
   }
 
+  ad_utility::ProgressBar progressBar{metaData_.numWordsTotal(),
+                                      "Words merged: "};
   // Some memory (that is hard to measure exactly) is used for the writing of
   // a batch of merged words, so we only give 80% of the total memory to the
   // merging. This is very approximate and should be investigated in more
   // detail.
-  auto mergedWords =
-      ad_utility::parallelMultiwayMerge<QueueWord, true,
-                                        decltype(sizeOfQueueWord)>(
-          0.8 * memoryToUse, std::move(generators), lessThanForQueue);
-  ad_utility::ProgressBar progressBar{metaData_.numWordsTotal(),
-                                      "Words merged: "};
-  for (std::vector<QueueWord>& currentWords : mergedWords) {
-    writeQueueWordsToIdMap(currentWords, wordCallback, lessThan, progressBar);
+  if (actualNumRanges == 1) {
+    auto mergedWords =
+        ad_utility::parallelMultiwayMerge<QueueWord, true,
+                                          decltype(sizeOfQueueWord)>(
+            0.8 * memoryToUse, makeWordRanges(0), lessThanForQueue);
+    for (std::vector<QueueWord>& currentWords : mergedWords) {
+      writeQueueWordsToIdMap(currentWords, wordCallback, lessThan,
+                             progressBar);
+    }
+  } else {
+    // The ranges are merged in parallel and written to temporary files. The
+    // words have to be added to the vocabulary in order, so this happens
+    // range by range as soon as the respective range is merged.
+    AD_LOG_INFO << "Merging the vocabulary in " << actualNumRanges
+                << " ranges in parallel ..." << std::endl;
+    auto rangeFilename = [&basename](size_t rangeIndex) {
+      return absl::StrCat(basename, MERGED_VOCAB_RANGE_INFIX, rangeIndex);
+    };
+    // Also remove the temporary files if the merging fails. This cleanup is
+    // declared before the `mergedRanges`, s.t. it only runs after all the
+    // ranges have finished writing to their files.
+    absl::Cleanup deleteRangeFiles{[&rangeFilename, actualNumRanges]() {
+      for (size_t rangeIndex : ad_utility::integerRange(actualNumRanges)) {
+        ad_utility::deleteFile(rangeFilename(rangeIndex), false);
+      }
+    }};
+    std::vector<std::future<void>> mergedRanges;
+    for (size_t rangeIndex : ad_utility::integerRange(actualNumRanges)) {
+      mergedRanges.push_back(std::async(
+          std::launch::async, [&, rangeIndex]() {
+            mergeRange(rangeFilename(rangeIndex), makeWordRanges(rangeIndex),
+                       0.8 * memoryToUse / actualNumRanges, lessThan);
+          }));
+    }
+    for (size_t rangeIndex : ad_utility::integerRange(actualNumRanges)) {
+      mergedRanges.at(rangeIndex).get();
+      writeMergedRangeToIdMap(rangeFilename(rangeIndex), wordCallback,
+                              progressBar);
+      ad_utility::deleteFile(rangeFilename(rangeIndex));
+    }
   }
 
   AD_LOG_INFO << progressBar.getFinalProgressString() << std::flush;
@@ -103,6 +189,135 @@ auto VocabularyMerger::mergeVocabulary(const std::string& basename,
   return metaData;
 }
 
+// _____________________________________________________________________________
+template <typename L>
+auto VocabularyMerger::computeSplitWords(const std::string& basename,
+                                         size_t numFiles, size_t numRanges,
+                                         const L& lessThan) -> SplitWords {
+  SplitWords result;
+  if (numRanges <= 1) {
+    return result;
+  }
+  for (size_t i : ad_utility::integerRange(numFiles)) {
+    auto filename = absl::StrCat(basename, PARTIAL_VOCAB_WORDS_INFIX, i,
+                                 PARTIAL_VOCAB_SAMPLES_SUFFIX);
+    // Partial vocabularies without samples are merged as a single range.
+    if (!std::filesystem::exists(filename)) {
+      return SplitWords{};
+    }
+    ad_utility::serialization::FileReadSerializer infile{filename};
+    infile >> result.samplesPerFile_.emplace_back();
+  }
+
+  std::vector<TripleComponentWithIndex> allSamples;
+  for (const auto& samples : result.samplesPerFile_) {
+    for (const auto& sample : samples) {
+      allSamples.push_back(sample.word_);
+    }
+  }
+  if (allSamples.empty()) {
+    return result;
+  }
+  ql::ranges::sort(allSamples, lessThan);
+  for (size_t rangeIndex = 1; rangeIndex < numRanges; ++rangeIndex) {
+    auto& word =
+        allSamples.at(allSamples.size() * rangeIndex / numRanges).iriOrLiteral();
+    auto& splitWords = result.splitWords_;
+    if (!splitWords.empty() && splitWords.back().iriOrLiteral() == word) {
+      continue;
+    }
+    // Occurrences of the same word with different values for `isExternal` have
+    // to be in the same range. An external word is smaller than the same word
+    // that is not external, so the split words are always external.
+    splitWords.push_back(TripleComponentWithIndex{word, true, 0});
+  }
+  return result;
+}
+
+// _____________________________________________________________________________
+template <typename R, typename L>
+void VocabularyMerger::mergeRange(const std::string& filename,
+                                  std::vector<R> wordRanges,
+                                  ad_utility::MemorySize memoryToUse,
+                                  const L& lessThan) {
+  auto lessThanForQueue = [&lessThan](const QueueWord& p1,
+                                      const QueueWord& p2) {
+    return lessThan(p1.entry_, p2.entry_);
+  };
+  auto mergedWords =
+      ad_utility::parallelMultiwayMerge<QueueWord, true,
+                                        decltype(sizeOfQueueWord)>(
+          memoryToUse, std::move(wordRanges), lessThanForQueue);
+  ad_utility::serialization::VectorIncrementalSerializer<
+      MergedWord, ad_utility::serialization::FileWriteSerializer>
+      outfile{ad_utility::serialization::FileWriteSerializer{filename}};
+
+  // Iterate (avoid duplicates).
+  std::optional<MergedWord> current;
+  for (std::vector<QueueWord>& currentWords : mergedWords) {
+    for (QueueWord& top : currentWords) {
+      std::pair<uint64_t, uint64_t> partialFileIdAndId{top.partialFileId_,
+                                                       top.id()};
+      if (current.has_value() &&
+          top.iriOrLiteral() == current.value().entry_.iriOrLiteral()) {
+        // If a word appears with different values for `isExternal`, then we
+        // externalize it.
+        bool& external = current.value().entry_.isExternal();
+        external = external || top.isExternal();
+      } else {
+        if (current.has_value()) {
+          AD_CORRECTNESS_CHECK(lessThan(current.value().entry_, top.entry_),
+                               "Total vocabulary order violated for ",
+                               current.value().entry_.iriOrLiteral(), " and ",
+                               top.iriOrLiteral());
+          outfile.push(current.value());
+        }
+        current = MergedWord{std::move(top.entry_), {}};
+      }
+      current.value().partialFileIdsAndIds_.push_back(partialFileIdAndId);
+    }
+  }
+  if (current.has_value()) {
+    outfile.push(current.value());
+  }
+}
+
+// _____________________________________________________________________________
+template <typename C>
+void VocabularyMerger::writeMergedRangeToIdMap(
+    const std::string& filename, C& wordCallback,
+    ad_utility::ProgressBar& progressBar) {
+  ad_utility::serialization::FileReadSerializer infile{filename};
+  uint64_t numWords;
+  infile >> numWords;
+  for ([[maybe_unused]] uint64_t i : ad_utility::integerRange(numWords)) {
+    MergedWord word;
+    infile >> word;
+    addWordToVocabulary(word.entry_, wordCallback, progressBar);
+    Id targetId = getGlobalId(word.entry_);
+    for (const auto& [partialFileId, id] : word.partialFileIdsAndIds_) {
+      idMaps_.at(partialFileId)
+          .push_back({Id::makeFromVocabIndex(VocabIndex::make(id)), targetId});
+    }
+  }
+}
+
+// _____________________________________________________________________________
+template <typename C>
+void VocabularyMerger::addWordToVocabulary(
+    TripleComponentWithIndex& word, C& wordCallback,
+    ad_utility::ProgressBar& progressBar) {
+  if (word.isBlankNode()) {
+    word.index_ = metaData_.getNextBlankNodeIndex();
+  } else {
+    word.index_ = wordCallback(word.iriOrLiteral(), word.isExternal());
+    metaData_.addWord(word.iriOrLiteral(), word.index_);
+  }
+  if (progressBar.update()) {
+    AD_LOG_INFO << progressBar.getProgressString() << std::flush;
+  }
+}
+
 // ________________________________________________________________________________
 CPP_template_def(typename C, typename L)(
     requires WordCallback<C> CPP_and_def
@@ -132,28 +347,15 @@ CPP_template_def(typename C, typename L)(
       // idVecs to have a more useful external access pattern.
 
       // Write the new word to the vocabulary.
-      auto& nextWord = lastTripleComponent_.value();
-      if (nextWord.isBlankNode()) {
-        nextWord.index_ = metaData_.getNextBlankNodeIndex();
-      } else {
-        nextWord.index_ =
-            wordCallback(nextWord.iriOrLiteral(), nextWord.isExternal());
-        metaData_.addWord(nextWord.iriOrLiteral(), nextWord.index_);
-      }
-      if (progressBar.update()) {
-        AD_LOG_INFO << progressBar.getProgressString() << std::flush;
-      }
+      addWordToVocabulary(lastTripleComponent_.value(), wordCallback,
+                          progressBar);
     } else {
       // If a word appears with different values for `isExternal`, then we
       // externalize it.
       bool& external = lastTripleComponent_.value().isExternal();
       external = external || top.isExternal();
     }
-    const auto& word = lastTripleComponent_.value();
-    Id targetId =
-        word.isBlankNode()
-            ? Id::makeFromBlankNodeIndex(BlankNodeIndex::make(word.index_))
-            : Id::makeFromVocabIndex(VocabIndex::make(word.index_));
+    Id targetId = getGlobalId(lastTripleComponent_.value());
     // Write pair of local and global ID to buffer.
     idMaps_[top.partialFileId_].push_back(
         {Id::makeFromVocabIndex(VocabIndex::make(top.id())), targetId});
@@ -228,17 +430,31 @@ inline void writePartialVocabularyToFile(const ItemVec& els,
   uint64_t size = els.size();
   byteBuffer << size;
 
+  uint64_t numBytesWritten = 0;
   auto flush = [&]() {
     ad_utility::TimeBlockAndLog t{"performing the actual write"};
     serializer.serializeBytes(byteBuffer.data().data(),
                               byteBuffer.data().size());
+    numBytesWritten += byteBuffer.data().size();
     byteBuffer.clear();
   };
 
+  std::vector<PartialVocabularySample> samples;
+  const size_t sampleDistance = PARTIAL_VOCAB_SAMPLE_DISTANCE();
+  uint64_t positionInFile = 0;
+
   // This is essentially a `VectorIncrementalSerializer` with a custom
   // serialization function, which the infrastructure currently does not
   // support.
   for (const auto& [word, idAndExternal] : els) {
+    if (positionInFile % sampleDistance == 0) {
+      samples.push_back(PartialVocabularySample{
+          TripleComponentWithIndex{std::string{word},
+                                   idAndExternal.isExternal(),
+                                   idAndExternal.id()},
+          positionInFile, numBytesWritten + byteBuffer.data().size()});
+    }
+    ++positionInFile;
     // When merging the vocabulary, we need the actual word, the (internal) id
     // we have assigned to this word, and the information, whether this word
     // belongs to the internal or external vocabulary.
@@ -255,6 +471,10 @@ inline void writePartialVocabularyToFile(const ItemVec& els,
   flush();
   serializer.close();
 
+  ad_utility::serialization::FileWriteSerializer samplesSerializer{
+      absl::StrCat(fileName, PARTIAL_VOCAB_SAMPLES_SUFFIX)};
+  samplesSerializer << samples;
+
   AD_LOG_DEBUG << "Done writing partial vocabulary\n";
 }
 
@@ -84,8 +84,19 @@ void Qlever::buildIndex(IndexBuilderConfig config) {
 
   // Build text index if requested (various options).
   if (!config.onlyAddTextIndex_) {
-    AD_CONTRACT_CHECK(!config.inputFiles_.empty());
-    index.createFromFiles(config.inputFiles_);
+    if (!config.shardsToMerge_.empty()) {
+      index.createFromShards(config.shardsToMerge_);
+    } else if (config.shardIndex_.has_value()) {
+      // A shard is not a usable index on its own, so there is nothing more to
+      // do until all shards have been merged.
+      AD_CONTRACT_CHECK(!config.inputFiles_.empty());
+      index.createShardFromFiles(config.inputFiles_,
+                                 config.shardIndex_.value());
+      return;
+    } else {
+      AD_CONTRACT_CHECK(!config.inputFiles_.empty());
+      index.createFromFiles(config.inputFiles_);
+    }
   }
 
   if (config.wordsAndDocsFileSpecified() || config.addWordsFromLiterals_) {
@@ -216,6 +227,22 @@ void IndexBuilderConfig::validate() const {
         "text index. If none are given the option to add words from literals "
         "has to be true. For details see --help."));
   }
+  if (shardIndex_.has_value() && !shardsToMerge_.empty()) {
+    throw std::runtime_error(
+        "A single shard can't be built at the same time as shards are "
+        "merged.");
+  }
+  if (!shardsToMerge_.empty() && !inputFiles_.empty()) {
+    throw std::runtime_error(
+        "When the index is built from shards, no input files must be given.");
+  }
+  if (shardIndex_.has_value() &&
+      (onlyAddTextIndex_ || wordsAndDocsFileSpecified() ||
+       addWordsFromLiterals_ || !writeMaterializedViews_.empty())) {
+    throw std::runtime_error(
+        "A text index or materialized views can only be built for the "
+        "complete index, not for a single shard.");
+  }
 }
 
 // ___________________________________________________________________________
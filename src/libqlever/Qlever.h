@@ -116,6 +116,17 @@ struct IndexBuilderConfig : CommonConfig {
   // limitations regarding the correctness of FILTER and ORDER BY.
   std::vector<std::string> prefixesForIdEncodedIris_;
 
+  // Options for a sharded index build, where the input is split into disjoint
+  // shards that are parsed independently (e.g. on different machines), see
+  // `Index::createShardFromFiles` and `Index::createFromShards`. If
+  // `shardIndex_` is set, only the shard with this index is built from the
+  // `inputFiles_` (with `baseName_` as the basename of the shard). If
+  // `shardsToMerge_` is nonempty, the index is built from the shards with these
+  // basenames instead of from the `inputFiles_`. The same settings have to be
+  // used for all shards and for the final merge.
+  std::optional<size_t> shardIndex_;
+  std::vector<std::string> shardsToMerge_;
+
   // The remaining members of this class, are only relevant if a full-text
   // index is built in addition to the RDF index. By default, no fulltext index
   // is built. The full-text index enables efficient keyword search in text
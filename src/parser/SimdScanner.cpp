@@ -0,0 +1,117 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#include "parser/SimdScanner.h"
+
+#include <array>
+#include <cstdint>
+
+#include "util/Exception.h"
+
+#ifdef QLEVER_SIMD_X86_64
+#include <immintrin.h>
+#endif
+
+namespace ad_utility::simdScanner {
+
+namespace {
+// The characters that must not occur in an IRIREF, in addition to the
+// characters from 0x00 to 0x20.
+constexpr std::array<char, 9> forbiddenIrirefCharacters{'<', '>', '"', '{', '}',
+                                                        '|', '^', '`', '\\'};
+
+constexpr std::array<bool, 256> isNonIrirefCharacter = []() {
+  std::array<bool, 256> result{};
+  for (size_t c = 0; c <= 0x20; ++c) {
+    result[c] = true;
+  }
+  for (char c : forbiddenIrirefCharacters) {
+    result[static_cast<unsigned char>(c)] = true;
+  }
+  return result;
+}();
+
+// _____________________________________________________________________________
+size_t findFirstNonIrirefCharacterScalar(std::string_view input, size_t pos) {
+  for (; pos < input.size(); ++pos) {
+    if (isNonIrirefCharacter[static_cast<unsigned char>(input[pos])]) {
+      return pos;
+    }
+  }
+  return input.size();
+}
+
+#ifdef QLEVER_SIMD_X86_64
+// _____________________________________________________________________________
+size_t findFirstNonIrirefCharacterSse2(std::string_view input) {
+  constexpr size_t blockSize = 16;
+  const __m128i space = _mm_set1_epi8(0x20);
+  size_t pos = 0;
+  for (; pos + blockSize <= input.size(); pos += blockSize) {
+    __m128i block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(input.data() + pos));
+    // The unsigned maximum with the space equals the space iff the character
+    // is at most 0x20.
+    __m128i isSpecial = _mm_cmpeq_epi8(_mm_max_epu8(block, space), space);
+    for (char c : forbiddenIrirefCharacters) {
+      isSpecial =
+          _mm_or_si128(isSpecial, _mm_cmpeq_epi8(block, _mm_set1_epi8(c)));
+    }
+    auto mask = static_cast<uint32_t>(_mm_movemask_epi8(isSpecial));
+    if (mask != 0) {
+      return pos + static_cast<size_t>(__builtin_ctz(mask));
+    }
+  }
+  return findFirstNonIrirefCharacterScalar(input, pos);
+}
+
+// _____________________________________________________________________________
+__attribute__((target("avx2"))) size_t findFirstNonIrirefCharacterAvx2(
+    std::string_view input) {
+  constexpr size_t blockSize = 32;
+  const __m256i space = _mm256_set1_epi8(0x20);
+  size_t pos = 0;
+  for (; pos + blockSize <= input.size(); pos += blockSize) {
+    __m256i block = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(input.data() + pos));
+    // See `findFirstNonIrirefCharacterSse2` above.
+    __m256i isSpecial =
+        _mm256_cmpeq_epi8(_mm256_max_epu8(block, space), space);
+    for (char c : forbiddenIrirefCharacters) {
+      isSpecial = _mm256_or_si256(isSpecial,
+                                  _mm256_cmpeq_epi8(block, _mm256_set1_epi8(c)));
+    }
+    auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(isSpecial));
+    if (mask != 0) {
+      return pos + static_cast<size_t>(__builtin_ctz(mask));
+    }
+  }
+  return findFirstNonIrirefCharacterScalar(input, pos);
+}
+#endif
+}  // namespace
+
+// _____________________________________________________________________________
+InstructionSet bestSupportedInstructionSet() {
+  static const InstructionSet best = ad_utility::bestSupportedInstructionSet(
+      {InstructionSet::Avx2, InstructionSet::Sse2});
+  return best;
+}
+
+// _____________________________________________________________________________
+size_t findFirstNonIrirefCharacter(std::string_view input,
+                                   InstructionSet instructionSet) {
+  AD_EXPENSIVE_CHECK(isSupported(instructionSet));
+  switch (instructionSet) {
+#ifdef QLEVER_SIMD_X86_64
+    case InstructionSet::Sse2:
+      return findFirstNonIrirefCharacterSse2(input);
+    case InstructionSet::Avx2:
+      return findFirstNonIrirefCharacterAvx2(input);
+#endif
+    default:
+      return findFirstNonIrirefCharacterScalar(input, 0);
+  }
+}
+
+}  // namespace ad_utility::simdScanner
@@ -0,0 +1,37 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#ifndef QLEVER_SRC_PARSER_SIMDSCANNER_H
+#define QLEVER_SRC_PARSER_SIMDSCANNER_H
+
+#include <cstddef>
+#include <string_view>
+
+#include "util/SimdInstructionSet.h"
+
+// Kernels that scan the input of the RDF parsers for special characters, 16
+// or 32 bytes at a time (in the style of `simdjson`). This is much cheaper than
+// matching a regex for the most frequent tokens of N-Triples and N-Quads
+// input, which is read by the index builder. The kernels use SSE2 or AVX2 if
+// the CPU supports it (see `SimdInstructionSet.h`).
+namespace ad_utility::simdScanner {
+
+// Return the best instruction set for the kernels below that is supported by
+// the CPU. The result is computed once and then cached.
+InstructionSet bestSupportedInstructionSet();
+
+// Return the position of the first character in `input` that must not occur
+// in an IRIREF (without escape sequences), or `input.size()` if there is no
+// such character. These are the characters `<>"{}|^`\` and all characters
+// from 0x00 to 0x20 (in particular, the space and the newline). Bytes that are
+// part of a multibyte UTF-8 character are always allowed.
+//
+// NOTE: If the result is the position of a `>` and `input` starts right after
+// a `<`, then the IRIREF is standard-compliant (see `TurtleParser::iriref`).
+size_t findFirstNonIrirefCharacter(
+    std::string_view input,
+    InstructionSet instructionSet = bestSupportedInstructionSet());
+
+}  // namespace ad_utility::simdScanner
+
+#endif  // QLEVER_SRC_PARSER_SIMDSCANNER_H
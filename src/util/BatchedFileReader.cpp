@@ -0,0 +1,269 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#include "util/BatchedFileReader.h"
+
+#include <absl/strings/str_cat.h>
+#include <sys/uio.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+
+#include "backports/algorithm.h"
+#include "util/Exception.h"
+#include "util/jthread.h"
+
+#ifdef QLEVER_USE_IO_URING
+#include <liburing.h>
+#endif
+
+namespace ad_utility {
+
+namespace {
+
+// The maximal number of buffers for a single vectored read.
+constexpr size_t maxNumIovecs = IOV_MAX;
+
+// A single vectored read of `numBytes_` contiguous bytes starting at the
+// `offset_` of a file.
+struct CoalescedRead {
+  off_t offset_;
+  size_t numBytes_;
+  std::vector<iovec> iovecs_;
+
+  explicit CoalescedRead(const std::vector<FileReadRequest>& requests)
+      : offset_{requests.front().offset_}, numBytes_{0} {
+    iovecs_.reserve(requests.size());
+    for (const auto& request : requests) {
+      iovecs_.push_back(iovec{request.target_, request.size_});
+      numBytes_ += request.size_;
+    }
+  }
+};
+
+// Remove the first `numBytes` from the `iovecs`, starting at index `first`.
+// Return the index of the first `iovec` that still has bytes left.
+size_t advanceIovecs(std::vector<iovec>& iovecs, size_t first,
+                     size_t numBytes) {
+  while (first < iovecs.size() && numBytes >= iovecs[first].iov_len) {
+    numBytes -= iovecs[first].iov_len;
+    ++first;
+  }
+  if (first < iovecs.size()) {
+    auto& iov = iovecs[first];
+    iov.iov_base = static_cast<char*>(iov.iov_base) + numBytes;
+    iov.iov_len -= numBytes;
+  } else {
+    AD_CORRECTNESS_CHECK(numBytes == 0);
+  }
+  return first;
+}
+
+// Read the bytes of the `read` that remain after the first `numBytesDone`
+// bytes using (possibly several calls to) `preadv`.
+void preadvRemainder(int fd, CoalescedRead& read, size_t numBytesDone) {
+  size_t first = advanceIovecs(read.iovecs_, 0, numBytesDone);
+  off_t offset = read.offset_ + static_cast<off_t>(numBytesDone);
+  while (first < read.iovecs_.size()) {
+    ssize_t numBytesRead =
+        preadv(fd, read.iovecs_.data() + first,
+               static_cast<int>(read.iovecs_.size() - first), offset);
+    if (numBytesRead < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      throw std::runtime_error{absl::StrCat(
+          "Reading from a file failed: ", std::strerror(errno))};
+    }
+    if (numBytesRead == 0) {
+      throw std::runtime_error{
+          "Reading from a file failed: Unexpected end of file"};
+    }
+    offset += numBytesRead;
+    first = advanceIovecs(read.iovecs_, first,
+                          static_cast<size_t>(numBytesRead));
+  }
+}
+
+// Perform the `reads` using `preadv` on up to `numThreads` threads.
+void readUsingThreads(int fd, std::vector<CoalescedRead>& reads,
+                      size_t numThreads) {
+  numThreads = std::clamp<size_t>(numThreads, 1, reads.size());
+  std::atomic<size_t> nextRead = 0;
+  std::mutex exceptionMutex;
+  std::exception_ptr exception;
+  auto work = [&]() {
+    try {
+      for (size_t i = nextRead++; i < reads.size(); i = nextRead++) {
+        preadvRemainder(fd, reads[i], 0);
+      }
+    } catch (...) {
+      std::lock_guard lock{exceptionMutex};
+      if (!exception) {
+        exception = std::current_exception();
+      }
+    }
+  };
+  {
+    std::vector<JThread> threads;
+    threads.reserve(numThreads - 1);
+    for (size_t i = 1; i < numThreads; ++i) {
+      threads.emplace_back(work);
+    }
+    work();
+  }
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+}
+
+#ifdef QLEVER_USE_IO_URING
+// An `io_uring` that is used by a single thread.
+class IoUring {
+  static constexpr unsigned queueDepth = 64;
+  io_uring ring_;
+  bool isValid_;
+
+ public:
+  IoUring() : isValid_{io_uring_queue_init(queueDepth, &ring_, 0) == 0} {}
+  ~IoUring() {
+    if (isValid_) {
+      io_uring_queue_exit(&ring_);
+    }
+  }
+  IoUring(const IoUring&) = delete;
+  IoUring& operator=(const IoUring&) = delete;
+
+  bool isValid() const { return isValid_; }
+
+  // Perform all the `reads`. Up to `queueDepth` reads are in flight at the
+  // same time. Short reads are completed synchronously.
+  void read(int fd, std::vector<CoalescedRead>& reads) {
+    AD_CORRECTNESS_CHECK(isValid_);
+    size_t numSubmitted = 0;
+    size_t numCompleted = 0;
+    std::exception_ptr exception;
+    while (numCompleted < reads.size()) {
+      // Fill the submission queue.
+      while (numSubmitted < reads.size() && !exception) {
+        io_uring_sqe* sqe = io_uring_get_sqe(&ring_);
+        if (sqe == nullptr) {
+          break;
+        }
+        auto& read = reads[numSubmitted];
+        io_uring_prep_readv(sqe, fd, read.iovecs_.data(),
+                            static_cast<unsigned>(read.iovecs_.size()),
+                            read.offset_);
+        io_uring_sqe_set_data(sqe, &read);
+        ++numSubmitted;
+      }
+      if (numSubmitted == numCompleted) {
+        // Nothing is in flight anymore (after an error).
+        break;
+      }
+      int result = io_uring_submit_and_wait(&ring_, 1);
+      if (result < 0 && result != -EINTR) {
+        // The reads that have already been submitted might still write to the
+        // buffers, so we can't recover from this.
+        AD_FAIL();
+      }
+      // Process all the available completions.
+      io_uring_cqe* cqe;
+      while (io_uring_peek_cqe(&ring_, &cqe) == 0) {
+        auto& read = *static_cast<CoalescedRead*>(io_uring_cqe_get_data(cqe));
+        int numBytesRead = cqe->res;
+        io_uring_cqe_seen(&ring_, cqe);
+        ++numCompleted;
+        try {
+          if (numBytesRead < 0) {
+            throw std::runtime_error{absl::StrCat(
+                "Reading from a file via io_uring failed: ",
+                std::strerror(-numBytesRead))};
+          }
+          if (static_cast<size_t>(numBytesRead) < read.numBytes_) {
+            preadvRemainder(fd, read, static_cast<size_t>(numBytesRead));
+          }
+        } catch (...) {
+          if (!exception) {
+            exception = std::current_exception();
+          }
+        }
+      }
+    }
+    if (exception) {
+      std::rethrow_exception(exception);
+    }
+  }
+};
+
+// Each thread uses its own ring, so no synchronization is required.
+IoUring& getThreadLocalRing() {
+  thread_local IoUring ring;
+  return ring;
+}
+#endif
+
+}  // namespace
+
+// _____________________________________________________________________________
+std::vector<std::vector<FileReadRequest>> BatchedFileReader::coalesce(
+    std::vector<FileReadRequest> requests) {
+  ql::erase_if(requests, [](const auto& r) { return r.size_ == 0; });
+  ql::ranges::sort(requests, std::less{}, &FileReadRequest::offset_);
+  std::vector<std::vector<FileReadRequest>> result;
+  for (const auto& request : requests) {
+    if (!result.empty()) {
+      auto& run = result.back();
+      const auto& last = run.back();
+      AD_CONTRACT_CHECK(last.offset_ + static_cast<off_t>(last.size_) <=
+                        request.offset_);
+      if (last.offset_ + static_cast<off_t>(last.size_) == request.offset_ &&
+          run.size() < maxNumIovecs) {
+        run.push_back(request);
+        continue;
+      }
+    }
+    result.push_back({request});
+  }
+  return result;
+}
+
+// _____________________________________________________________________________
+void BatchedFileReader::read(const File& file,
+                             std::vector<FileReadRequest> requests) const {
+  std::vector<CoalescedRead> reads;
+  for (const auto& run : coalesce(std::move(requests))) {
+    reads.emplace_back(run);
+  }
+  if (reads.empty()) {
+    return;
+  }
+  const int fd = file.fileDescriptor();
+#ifdef QLEVER_USE_IO_URING
+  // A single read is performed directly, because the setup of the `io_uring`
+  // submission doesn't pay off.
+  if (reads.size() > 1 && getThreadLocalRing().isValid()) {
+    getThreadLocalRing().read(fd, reads);
+    return;
+  }
+#endif
+  readUsingThreads(fd, reads, numFallbackThreads_);
+}
+
+// _____________________________________________________________________________
+BatchedFileReader::Backend BatchedFileReader::backend() {
+#ifdef QLEVER_USE_IO_URING
+  if (getThreadLocalRing().isValid()) {
+    return Backend::IoUring;
+  }
+#endif
+  return Backend::ThreadPool;
+}
+
+}  // namespace ad_utility
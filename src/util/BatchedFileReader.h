@@ -0,0 +1,68 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#ifndef QLEVER_SRC_UTIL_BATCHEDFILEREADER_H
+#define QLEVER_SRC_UTIL_BATCHEDFILEREADER_H
+
+#include <sys/types.h>
+
+#include <cstddef>
+#include <vector>
+
+#include "util/File.h"
+
+namespace ad_utility {
+
+// A single read of `size_` bytes at the `offset_` of a file into the buffer
+// that starts at `target_`.
+struct FileReadRequest {
+  off_t offset_;
+  size_t size_;
+  char* target_;
+};
+
+// Read many (typically small) ranges of a file, for example the columns of
+// consecutive blocks of a permutation, with as few system calls as possible:
+//
+// 1. Requests for adjacent byte ranges are coalesced into a single vectored
+//    read (`readv`) that scatters the data directly into the target buffers.
+// 2. If QLever was built with `liburing` (see `QLEVER_USE_IO_URING`), all
+//    coalesced reads of a batch are submitted at once to an `io_uring` and the
+//    kernel executes them concurrently. Otherwise (or if `io_uring` is not
+//    available at runtime, e.g. because it is forbidden by a container
+//    runtime), the coalesced reads are distributed over a small number of
+//    threads that use `preadv`.
+class BatchedFileReader {
+ public:
+  // The backend that is used for reading.
+  enum class Backend { IoUring, ThreadPool };
+
+ private:
+  size_t numFallbackThreads_;
+
+ public:
+  // `numFallbackThreads` is the maximal number of threads that are used
+  // concurrently by the `ThreadPool` backend. A value of 0 or 1 means that the
+  // reads are performed by the calling thread.
+  explicit BatchedFileReader(size_t numFallbackThreads = 1)
+      : numFallbackThreads_{numFallbackThreads} {}
+
+  // Perform all the `requests` on the `file` and block until they are
+  // complete. Throw if one of the reads fails or hits the end of the file.
+  // The ranges of the requests must not overlap. Requests of size zero are
+  // ignored.
+  void read(const File& file, std::vector<FileReadRequest> requests) const;
+
+  // Return the backend that is used by the calling thread.
+  static Backend backend();
+
+  // Sort the `requests` by their offset and group them into runs of requests
+  // whose byte ranges are directly adjacent in the file. Each run can then be
+  // performed by a single vectored read. Requests of size zero are removed.
+  static std::vector<std::vector<FileReadRequest>> coalesce(
+      std::vector<FileReadRequest> requests);
+};
+
+}  // namespace ad_utility
+
+#endif  // QLEVER_SRC_UTIL_BATCHEDFILEREADER_H
@@ -0,0 +1,111 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#ifndef QLEVER_SRC_UTIL_BLOOMFILTER_H
+#define QLEVER_SRC_UTIL_BLOOMFILTER_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "backports/three_way_comparison.h"
+#include "util/Exception.h"
+#include "util/Serializer/SerializeVector.h"
+#include "util/Serializer/Serializer.h"
+
+namespace ad_utility {
+
+// A simple Bloom filter for 64-bit keys. `mayContain(key)` is always true if
+// `key` has been added, and is false with a high probability otherwise.
+//
+// The filter is persisted as part of the index (see `CompressedRelation.h`),
+// so the hash functions must not depend on the process or the platform. We
+// therefore use a fixed mixing function instead of `std::hash` or
+// `absl::Hash`, and derive the `numHashFunctions_` positions from two such
+// hashes ("double hashing").
+class BloomFilter {
+ private:
+  std::vector<uint64_t> bits_;
+  uint8_t numHashFunctions_ = 0;
+
+ public:
+  // A default-constructed filter has no bits, `mayContain` then always returns
+  // true.
+  BloomFilter() = default;
+
+  // Create a filter that has (approximately) the given `falsePositiveRate`
+  // when `expectedNumElements` distinct keys are added.
+  BloomFilter(size_t expectedNumElements, double falsePositiveRate) {
+    AD_CONTRACT_CHECK(falsePositiveRate > 0.0 && falsePositiveRate < 1.0);
+    static constexpr double ln2 = 0.6931471805599453;
+    double numElements =
+        static_cast<double>(std::max(expectedNumElements, size_t{1}));
+    double optimalNumBits =
+        -numElements * std::log(falsePositiveRate) / (ln2 * ln2);
+    size_t numWords =
+        std::max(size_t{1}, static_cast<size_t>(std::ceil(optimalNumBits / 64)));
+    bits_.resize(numWords, 0);
+    double optimalNumHashFunctions =
+        static_cast<double>(numBits()) / numElements * ln2;
+    numHashFunctions_ = static_cast<uint8_t>(
+        std::clamp(std::round(optimalNumHashFunctions), 1.0, 16.0));
+  }
+
+  // Add the `key` to the filter.
+  void add(uint64_t key) {
+    AD_CONTRACT_CHECK(!bits_.empty());
+    forEachBitPosition(key, [this](size_t position) {
+      bits_[position / 64] |= uint64_t{1} << (position % 64);
+    });
+  }
+
+  // Return false if the `key` has certainly not been added.
+  bool mayContain(uint64_t key) const {
+    bool result = true;
+    forEachBitPosition(key, [this, &result](size_t position) {
+      result = result && ((bits_[position / 64] >> (position % 64)) & 1);
+    });
+    return result;
+  }
+
+  size_t numBits() const { return bits_.size() * 64; }
+  size_t numHashFunctions() const { return numHashFunctions_; }
+
+  QL_DEFINE_DEFAULTED_EQUALITY_OPERATOR_LOCAL(BloomFilter, bits_,
+                                              numHashFunctions_)
+
+  AD_SERIALIZE_FRIEND_FUNCTION(BloomFilter) {
+    serializer | arg.bits_;
+    serializer | arg.numHashFunctions_;
+  }
+
+ private:
+  // The finalizer of the `SplitMix64` generator, which is a cheap bijection
+  // with good avalanche properties.
+  static constexpr uint64_t mix(uint64_t x) {
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+  }
+
+  // Call `function` for each of the `numHashFunctions_` bit positions of
+  // `key`.
+  template <typename F>
+  void forEachBitPosition(uint64_t key, const F& function) const {
+    if (bits_.empty()) {
+      return;
+    }
+    uint64_t h1 = mix(key);
+    // Make `h2` odd, s.t. the positions don't collapse to a single one.
+    uint64_t h2 = mix(h1 ^ 0x9e3779b97f4a7c15ULL) | 1;
+    uint64_t numBitsTotal = numBits();
+    for (size_t i = 0; i < numHashFunctions_; ++i) {
+      function(static_cast<size_t>((h1 + i * h2) % numBitsTotal));
+    }
+  }
+};
+
+}  // namespace ad_utility
+
+#endif  // QLEVER_SRC_UTIL_BLOOMFILTER_H
@@ -0,0 +1,178 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#ifndef QLEVER_SRC_UTIL_DELTABITPACKING_H
+#define QLEVER_SRC_UTIL_DELTABITPACKING_H
+
+#include <absl/base/casts.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "backports/span.h"
+#include "util/BitUtils.h"
+#include "util/ConstexprUtils.h"
+#include "util/Exception.h"
+
+namespace ad_utility {
+
+// A lightweight codec for columns of 64-bit values that are (mostly) sorted,
+// for example the `col1` and `col2` columns of the blocks of a permutation.
+// The values are stored as the differences between adjacent values
+// ("delta encoding"), from which the smallest difference is subtracted
+// ("frame of reference"). The remaining non-negative values are then stored
+// with the minimal number of bits that is required for the largest of them
+// ("bit packing").
+//
+// The packed values are organized in groups of `groupSize` values, s.t. each
+// group occupies exactly `numBits` 64-bit words. This allows for a decoder
+// that is specialized for each bit width at compile time and whose inner loop
+// has no data-dependent branches, which the compiler can unroll and vectorize.
+//
+// The arithmetic is performed modulo 2^64, so the encoding is lossless for
+// arbitrary inputs. For inputs that are not sorted, the encoding is however
+// typically larger than a general-purpose compression like `zstd`, so the
+// caller should compare the sizes and choose the better codec.
+class DeltaBitPacking {
+ public:
+  // The number of values that are packed together into `numBits` words.
+  static constexpr size_t groupSize = 64;
+
+ private:
+  // The header that is stored at the beginning of each encoded column.
+  struct Header {
+    uint64_t numValues_;
+    uint64_t firstValue_;
+    uint64_t minDelta_;
+    uint64_t numBits_;
+  };
+
+ public:
+  // Encode the `values`. `T` must be a trivially copyable type of size 8 (for
+  // example `Id` or `uint64_t`) whose bits are encoded.
+  template <typename T>
+  static std::vector<char> compress(ql::span<const T> values) {
+    static_assert(sizeof(T) == sizeof(uint64_t));
+    auto bits = [&values](size_t i) {
+      return absl::bit_cast<uint64_t>(values[i]);
+    };
+    Header header{values.size(), 0, 0, 0};
+    const size_t numDeltas = values.empty() ? 0 : values.size() - 1;
+    if (!values.empty()) {
+      header.firstValue_ = bits(0);
+    }
+
+    // Determine the smallest and largest delta, interpreted as signed
+    // integers, s.t. also descending steps can be represented.
+    int64_t minDelta = std::numeric_limits<int64_t>::max();
+    int64_t maxDelta = std::numeric_limits<int64_t>::min();
+    for (size_t i = 0; i < numDeltas; ++i) {
+      auto delta = static_cast<int64_t>(bits(i + 1) - bits(i));
+      minDelta = std::min(minDelta, delta);
+      maxDelta = std::max(maxDelta, delta);
+    }
+    if (numDeltas > 0) {
+      header.minDelta_ = static_cast<uint64_t>(minDelta);
+      header.numBits_ = static_cast<uint64_t>(bitMaskSizeForValue(
+          static_cast<uint64_t>(maxDelta) - static_cast<uint64_t>(minDelta)));
+    }
+
+    const size_t numGroups = (numDeltas + groupSize - 1) / groupSize;
+    std::vector<uint64_t> words(numGroups * header.numBits_, 0);
+    const uint64_t numBits = header.numBits_;
+    for (size_t i = 0; i < numDeltas && numBits > 0; ++i) {
+      uint64_t value = bits(i + 1) - bits(i) - header.minDelta_;
+      const size_t group = i / groupSize;
+      const size_t bitPos = (i % groupSize) * numBits;
+      uint64_t* groupWords = words.data() + group * numBits;
+      const size_t word = bitPos / 64;
+      const size_t shift = bitPos % 64;
+      groupWords[word] |= value << shift;
+      if (shift + numBits > 64) {
+        groupWords[word + 1] |= value >> (64 - shift);
+      }
+    }
+
+    std::vector<char> result(sizeof(Header) + words.size() * sizeof(uint64_t));
+    std::memcpy(result.data(), &header, sizeof(Header));
+    if (!words.empty()) {
+      std::memcpy(result.data() + sizeof(Header), words.data(),
+                  words.size() * sizeof(uint64_t));
+    }
+    return result;
+  }
+
+  // Decode the `numBytes` many bytes starting at `src` (which must have been
+  // created by `compress` above) and write the `numValues` decoded values to
+  // `target`. Throw if the encoded data doesn't contain exactly `numValues`
+  // values.
+  template <typename T>
+  static void decompress(const char* src, size_t numBytes, T* target,
+                         size_t numValues) {
+    static_assert(sizeof(T) == sizeof(uint64_t));
+    AD_CORRECTNESS_CHECK(numBytes >= sizeof(Header));
+    Header header;
+    std::memcpy(&header, src, sizeof(Header));
+    AD_CORRECTNESS_CHECK(header.numValues_ == numValues);
+    AD_CORRECTNESS_CHECK(header.numBits_ <= 64);
+    if (numValues == 0) {
+      return;
+    }
+    const size_t numDeltas = numValues - 1;
+    const size_t numGroups = (numDeltas + groupSize - 1) / groupSize;
+    AD_CORRECTNESS_CHECK(numBytes == sizeof(Header) + numGroups *
+                                                          header.numBits_ *
+                                                          sizeof(uint64_t));
+    const char* packed = src + sizeof(Header);
+
+    RuntimeValueToCompileTimeValueVi<64>(header.numBits_, [&](auto numBits) {
+      constexpr size_t NumBits = decltype(numBits)::value;
+      uint64_t current = header.firstValue_;
+      target[0] = absl::bit_cast<T>(current);
+      std::array<uint64_t, NumBits> groupWords;
+      std::array<uint64_t, groupSize> deltas;
+      for (size_t group = 0; group < numGroups; ++group) {
+        if constexpr (NumBits > 0) {
+          std::memcpy(groupWords.data(),
+                      packed + group * NumBits * sizeof(uint64_t),
+                      NumBits * sizeof(uint64_t));
+        }
+        unpackGroup<NumBits>(groupWords.data(), deltas.data());
+        const size_t begin = group * groupSize;
+        const size_t end = std::min(begin + groupSize, numDeltas);
+        for (size_t i = begin; i < end; ++i) {
+          current += deltas[i - begin] + header.minDelta_;
+          target[i + 1] = absl::bit_cast<T>(current);
+        }
+      }
+    });
+  }
+
+ private:
+  // Unpack the `groupSize` many `NumBits`-bit values from the `NumBits` words
+  // at `in` and write them to `out`.
+  template <size_t NumBits>
+  static void unpackGroup(const uint64_t* in, uint64_t* out) {
+    if constexpr (NumBits == 0) {
+      std::fill(out, out + groupSize, uint64_t{0});
+    } else {
+      constexpr uint64_t mask = bitMaskForLowerBits(NumBits);
+      for (size_t j = 0; j < groupSize; ++j) {
+        const size_t bitPos = j * NumBits;
+        const size_t word = bitPos / 64;
+        const size_t shift = bitPos % 64;
+        uint64_t value = in[word] >> shift;
+        if (shift + NumBits > 64) {
+          value |= in[word + 1] << (64 - shift);
+        }
+        out[j] = value & mask;
+      }
+    }
+  }
+};
+
+}  // namespace ad_utility
+
+#endif  // QLEVER_SRC_UTIL_DELTABITPACKING_H
@@ -6,6 +6,7 @@
 #define QLEVER_SRC_UTIL_FILE_H
 
 #include <absl/strings/str_cat.h>
+#include <fcntl.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
@@ -176,6 +177,28 @@ class File {
     return bytesRead;
   }
 
+  // Return the file descriptor of the underlying file, e.g. for reading via
+  // `preadv` or `io_uring` (see `BatchedFileReader.h`).
+  int fileDescriptor() const {
+    assert(file_);
+    return fileno(file_);
+  }
+
+  // Ask the kernel to asynchronously read the `numBytes` bytes starting at
+  // `offset` into the page cache (readahead), s.t. later reads of this range
+  // don't have to wait for the disk. This is only a hint and a noop on
+  // platforms that don't support it.
+  void adviseWillNeed(off_t offset, size_t numBytes) const {
+    assert(file_);
+#ifdef __linux__
+    posix_fadvise(fileno(file_), offset, static_cast<off_t>(numBytes),
+                  POSIX_FADV_WILLNEED);
+#else
+    (void)offset;
+    (void)numBytes;
+#endif
+  }
+
   //! Returns the number of bytes from the beginning
   //! is 0 on opening. Later equal the number of bytes written.
   //! -1 is returned when an error occurs
@@ -10,16 +10,20 @@
 #include <cmath>
 #include <cstdint>
 #include <optional>
+#include <tuple>
 #include <type_traits>
+#include <vector>
 
 #include "backports/algorithm.h"
 #include "backports/concepts.h"
 #include "backports/span.h"
+#include "backports/three_way_comparison.h"
 #include "engine/idTable/IdTable.h"
 #include "global/Id.h"
 #include "util/InputRangeUtils.h"
 #include "util/JoinAlgorithms/FindUndefRanges.h"
 #include "util/JoinAlgorithms/JoinColumnMapping.h"
+#include "util/JoinAlgorithms/SimdJoin.h"
 #include "util/TransparentFunctors.h"
 #include "util/TypeTraits.h"
 
@@ -471,6 +475,209 @@ CPP_template(typename RangeSmaller, typename RangeLarger, typename LessThan,
   }
 }
 
+namespace detail {
+// Helper for the `...ForIdsWithoutUndef` joins below: `left[i]` and
+// `right[j]` are equal, call the `action` for all pairs of the equal elements
+// that start at these positions, and return the positions after them.
+template <typename Action, typename CheckCancellation>
+std::pair<size_t, size_t> addEqualRangesForIds(
+    ql::span<const Id> left, ql::span<const Id> right, size_t i, size_t j,
+    const Action& action, CheckCancellation& checkCancellation) {
+  auto bits = left[i].getBits();
+  size_t endLeft = i + 1;
+  while (endLeft < left.size() && left[endLeft].getBits() == bits) {
+    ++endLeft;
+  }
+  size_t endRight = j + 1;
+  while (endRight < right.size() && right[endRight].getBits() == bits) {
+    ++endRight;
+  }
+  for (; i < endLeft; ++i) {
+    checkCancellation();
+    for (size_t k = j; k < endRight; ++k) {
+      action(left.begin() + i, right.begin() + k);
+    }
+  }
+  return {endLeft, endRight};
+}
+}  // namespace detail
+
+/**
+ * @brief Specialization of `zipperJoinWithUndef` for a join on a single column
+ * of `Id`s, where the `Id`s can be compared by their bits. This is the case if
+ * neither of the inputs contains UNDEF or `Id`s from a local vocabulary.
+ * Non-matching blocks of both inputs are skipped using SIMD instructions (see
+ * `SimdJoin.h`), which is much faster than comparing the `Id`s one by one
+ * if the join is selective.
+ * @param left, right The sorted inputs.
+ * @param action Is called for each pair of equal `Id`s with the iterators to
+ * them (into `left` and `right`, in this order), in ascending order.
+ * @param checkCancellation Is called many times during processing to allow
+ * cancelling the join operation.
+ * @param instructionSet The instruction set for the SIMD kernels. Only set
+ * by tests and benchmarks.
+ */
+template <typename Action, typename CheckCancellation = Noop>
+void zipperJoinForIdsWithoutUndef(
+    ql::span<const Id> left, ql::span<const Id> right, const Action& action,
+    CheckCancellation checkCancellation = {},
+    InstructionSet instructionSet =
+        simdJoin::bestSupportedInstructionSet()) {
+  size_t i = 0;
+  size_t j = 0;
+  while (i < left.size() && j < right.size()) {
+    checkCancellation();
+    std::tie(i, j) =
+        simdJoin::skipNonMatchingBlocks(left, right, i, j, instructionSet);
+    // Process the current blocks with a scalar zipper join. The equal ranges
+    // might reach beyond the end of the blocks, which is fine.
+    size_t endBlockLeft = i + simdJoin::maxBlockSize;
+    size_t endBlockRight = j + simdJoin::maxBlockSize;
+    while (i < std::min(endBlockLeft, left.size()) &&
+           j < std::min(endBlockRight, right.size())) {
+      auto a = left[i].getBits();
+      auto b = right[j].getBits();
+      if (a < b) {
+        ++i;
+      } else if (b < a) {
+        ++j;
+      } else {
+        std::tie(i, j) = detail::addEqualRangesForIds(
+            left, right, i, j, action, checkCancellation);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Specialization of `gallopingJoin` for a join on a single column of
+ * `Id`s without UNDEF and local vocab entries (see
+ * `zipperJoinForIdsWithoutUndef` above). The final steps of the exponential
+ * searches in the `larger` input use SIMD instructions. The `action` is called
+ * with the iterators into `smaller` and `larger`, in this order.
+ */
+template <typename Action, typename CheckCancellation = Noop>
+void gallopingJoinForIdsWithoutUndef(
+    ql::span<const Id> smaller, ql::span<const Id> larger, const Action& action,
+    CheckCancellation checkCancellation = {},
+    InstructionSet instructionSet =
+        simdJoin::bestSupportedInstructionSet()) {
+  size_t i = 0;
+  size_t j = 0;
+  while (i < smaller.size() && j < larger.size()) {
+    checkCancellation();
+    // Linear search in the smaller input.
+    auto bitsLarge = larger[j].getBits();
+    while (smaller[i].getBits() < bitsLarge) {
+      ++i;
+      if (i == smaller.size()) {
+        return;
+      }
+    }
+    j = simdJoin::gallopingLowerBound(larger, j, smaller[i], instructionSet);
+    if (j == larger.size()) {
+      return;
+    }
+    if (larger[j].getBits() == smaller[i].getBits()) {
+      std::tie(i, j) = detail::addEqualRangesForIds(smaller, larger, i, j,
+                                                    action, checkCancellation);
+    }
+  }
+}
+
+// The subranges `[beginLeft_, endLeft_)` and `[beginRight_, endRight_)` of the
+// two inputs of a join that can be joined independently of the rest of the
+// inputs, see `partitionForParallelJoin` below.
+struct JoinPartition {
+  size_t beginLeft_;
+  size_t endLeft_;
+  size_t beginRight_;
+  size_t endRight_;
+
+  QL_DEFINE_DEFAULTED_EQUALITY_OPERATOR_LOCAL(JoinPartition, beginLeft_,
+                                              endLeft_, beginRight_, endRight_)
+};
+
+/**
+ * @brief Split the sorted inputs `left` and `right` of a join into at most
+ * `numPartitions` partitions, s.t. the result of the join is the concatenation
+ * of the results of joining the partitions separately. In particular, the
+ * partitions can be joined in parallel, and the concatenated result is sorted.
+ * Elements that are equal wrt `lessThan` always end up in the same partition.
+ * The splitters are the quantiles of the merged inputs (which are found by a
+ * binary search over both inputs), so all the partitions have about the same
+ * number of elements, unless a single value is very frequent. Partitions in
+ * which one of the inputs is empty can't contribute to the result and are
+ * omitted.
+ *
+ * NOTE: The inputs must not contain UNDEF values, because those might match
+ * elements in other partitions.
+ */
+CPP_template(typename RangeLeft, typename RangeRight, typename LessThan)(
+    requires ql::ranges::random_access_range<RangeLeft> CPP_and
+        ql::ranges::random_access_range<RangeRight>) std::vector<JoinPartition>
+    partitionForParallelJoin(const RangeLeft& left, const RangeRight& right,
+                             const LessThan& lessThan, size_t numPartitions) {
+  auto beginLeft = std::begin(left);
+  auto beginRight = std::begin(right);
+  size_t sizeLeft = std::end(left) - beginLeft;
+  size_t sizeRight = std::end(right) - beginRight;
+  size_t totalSize = sizeLeft + sizeRight;
+
+  // Return the positions in both inputs of the first element that is not less
+  // than the `k`-th smallest element of the merged inputs.
+  auto getSplitPositions = [&](size_t k) -> std::pair<size_t, size_t> {
+    // Find the smallest `i` s.t. the first `i` elements of `left` and the
+    // first `k - i` elements of `right` are the `k` smallest elements.
+    size_t lower = k > sizeRight ? k - sizeRight : 0;
+    size_t upper = std::min(k, sizeLeft);
+    while (lower < upper) {
+      size_t i = lower + (upper - lower) / 2;
+      if (lessThan(*(beginLeft + i), *(beginRight + (k - i - 1)))) {
+        lower = i + 1;
+      } else {
+        upper = i;
+      }
+    }
+    size_t i = lower;
+    size_t j = k - i;
+    bool takeLeft = j == sizeRight ||
+                    (i < sizeLeft &&
+                     !lessThan(*(beginRight + j), *(beginLeft + i)));
+    auto less = [&lessThan](const auto& a, const auto& b) -> bool {
+      return lessThan(a, b);
+    };
+    auto lowerBounds = [&](const auto& splitter) {
+      return std::pair{
+          static_cast<size_t>(
+              std::lower_bound(beginLeft, beginLeft + i, splitter, less) -
+              beginLeft),
+          static_cast<size_t>(
+              std::lower_bound(beginRight, beginRight + j, splitter, less) -
+              beginRight)};
+    };
+    return takeLeft ? lowerBounds(*(beginLeft + i))
+                    : lowerBounds(*(beginRight + j));
+  };
+
+  std::vector<JoinPartition> result;
+  numPartitions = std::max(numPartitions, size_t{1});
+  size_t previousLeft = 0;
+  size_t previousRight = 0;
+  for (size_t p = 1; p <= numPartitions; ++p) {
+    auto [splitLeft, splitRight] =
+        p < numPartitions && totalSize > 0
+            ? getSplitPositions(p * totalSize / numPartitions)
+            : std::pair{sizeLeft, sizeRight};
+    if (splitLeft > previousLeft && splitRight > previousRight) {
+      result.push_back({previousLeft, splitLeft, previousRight, splitRight});
+    }
+    previousLeft = std::max(previousLeft, splitLeft);
+    previousRight = std::max(previousRight, splitRight);
+  }
+  return result;
+}
+
 // Struct that compares two row-like types lexicographically, but only the first
 // `numColumns - 1` entries of the column. This is used by the
 // `specialOptionalJoin`, where the last join column has special semantics, as
@@ -0,0 +1,219 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#include "util/JoinAlgorithms/SimdJoin.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+#include "util/Exception.h"
+
+#ifdef QLEVER_SIMD_X86_64
+#include <immintrin.h>
+#endif
+
+namespace ad_utility::simdJoin {
+
+static_assert(sizeof(Id) == sizeof(uint64_t));
+
+namespace {
+// Ranges that are at most this large are scanned linearly (with SIMD) by
+// `gallopingLowerBound` instead of further halving them.
+constexpr size_t linearScanThreshold = 16;
+
+// _____________________________________________________________________________
+std::pair<size_t, size_t> skipNonMatchingScalar(ql::span<const Id> left,
+                                                ql::span<const Id> right,
+                                                size_t i, size_t j) {
+  while (i < left.size() && j < right.size()) {
+    auto a = left[i].getBits();
+    auto b = right[j].getBits();
+    if (a == b) {
+      break;
+    }
+    i += a < b;
+    j += b < a;
+  }
+  return {i, j};
+}
+
+// Return the number of elements in `[data, data + size)` that are less than
+// `needle`.
+size_t countLessScalar(const Id* data, size_t size, uint64_t needle) {
+  size_t count = 0;
+  for (size_t k = 0; k < size; ++k) {
+    count += data[k].getBits() < needle;
+  }
+  return count;
+}
+
+#ifdef QLEVER_SIMD_X86_64
+// _____________________________________________________________________________
+__attribute__((target("avx2"))) std::pair<size_t, size_t> skipNonMatchingAvx2(
+    ql::span<const Id> left, ql::span<const Id> right, size_t i, size_t j) {
+  constexpr size_t blockSize = 4;
+  while (i + blockSize <= left.size() && j + blockSize <= right.size()) {
+    __m256i a = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(left.data() + i));
+    __m256i b = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(right.data() + j));
+    // Compare all pairs of elements by rotating the block from `right`.
+    __m256i equal = _mm256_cmpeq_epi64(a, b);
+    b = _mm256_permute4x64_epi64(b, _MM_SHUFFLE(0, 3, 2, 1));
+    equal = _mm256_or_si256(equal, _mm256_cmpeq_epi64(a, b));
+    b = _mm256_permute4x64_epi64(b, _MM_SHUFFLE(0, 3, 2, 1));
+    equal = _mm256_or_si256(equal, _mm256_cmpeq_epi64(a, b));
+    b = _mm256_permute4x64_epi64(b, _MM_SHUFFLE(0, 3, 2, 1));
+    equal = _mm256_or_si256(equal, _mm256_cmpeq_epi64(a, b));
+    if (!_mm256_testz_si256(equal, equal)) {
+      break;
+    }
+    // The block with the smaller last element can't have a match in any of
+    // the following blocks of the other input. The last elements can't be
+    // equal, because then the blocks would have a common element.
+    auto lastA = left[i + blockSize - 1].getBits();
+    auto lastB = right[j + blockSize - 1].getBits();
+    i += lastA < lastB ? blockSize : 0;
+    j += lastB < lastA ? blockSize : 0;
+  }
+  return {i, j};
+}
+
+// _____________________________________________________________________________
+__attribute__((target("avx512f"))) std::pair<size_t, size_t>
+skipNonMatchingAvx512(ql::span<const Id> left, ql::span<const Id> right,
+                      size_t i, size_t j) {
+  constexpr size_t blockSize = 8;
+  static_assert(blockSize <= maxBlockSize);
+  while (i + blockSize <= left.size() && j + blockSize <= right.size()) {
+    __m512i a = _mm512_loadu_si512(left.data() + i);
+    __m512i b = _mm512_loadu_si512(right.data() + j);
+    // Compare all pairs of elements by rotating the block from `right`. (The
+    // `maskz` variant of the permutation avoids a spurious warning of GCC.)
+    const __m512i rotate = _mm512_set_epi64(0, 7, 6, 5, 4, 3, 2, 1);
+    __mmask8 equal = _mm512_cmpeq_epu64_mask(a, b);
+    for (size_t k = 1; k < blockSize; ++k) {
+      b = _mm512_maskz_permutexvar_epi64(0xFF, rotate, b);
+      equal |= _mm512_cmpeq_epu64_mask(a, b);
+    }
+    if (equal != 0) {
+      break;
+    }
+    // See `skipNonMatchingAvx2` above.
+    auto lastA = left[i + blockSize - 1].getBits();
+    auto lastB = right[j + blockSize - 1].getBits();
+    i += lastA < lastB ? blockSize : 0;
+    j += lastB < lastA ? blockSize : 0;
+  }
+  return {i, j};
+}
+
+// _____________________________________________________________________________
+__attribute__((target("avx2"))) size_t countLessAvx2(const Id* data,
+                                                     size_t size,
+                                                     uint64_t needle) {
+  // AVX2 only has a signed comparison of 64-bit integers, so we flip the sign
+  // bits of all the operands.
+  const __m256i signBit =
+      _mm256_set1_epi64x(std::numeric_limits<int64_t>::min());
+  const __m256i flippedNeedle = _mm256_xor_si256(
+      _mm256_set1_epi64x(static_cast<int64_t>(needle)), signBit);
+  size_t count = 0;
+  size_t k = 0;
+  for (; k + 4 <= size; k += 4) {
+    __m256i values = _mm256_xor_si256(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + k)),
+        signBit);
+    __m256i less = _mm256_cmpgt_epi64(flippedNeedle, values);
+    count += static_cast<size_t>(
+        __builtin_popcount(_mm256_movemask_pd(_mm256_castsi256_pd(less))));
+  }
+  return count + countLessScalar(data + k, size - k, needle);
+}
+
+// _____________________________________________________________________________
+__attribute__((target("avx512f"))) size_t countLessAvx512(const Id* data,
+                                                          size_t size,
+                                                          uint64_t needle) {
+  const __m512i broadcastNeedle =
+      _mm512_set1_epi64(static_cast<int64_t>(needle));
+  size_t count = 0;
+  size_t k = 0;
+  for (; k + 8 <= size; k += 8) {
+    __mmask8 less =
+        _mm512_cmplt_epu64_mask(_mm512_loadu_si512(data + k), broadcastNeedle);
+    count += static_cast<size_t>(__builtin_popcount(less));
+  }
+  return count + countLessScalar(data + k, size - k, needle);
+}
+#endif
+}  // namespace
+
+// _____________________________________________________________________________
+InstructionSet bestSupportedInstructionSet() {
+  static const InstructionSet best = ad_utility::bestSupportedInstructionSet(
+      {InstructionSet::Avx512, InstructionSet::Avx2});
+  return best;
+}
+
+// _____________________________________________________________________________
+std::pair<size_t, size_t> skipNonMatchingBlocks(ql::span<const Id> left,
+                                                ql::span<const Id> right,
+                                                size_t i, size_t j,
+                                                InstructionSet instructionSet) {
+  AD_EXPENSIVE_CHECK(isSupported(instructionSet));
+  switch (instructionSet) {
+#ifdef QLEVER_SIMD_X86_64
+    case InstructionSet::Avx2:
+      return skipNonMatchingAvx2(left, right, i, j);
+    case InstructionSet::Avx512:
+      return skipNonMatchingAvx512(left, right, i, j);
+#endif
+    default:
+      return skipNonMatchingScalar(left, right, i, j);
+  }
+}
+
+// _____________________________________________________________________________
+size_t gallopingLowerBound(ql::span<const Id> data, size_t begin, Id needle,
+                           InstructionSet instructionSet) {
+  AD_EXPENSIVE_CHECK(isSupported(instructionSet));
+  auto needleBits = needle.getBits();
+  // Exponential search: Afterwards all the elements in `[begin, lower)` are
+  // less than the `needle`, and the element at `upper` (if it exists) is not.
+  size_t lower = begin;
+  size_t upper = begin;
+  size_t step = 1;
+  while (upper < data.size() && data[upper].getBits() < needleBits) {
+    lower = upper + 1;
+    upper += step;
+    step *= 2;
+  }
+  upper = std::min(upper, data.size());
+  // Binary search until the remaining range is small.
+  while (upper - lower > linearScanThreshold) {
+    size_t middle = lower + (upper - lower) / 2;
+    if (data[middle].getBits() < needleBits) {
+      lower = middle + 1;
+    } else {
+      upper = middle;
+    }
+  }
+  // The range is sorted, so the number of elements that are less than the
+  // `needle` is the offset of the lower bound.
+  const Id* start = data.data() + lower;
+  size_t size = upper - lower;
+  switch (instructionSet) {
+#ifdef QLEVER_SIMD_X86_64
+    case InstructionSet::Avx2:
+      return lower + countLessAvx2(start, size, needleBits);
+    case InstructionSet::Avx512:
+      return lower + countLessAvx512(start, size, needleBits);
+#endif
+    default:
+      return lower + countLessScalar(start, size, needleBits);
+  }
+}
+
+}  // namespace ad_utility::simdJoin
@@ -0,0 +1,54 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#ifndef QLEVER_SRC_UTIL_JOINALGORITHMS_SIMDJOIN_H
+#define QLEVER_SRC_UTIL_JOINALGORITHMS_SIMDJOIN_H
+
+#include <cstddef>
+#include <utility>
+
+#include "backports/span.h"
+#include "global/Id.h"
+#include "util/SimdInstructionSet.h"
+
+// Kernels for joins on a single column of `Id`s that can be compared by their
+// bits, which is the case if none of the `Id`s is UNDEF or refers to a local
+// vocabulary. The kernels use AVX2 or AVX-512 if the CPU supports it (see
+// `SimdInstructionSet.h`).
+// The actual join algorithms that use these kernels are
+// `ad_utility::zipperJoinForIdsWithoutUndef` and
+// `ad_utility::gallopingJoinForIdsWithoutUndef` in `JoinAlgorithms.h`.
+namespace ad_utility::simdJoin {
+
+// The maximal number of `Id`s that are compared at once by any of the
+// instruction sets.
+static constexpr size_t maxBlockSize = 8;
+
+// Return the best instruction set for the kernels below that is supported by
+// the CPU. The result is computed once and then cached.
+InstructionSet bestSupportedInstructionSet();
+
+// For the sorted ranges `left` and `right`, advance the positions `i` and `j`
+// past elements that have no matching element in the other range, and return
+// the new positions. The SIMD variants compare blocks of `Id`s from both
+// ranges pairwise and return as soon as the two current blocks have a common
+// element or there are fewer elements left than fit in a block. The scalar
+// variant returns at the first match. In all cases, the caller has to process
+// the elements at the returned positions (at most `maxBlockSize` of them on
+// each side) without this function before calling it again.
+std::pair<size_t, size_t> skipNonMatchingBlocks(ql::span<const Id> left,
+                                                ql::span<const Id> right,
+                                                size_t i, size_t j,
+                                                InstructionSet instructionSet);
+
+// Return the position of the first element in the sorted range `data` that is
+// at position `begin` or later and not less than `needle`, or `data.size()` if
+// there is no such element. The position is found via an exponential search
+// starting at `begin`, the last steps of which are a SIMD scan of a small
+// range, so this function is efficient if the result is close to `begin`.
+size_t gallopingLowerBound(ql::span<const Id> data, size_t begin, Id needle,
+                           InstructionSet instructionSet);
+
+}  // namespace ad_utility::simdJoin
+
+#endif  // QLEVER_SRC_UTIL_JOINALGORITHMS_SIMDJOIN_H
@@ -272,6 +272,12 @@ class MmapVector {
     advise(_pattern);
   }
 
+  // Ask the kernel to asynchronously read the first `maxNumBytes` bytes of
+  // the mapped file into memory (and to back them by huge pages if possible),
+  // s.t. later accesses don't cause page faults. Return the number of bytes
+  // for which this was requested.
+  size_t prefetch(size_t maxNumBytes) const;
+
  protected:
   // _________________________________________________________________________
   inline void throwIfUninitialized() const {
@@ -351,6 +357,11 @@ class MmapVectorView : private MmapVector<T> {
   // ____________________________________________________
   size_t size() const { return MmapVector<T>::size(); }
 
+  // ____________________________________________________
+  size_t prefetch(size_t maxNumBytes) const {
+    return MmapVector<T>::prefetch(maxNumBytes);
+  }
+
   // default constructor, leaves an uninitialized vector that will throw until a
   // valid call to open()
   MmapVectorView() = default;
@@ -11,6 +11,7 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <cstdio>
 #include <utility>
 
@@ -310,6 +311,30 @@ void MmapVector<T>::advise(AccessPattern pattern) {
 #endif
 }
 
+// ________________________________________________________________
+template <class T>
+size_t MmapVector<T>::prefetch(size_t maxNumBytes) const {
+  if (_ptr == nullptr) {
+    return 0;
+  }
+  // `madvise` requires a page-aligned start (which is guaranteed by `mmap`),
+  // but the length is rounded up to full pages by the kernel.
+  size_t numBytes = std::min(maxNumBytes, static_cast<size_t>(_bytesize));
+  if (numBytes == 0) {
+    return 0;
+  }
+  // As in `advise` above, the advice is only a hint, so failures (e.g. if
+  // transparent huge pages are not supported for file mappings) are ignored.
+#ifndef QLEVER_REDUCED_FEATURE_SET_FOR_CPP17
+  void* ptr = static_cast<void*>(_ptr);
+#ifdef MADV_HUGEPAGE
+  madvise(ptr, numBytes, MADV_HUGEPAGE);
+#endif
+  madvise(ptr, numBytes, MADV_WILLNEED);
+#endif
+  return numBytes;
+}
+
 // ________________________________________________________________
 // there is much code duplication with these operations to their equivalents in
 // MmapVector. But since we have chosen the "greedy" template constructors,
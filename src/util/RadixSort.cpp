@@ -0,0 +1,110 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#include "util/RadixSort.h"
+
+#include <array>
+
+namespace {
+constexpr size_t numBitsPerDigit = 8;
+constexpr size_t numDigits = 64 / numBitsPerDigit;
+constexpr size_t numBuckets = size_t{1} << numBitsPerDigit;
+constexpr uint64_t digitMask = numBuckets - 1;
+
+// Inputs with fewer elements are sorted with `std::stable_sort`, for which
+// the overhead of the histograms doesn't pay off.
+constexpr size_t minNumElementsForRadixSort = 256;
+
+// Return the `digit`-th digit of the `key`, starting from the least
+// significant digit.
+size_t getDigit(uint64_t key, size_t digit) {
+  return (key >> (digit * numBitsPerDigit)) & digitMask;
+}
+}  // namespace
+
+namespace ad_utility {
+
+// _____________________________________________________________________________
+void radixSortByKey(KeysAndRows& keysAndRows, size_t numThreads) {
+  size_t numElements = keysAndRows.size();
+  if (numElements < minNumElementsForRadixSort) {
+    std::stable_sort(keysAndRows.begin(), keysAndRows.end(),
+                     [](const KeyAndRow& a, const KeyAndRow& b) {
+                       return a.key_ < b.key_;
+                     });
+    return;
+  }
+
+  // The threads process fixed ranges of the input in each pass, s.t. the
+  // order of the elements within each bucket stays the same (stability).
+  numThreads = std::max(
+      size_t{1}, std::min(numThreads, numElements / minNumElementsPerThread));
+  auto beginOfRange = [numElements, numThreads](size_t thread) {
+    return thread * numElements / numThreads;
+  };
+  auto forEachThread = [numThreads, &beginOfRange](const auto& function) {
+    if (numThreads == 1) {
+      function(size_t{0}, size_t{0}, beginOfRange(1));
+      return;
+    }
+    std::vector<std::packaged_task<void()>> tasks;
+    for (size_t thread = 0; thread < numThreads; ++thread) {
+      tasks.emplace_back([&function, &beginOfRange, thread]() {
+        function(thread, beginOfRange(thread), beginOfRange(thread + 1));
+      });
+    }
+    runTasksInParallel(std::move(tasks));
+  };
+
+  // Determine the bits in which at least two keys differ.
+  std::vector<uint64_t> differingBitsPerThread(numThreads, 0);
+  uint64_t firstKey = keysAndRows.front().key_;
+  forEachThread([&](size_t thread, size_t begin, size_t end) {
+    uint64_t differingBits = 0;
+    for (size_t i = begin; i < end; ++i) {
+      differingBits |= keysAndRows[i].key_ ^ firstKey;
+    }
+    differingBitsPerThread[thread] = differingBits;
+  });
+  uint64_t differingBits = 0;
+  for (uint64_t bits : differingBitsPerThread) {
+    differingBits |= bits;
+  }
+
+  KeysAndRows buffer(numElements, keysAndRows.get_allocator());
+  // `offsets[thread][bucket]` is the position in the output of the next
+  // element of the range of the `thread` with the given `bucket`.
+  std::vector<std::array<size_t, numBuckets>> offsets(numThreads);
+  for (size_t digit = 0; digit < numDigits; ++digit) {
+    if (getDigit(differingBits, digit) == 0) {
+      continue;
+    }
+    forEachThread([&](size_t thread, size_t begin, size_t end) {
+      auto& histogram = offsets[thread];
+      histogram.fill(0);
+      for (size_t i = begin; i < end; ++i) {
+        ++histogram[getDigit(keysAndRows[i].key_, digit)];
+      }
+    });
+    // Within each bucket, the elements of the ranges of the threads are
+    // placed in the order of the threads.
+    size_t offset = 0;
+    for (size_t bucket = 0; bucket < numBuckets; ++bucket) {
+      for (auto& offsetsOfThread : offsets) {
+        size_t count = offsetsOfThread[bucket];
+        offsetsOfThread[bucket] = offset;
+        offset += count;
+      }
+    }
+    forEachThread([&](size_t thread, size_t begin, size_t end) {
+      auto& offsetsOfThread = offsets[thread];
+      for (size_t i = begin; i < end; ++i) {
+        const auto& element = keysAndRows[i];
+        buffer[offsetsOfThread[getDigit(element.key_, digit)]++] = element;
+      }
+    });
+    std::swap(keysAndRows, buffer);
+  }
+}
+
+}  // namespace ad_utility
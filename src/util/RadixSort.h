@@ -0,0 +1,59 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#ifndef QLEVER_SRC_UTIL_RADIXSORT_H
+#define QLEVER_SRC_UTIL_RADIXSORT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <vector>
+
+#include "util/AllocatorWithLimit.h"
+#include "util/ParallelExecutor.h"
+
+namespace ad_utility {
+
+// A 64-bit sort key together with the index of the row it belongs to.
+struct KeyAndRow {
+  uint64_t key_;
+  uint64_t row_;
+};
+using KeysAndRows = std::vector<KeyAndRow, AllocatorWithLimit<KeyAndRow>>;
+
+// Ranges with fewer elements than this are not split between threads.
+inline constexpr size_t minNumElementsPerThread = 1 << 16;
+
+// Split the range `[0, numElements)` into at most `numThreads` consecutive
+// ranges of (almost) equal size, and call `function(begin, end)` for each of
+// them in a separate thread. Each range has at least `minNumElementsPerThread`
+// elements, so small ranges are processed by the calling thread.
+template <typename F>
+void forEachRangeInParallel(size_t numElements, size_t numThreads,
+                            const F& function) {
+  numThreads = std::max(
+      size_t{1}, std::min(numThreads, numElements / minNumElementsPerThread));
+  if (numThreads == 1) {
+    function(size_t{0}, numElements);
+    return;
+  }
+  std::vector<std::packaged_task<void()>> tasks;
+  for (size_t i = 0; i < numThreads; ++i) {
+    size_t begin = i * numElements / numThreads;
+    size_t end = (i + 1) * numElements / numThreads;
+    tasks.emplace_back([&function, begin, end]() { function(begin, end); });
+  }
+  runTasksInParallel(std::move(tasks));
+}
+
+// Sort the `keysAndRows` by their `key_` using a stable least significant
+// digit radix sort with 8-bit digits. Digits that are equal for all the keys
+// are skipped, so for example keys that only use their lower 32 bits need only
+// four passes. The passes are executed by up to `numThreads` threads. A buffer
+// of the same size as `keysAndRows` is allocated with its allocator.
+void radixSortByKey(KeysAndRows& keysAndRows, size_t numThreads);
+
+}  // namespace ad_utility
+
+#endif  // QLEVER_SRC_UTIL_RADIXSORT_H
@@ -0,0 +1,57 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#include "util/SimdInstructionSet.h"
+
+#include "util/Exception.h"
+
+namespace ad_utility {
+
+// _____________________________________________________________________________
+bool isSupported(InstructionSet instructionSet) {
+  switch (instructionSet) {
+    case InstructionSet::Scalar:
+      return true;
+#ifdef QLEVER_SIMD_X86_64
+    case InstructionSet::Sse2:
+      // SSE2 is part of every x86-64 CPU.
+      return true;
+    case InstructionSet::Avx2:
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx2");
+    case InstructionSet::Avx512:
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx512f");
+#endif
+    default:
+      return false;
+  }
+}
+
+// _____________________________________________________________________________
+InstructionSet bestSupportedInstructionSet(
+    std::initializer_list<InstructionSet> candidates) {
+  for (auto instructionSet : candidates) {
+    if (isSupported(instructionSet)) {
+      return instructionSet;
+    }
+  }
+  return InstructionSet::Scalar;
+}
+
+// _____________________________________________________________________________
+std::string_view toString(InstructionSet instructionSet) {
+  switch (instructionSet) {
+    case InstructionSet::Scalar:
+      return "scalar";
+    case InstructionSet::Sse2:
+      return "SSE2";
+    case InstructionSet::Avx2:
+      return "AVX2";
+    case InstructionSet::Avx512:
+      return "AVX-512";
+  }
+  AD_FAIL();
+}
+
+}  // namespace ad_utility
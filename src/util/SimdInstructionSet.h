@@ -0,0 +1,37 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#ifndef QLEVER_SRC_UTIL_SIMDINSTRUCTIONSET_H
+#define QLEVER_SRC_UTIL_SIMDINSTRUCTIONSET_H
+
+#include <initializer_list>
+#include <string_view>
+
+// Kernels that use SIMD instructions (see `SimdJoin.h` and `SimdScanner.h`)
+// are compiled for their instruction set via the `target` attribute, and the
+// instruction set is chosen at runtime, s.t. the binaries don't require any
+// `-march` flags and still run on older CPUs. Such kernels can only be
+// compiled if `QLEVER_SIMD_X86_64` is defined.
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define QLEVER_SIMD_X86_64
+#endif
+
+namespace ad_utility {
+
+// The instruction sets for which there are SIMD kernels. `Scalar` stands for
+// the fallback implementation without SIMD instructions.
+enum class InstructionSet { Scalar, Sse2, Avx2, Avx512 };
+
+// Return true iff the CPU supports the `instructionSet`.
+bool isSupported(InstructionSet instructionSet);
+
+// Return the first of the `candidates` that is supported by the CPU, or
+// `Scalar` if there is none.
+InstructionSet bestSupportedInstructionSet(
+    std::initializer_list<InstructionSet> candidates);
+
+std::string_view toString(InstructionSet instructionSet);
+
+}  // namespace ad_utility
+
+#endif  // QLEVER_SRC_UTIL_SIMDINSTRUCTIONSET_H
@@ -0,0 +1,90 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include "util/BatchedFileReader.h"
+
+using ad_utility::BatchedFileReader;
+using ad_utility::File;
+using ad_utility::FileReadRequest;
+
+namespace {
+// Write a file with `numBytes` bytes with a simple pattern and return the
+// contents.
+std::vector<char> writeTestFile(const std::string& filename, size_t numBytes) {
+  std::vector<char> contents(numBytes);
+  for (size_t i = 0; i < numBytes; ++i) {
+    contents[i] = static_cast<char>(i * 7 + 3);
+  }
+  File file{filename, "w"};
+  file.write(contents.data(), contents.size());
+  return contents;
+}
+
+// Return the offsets of the `runs`.
+auto getOffsets(const std::vector<std::vector<FileReadRequest>>& runs) {
+  std::vector<std::vector<off_t>> result;
+  for (const auto& run : runs) {
+    auto& offsets = result.emplace_back();
+    for (const auto& request : run) {
+      offsets.push_back(request.offset_);
+    }
+  }
+  return result;
+}
+}  // namespace
+
+// _____________________________________________________________________________
+TEST(BatchedFileReader, coalesce) {
+  char* t = nullptr;
+  // Adjacent ranges are coalesced, the order of the input doesn't matter, and
+  // empty requests are removed.
+  std::vector<FileReadRequest> requests{
+      {20, 5, t}, {0, 10, t}, {10, 3, t}, {13, 0, t}, {25, 1, t}, {40, 2, t}};
+  using V = std::vector<std::vector<off_t>>;
+  EXPECT_EQ(getOffsets(BatchedFileReader::coalesce(requests)),
+            (V{{0, 10}, {20, 25}, {40}}));
+  EXPECT_TRUE(BatchedFileReader::coalesce({}).empty());
+
+  // Overlapping ranges are not allowed.
+  EXPECT_ANY_THROW(BatchedFileReader::coalesce({{0, 10, t}, {5, 10, t}}));
+}
+
+// _____________________________________________________________________________
+TEST(BatchedFileReader, read) {
+  std::string filename = "batchedFileReaderTest.dat";
+  auto contents = writeTestFile(filename, 100'000);
+  File file{filename, "r"};
+
+  for (size_t numThreads : {0, 1, 4}) {
+    // Read most of the file in ranges of different sizes, some of which are
+    // adjacent and some of which are not.
+    std::vector<char> target(contents.size(), 0);
+    std::vector<FileReadRequest> requests;
+    size_t offset = 0;
+    for (size_t i = 0; offset < contents.size(); ++i) {
+      size_t size = std::min(contents.size() - offset, 1 + (i * 37) % 500);
+      if (i % 3 != 0) {
+        requests.push_back(
+            {static_cast<off_t>(offset), size, target.data() + offset});
+      }
+      offset += size;
+    }
+    BatchedFileReader{numThreads}.read(file, requests);
+    for (const auto& request : requests) {
+      for (size_t i = 0; i < request.size_; ++i) {
+        ASSERT_EQ(target[request.offset_ + i], contents[request.offset_ + i]);
+      }
+    }
+  }
+
+  // Reading beyond the end of the file throws.
+  std::vector<char> buffer(10);
+  EXPECT_ANY_THROW(BatchedFileReader{}.read(
+      file, {{static_cast<off_t>(contents.size() - 5), 10, buffer.data()}}));
+  file.close();
+  ad_utility::deleteFile(filename);
+}
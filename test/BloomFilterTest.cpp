@@ -0,0 +1,72 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#include <gtest/gtest.h>
+
+#include "util/BloomFilter.h"
+#include "util/Serializer/ByteBufferSerializer.h"
+
+using ad_utility::BloomFilter;
+
+// _____________________________________________________________________________
+TEST(BloomFilter, noFalseNegatives) {
+  BloomFilter filter{1000, 0.01};
+  for (uint64_t i = 0; i < 1000; ++i) {
+    filter.add(i * 7919);
+  }
+  for (uint64_t i = 0; i < 1000; ++i) {
+    EXPECT_TRUE(filter.mayContain(i * 7919));
+  }
+}
+
+// _____________________________________________________________________________
+TEST(BloomFilter, falsePositiveRate) {
+  for (double rate : {0.1, 0.01, 0.001}) {
+    BloomFilter filter{10'000, rate};
+    for (uint64_t i = 0; i < 10'000; ++i) {
+      filter.add(2 * i);
+    }
+    size_t numFalsePositives = 0;
+    for (uint64_t i = 0; i < 10'000; ++i) {
+      numFalsePositives += filter.mayContain(2 * i + 1);
+    }
+    // Allow some slack, the hash functions are deterministic.
+    EXPECT_LT(static_cast<double>(numFalsePositives), 2 * rate * 10'000)
+        << rate;
+  }
+}
+
+// _____________________________________________________________________________
+TEST(BloomFilter, sizeAndDefaultConstructed) {
+  BloomFilter empty;
+  EXPECT_EQ(empty.numBits(), 0u);
+  EXPECT_TRUE(empty.mayContain(42));
+  EXPECT_ANY_THROW(empty.add(42));
+
+  // At least one word, even for zero elements.
+  EXPECT_EQ(BloomFilter(0, 0.01).numBits(), 64u);
+  // About 9.6 bits and 7 hash functions per element for a rate of 1%.
+  BloomFilter filter{1000, 0.01};
+  EXPECT_GE(filter.numBits(), 9585u);
+  EXPECT_LE(filter.numBits(), 9585u + 64);
+  EXPECT_EQ(filter.numHashFunctions(), 7u);
+
+  EXPECT_ANY_THROW(BloomFilter(10, 0.0));
+  EXPECT_ANY_THROW(BloomFilter(10, 1.0));
+}
+
+// _____________________________________________________________________________
+TEST(BloomFilter, serialization) {
+  BloomFilter filter{100, 0.05};
+  for (uint64_t i = 0; i < 100; ++i) {
+    filter.add(i);
+  }
+  ad_utility::serialization::ByteBufferWriteSerializer writer;
+  writer << filter;
+  ad_utility::serialization::ByteBufferReadSerializer reader{
+      std::move(writer).data()};
+  BloomFilter result;
+  reader >> result;
+  EXPECT_EQ(result, filter);
+  EXPECT_NE(result, BloomFilter(100, 0.05));
+}
@@ -137,7 +137,8 @@ template <typename T>
 std::pair<std::vector<CompressedBlockMetadata>,
           std::vector<CompressedRelationMetadata>>
 compressedRelationTestWriteCompressedRelations(
-    T inputs, std::string filename, ad_utility::MemorySize blocksize) {
+    T inputs, std::string filename, ad_utility::MemorySize blocksize,
+    std::optional<double> col1BloomFilterFalsePositiveRate) {
   // First check the invariants of the `inputs`. They must be sorted by the
   // `col0_` and for each of the `inputs` the `col1And2_` must also be sorted.
   AD_CONTRACT_CHECK(ql::ranges::is_sorted(
@@ -172,7 +173,8 @@ compressedRelationTestWriteCompressedRelations(
 
   // First create the on-disk permutation.
   auto writer = std::make_unique<CompressedRelationWriter>(
-      numColumns, ad_utility::File{filename, "w"}, blocksize);
+      numColumns, ad_utility::File{filename, "w"}, blocksize,
+      col1BloomFilterFalsePositiveRate);
   std::vector<CompressedRelationMetadata> metaData;
   CompressedRelationWriter::WriterAndCallback wc1{
       std::move(writer),
@@ -254,11 +256,12 @@ makeLocatedTriplesFromPartOfInput(float locatedProbab,
 // `filename`. Return the created metadata for blocks and large relations, as
 // well as a `CompressedRelationReader`. These are exactly the datastructures
 // that are required to test the `CompressedRelationReader` class.
-auto writeAndOpenRelations(const std::vector<RelationInput>& inputs,
-                           std::string filename,
-                           ad_utility::MemorySize blocksize) {
+auto writeAndOpenRelations(
+    const std::vector<RelationInput>& inputs, std::string filename,
+    ad_utility::MemorySize blocksize,
+    std::optional<double> col1BloomFilterFalsePositiveRate = std::nullopt) {
   auto [blocks, metaData] = compressedRelationTestWriteCompressedRelations(
-      inputs, filename, blocksize);
+      inputs, filename, blocksize, col1BloomFilterFalsePositiveRate);
   auto reader = [&]() {
     return std::make_unique<CompressedRelationReader>(
         ad_utility::makeUnlimitedAllocator<Id>(),
@@ -270,9 +273,10 @@ auto writeAndOpenRelations(const std::vector<RelationInput>& inputs,
 // Run a set of tests on a permutation that is defined by the `inputs`. The
 // `inputs` must be ordered wrt the `col0_`.  `blocksize` is the size of the
 // blocks in which the permutation will be compressed and stored on disk.
-void testCompressedRelations(const auto& inputsOriginalBeforeCopy,
-                             ad_utility::MemorySize blocksize,
-                             float locatedTriplesProbability = 0.5) {
+void testCompressedRelations(
+    const auto& inputsOriginalBeforeCopy, ad_utility::MemorySize blocksize,
+    float locatedTriplesProbability = 0.5,
+    std::optional<double> col1BloomFilterFalsePositiveRate = std::nullopt) {
   using ScanSpecAndBlocks = CompressedRelationReader::ScanSpecAndBlocks;
   auto inputs = inputsOriginalBeforeCopy;
   addGraphColumnIfNecessary(inputs);
@@ -282,7 +286,8 @@ void testCompressedRelations(const auto& inputsOriginalBeforeCopy,
   auto filename = gtestCurrentTestName();
   auto cleanup = makeCleanup(filename);
   auto [blocksOriginal, metaData, readerPtr] =
-      writeAndOpenRelations(inputsWithoutLocated, filename, blocksize);
+      writeAndOpenRelations(inputsWithoutLocated, filename, blocksize,
+                            col1BloomFilterFalsePositiveRate);
   auto handle = std::make_shared<ad_utility::CancellationHandle<>>();
   // deltaTriples.insertTriples(handle, std::move(locatedTriplesInput));
   // auto locatedTriples =
@@ -440,6 +445,98 @@ TEST(CompressedRelationWriter, SmallRelations) {
   testWithDifferentBlockSizes(inputs);
 }
 
+// Sorted columns are stored using the lightweight `DeltaBitPacking` codec, and
+// the blocks can still be read correctly.
+TEST(CompressedRelationWriter, sortedColumnsUseDeltaBitPacking) {
+  std::vector<RelationInput> inputs;
+  std::vector<RowInput> col1And2;
+  for (int j = 0; j < 2000; ++j) {
+    col1And2.push_back({3 * j, 17});
+  }
+  inputs.push_back(RelationInput{42, col1And2});
+  auto filename = gtestCurrentTestName();
+  auto cleanup = makeCleanup(filename);
+  auto [blocks, metaData] =
+      compressedRelationTestWriteCompressedRelations(inputs, filename, 4096_B,
+                                                     std::nullopt);
+  ASSERT_FALSE(blocks.empty());
+  for (const auto& block : blocks) {
+    // The arithmetic progression in `col1` needs zero bits per row.
+    EXPECT_EQ(block.getOffsetAndCompressedSizeForColumn(1).codec_,
+              ColumnCodec::DeltaBitPacking);
+  }
+  testCompressedRelations(inputs, 4096_B);
+}
+
+// With a false-positive rate for the Bloom filters, each block gets a filter for
+// its `col1Id`s, which is used by `getRelevantBlocks` to skip blocks that don't
+// contain the `col1Id` of a scan.
+TEST(CompressedRelationWriter, col1BloomFilters) {
+  // A large relation with only the even `col1Id`s, s.t. the odd `col1Id`s are
+  // always within the range of a block, but not contained in it.
+  std::vector<RelationInput> inputs;
+  std::vector<RowInput> col1And2;
+  for (int j = 0; j < 4000; ++j) {
+    col1And2.push_back({2 * j, 17});
+  }
+  inputs.push_back(RelationInput{42, col1And2});
+  auto filename = gtestCurrentTestName();
+  auto cleanup = makeCleanup(filename);
+  auto [blocks, metaData] = compressedRelationTestWriteCompressedRelations(
+      inputs, filename, 4096_B, 0.01);
+  ASSERT_GT(blocks.size(), 2u);
+  for (const auto& block : blocks) {
+    ASSERT_TRUE(block.col1BloomFilter_.has_value());
+  }
+  auto ranges = getBlockMetadataRangesfromVec(blocks);
+  auto numRelevantBlocks = [&ranges](int col1) {
+    ScanSpecification scanSpec{V(42), V(col1), std::nullopt};
+    return CompressedRelationReader::getNumberOfBlockMetadataValues(
+        CompressedRelationReader::getRelevantBlocks(scanSpec, ranges));
+  };
+  // There are no false negatives, and (almost) all the blocks are skipped for
+  // the `col1Id`s that are not contained.
+  size_t numFalsePositives = 0;
+  for (int j = 0; j < 4000; ++j) {
+    ASSERT_EQ(numRelevantBlocks(2 * j), 1u);
+    numFalsePositives += numRelevantBlocks(2 * j + 1);
+  }
+  EXPECT_LT(numFalsePositives, 200u);
+
+  // Without the Bloom filters, the blocks are not skipped.
+  for (auto& block : blocks) {
+    block.col1BloomFilter_.reset();
+  }
+  EXPECT_EQ(numRelevantBlocks(1), 1u);
+
+  // The scans (also with updates, which invalidate the Bloom filters of the
+  // affected blocks) yield the correct results.
+  testCompressedRelations(inputs, 4096_B, 0.5, 0.01);
+  std::vector<RelationInput> smallRelations;
+  for (int i = 1; i < 200; ++i) {
+    smallRelations.push_back(
+        RelationInput{i, {{i - 1, i + 1}, {i - 1, i + 2}, {i, i - 1}}});
+  }
+  testCompressedRelations(smallRelations, 237_B, 0.5, 0.01);
+
+  // The filters are sized by the number of distinct `col1Id`s, not by the
+  // number of distinct `(col0Id, col1Id)` pairs.
+  std::vector<RelationInput> sameCol1Ids;
+  for (int i = 1; i < 200; ++i) {
+    sameCol1Ids.push_back(RelationInput{i, {{3, i}, {5, i}}});
+  }
+  auto filenameSameCol1Ids = filename + ".sameCol1Ids";
+  auto cleanupSameCol1Ids = makeCleanup(filenameSameCol1Ids);
+  auto [blocksSameCol1Ids, metaDataSameCol1Ids] =
+      compressedRelationTestWriteCompressedRelations(
+          sameCol1Ids, filenameSameCol1Ids, 4096_B, 0.01);
+  ASSERT_FALSE(blocksSameCol1Ids.empty());
+  for (const auto& block : blocksSameCol1Ids) {
+    ASSERT_TRUE(block.col1BloomFilter_.has_value());
+    EXPECT_EQ(block.col1BloomFilter_.value().numBits(), 64u);
+  }
+}
+
 // Internal matchers for the following two tests.
 namespace {
 // A matcher for a `PermutedTriple`. The `int`s are converted to VocabIds.
@@ -0,0 +1,99 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#include <gtest/gtest.h>
+
+#include "global/Id.h"
+#include "util/DeltaBitPacking.h"
+#include "util/Random.h"
+
+namespace {
+using ad_utility::DeltaBitPacking;
+
+// Compress and decompress `input` and check that the result is the same as the
+// input. Return the size of the compressed data in bytes.
+template <typename T>
+size_t testRoundTrip(const std::vector<T>& input) {
+  auto compressed = DeltaBitPacking::compress(ql::span<const T>{input});
+  std::vector<T> decompressed(input.size());
+  DeltaBitPacking::decompress(compressed.data(), compressed.size(),
+                              decompressed.data(), decompressed.size());
+  EXPECT_EQ(input, decompressed);
+  return compressed.size();
+}
+}  // namespace
+
+// _____________________________________________________________________________
+TEST(DeltaBitPacking, emptyAndSingleElement) {
+  testRoundTrip(std::vector<uint64_t>{});
+  testRoundTrip(std::vector<uint64_t>{42});
+  testRoundTrip(std::vector<uint64_t>{std::numeric_limits<uint64_t>::max()});
+}
+
+// _____________________________________________________________________________
+TEST(DeltaBitPacking, sortedInputs) {
+  // The sizes are chosen s.t. the number of deltas is below, exactly at, and
+  // above a multiple of the group size.
+  for (size_t size : {2, 63, 64, 65, 66, 129, 1000}) {
+    std::vector<uint64_t> constant(size, 12345);
+    // A constant sequence requires zero bits per value.
+    EXPECT_EQ(testRoundTrip(constant), testRoundTrip(std::vector<uint64_t>{3}));
+
+    std::vector<uint64_t> ascending;
+    ad_utility::SlowRandomIntGenerator<uint64_t> gen{0, 100};
+    uint64_t current = 1ULL << 60;
+    for (size_t i = 0; i < size; ++i) {
+      current += gen();
+      ascending.push_back(current);
+    }
+    // Each delta requires at most 7 bits.
+    EXPECT_LE(testRoundTrip(ascending),
+              testRoundTrip(std::vector<uint64_t>{}) + size * 7 / 8 + 64);
+  }
+}
+
+// _____________________________________________________________________________
+TEST(DeltaBitPacking, arbitraryInputs) {
+  ad_utility::SlowRandomIntGenerator<uint64_t> gen{
+      0, std::numeric_limits<uint64_t>::max()};
+  for (size_t size : {2, 63, 64, 65, 1000}) {
+    std::vector<uint64_t> input;
+    for (size_t i = 0; i < size; ++i) {
+      input.push_back(gen());
+    }
+    testRoundTrip(input);
+    // Descending sequences and sequences with a single large jump (like the
+    // `col1` of a block that contains several small relations).
+    ql::ranges::sort(input, std::greater{});
+    testRoundTrip(input);
+    ql::ranges::sort(input);
+    std::rotate(input.begin(), input.begin() + size / 2, input.end());
+    testRoundTrip(input);
+  }
+}
+
+// _____________________________________________________________________________
+TEST(DeltaBitPacking, ids) {
+  std::vector<Id> ids;
+  for (int64_t i = 0; i < 500; ++i) {
+    ids.push_back(Id::makeFromVocabIndex(VocabIndex::make(3 * i)));
+  }
+  ids.push_back(Id::makeFromInt(-42));
+  ids.push_back(Id::makeUndefined());
+  testRoundTrip(ids);
+}
+
+// _____________________________________________________________________________
+TEST(DeltaBitPacking, corruptedInputThrows) {
+  std::vector<uint64_t> input{1, 2, 3, 4, 5};
+  auto compressed = DeltaBitPacking::compress(ql::span<const uint64_t>{input});
+  std::vector<uint64_t> decompressed(input.size());
+  // Wrong number of values.
+  EXPECT_ANY_THROW(DeltaBitPacking::decompress(
+      compressed.data(), compressed.size(), decompressed.data(), 4));
+  // Truncated input.
+  EXPECT_ANY_THROW(DeltaBitPacking::decompress(
+      compressed.data(), compressed.size() - 1, decompressed.data(), 5));
+  EXPECT_ANY_THROW(DeltaBitPacking::decompress(compressed.data(), 3,
+                                               decompressed.data(), 5));
+}
@@ -1413,7 +1413,8 @@ TEST(ExportQueryExecutionTrees, LimitOffset) {
   <result>
     <binding name="s"><uri>g</uri></binding>
   </result>)" + xmlTrailer;
-  // The `OrderBy` operation doesn't support the limit natively.
+  // The `TopK` operation (which is used for an `ORDER BY` with a small
+  // `LIMIT`) doesn't support the limit natively.
   std::string_view objectQuery0 =
       "SELECT ?s WHERE { ?s ?p ?o } ORDER BY ?s LIMIT 2 OFFSET 1";
   // The `IndexScan` operation does support the limit natively.
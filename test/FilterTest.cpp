@@ -266,3 +266,84 @@ TEST(Filter, clone) {
   EXPECT_THAT(filter, IsDeepCopy(*clone));
   EXPECT_EQ(clone->getDescriptor(), filter.getDescriptor());
 }
+
+// _____________________________________________________________________________
+TEST(Filter, compiledFilter) {
+  using namespace makeSparqlExpression;
+  using namespace ad_utility::testing;
+  QueryExecutionContext* qec = getQec();
+  auto I = IntId;
+  auto D = DoubleId;
+  auto U = Id::makeUndefined();
+  Variable x{"?x"};
+  Variable y{"?y"};
+  IdTable input = makeIdTableFromVector({{I(1), I(0)},
+                                         {D(2.5), I(1)},
+                                         {U, I(2)},
+                                         {I(7), I(3)},
+                                         {VocabId(3), I(4)},
+                                         {I(-4), I(5)},
+                                         {D(-0.5), I(6)}});
+
+  // Check that the `expression` can be compiled iff `isCompiled` is true, and
+  // that the `Filter` with the `expression` keeps exactly the rows of the
+  // `input` with the given `expectedRows` (the values of `?y`), both for a
+  // fully materialized and for a lazy input.
+  auto check = [&](SparqlExpression::Ptr expression, bool isCompiled,
+                   const std::vector<int64_t>& expectedRows,
+                   ad_utility::source_location l = AD_CURRENT_SOURCE_LOC()) {
+    auto trace = generateLocationTrace(l);
+    IdTable expected{2, makeAllocator()};
+    for (int64_t row : expectedRows) {
+      expected.push_back(input[row]);
+    }
+    EXPECT_EQ(expression
+                  ->compileForFilter({{x, makeAlwaysDefinedColumn(0)},
+                                      {y, makeAlwaysDefinedColumn(1)}},
+                                     *qec)
+                  .has_value(),
+              isCompiled);
+    SparqlExpressionPimpl pimpl{std::move(expression), "compiled filter"};
+    std::vector<std::optional<Variable>> variables{x, y};
+    for (size_t numBlocks : {1, 3}) {
+      std::shared_ptr<QueryExecutionTree> subtree;
+      if (numBlocks == 1) {
+        subtree = ad_utility::makeExecutionTree<ValuesForTesting>(
+            qec, input.clone(), variables, false, std::vector<ColumnIndex>{},
+            LocalVocab{}, std::nullopt, true);
+      } else {
+        std::vector<IdTable> blocks;
+        for (size_t i = 0; i < numBlocks; ++i) {
+          IdTable block{2, makeAllocator()};
+          for (size_t row = i * input.numRows() / numBlocks;
+               row < (i + 1) * input.numRows() / numBlocks; ++row) {
+            block.push_back(input[row]);
+          }
+          blocks.push_back(std::move(block));
+        }
+        subtree = ad_utility::makeExecutionTree<ValuesForTesting>(
+            qec, std::move(blocks), variables);
+      }
+      qec->getQueryTreeCache().clearAll();
+      Filter filter{qec, std::move(subtree), pimpl};
+      auto result =
+          filter.getResult(false, ComputationMode::FULLY_MATERIALIZED);
+      ASSERT_TRUE(result->isFullyMaterialized());
+      EXPECT_THAT(result->idTable(), matchesIdTable(expected))
+          << "numBlocks: " << numBlocks;
+    }
+  };
+
+  check(ltSprql(x, I(2)), true, {0, 5, 6});
+  check(gtSprql(D(2.0), x), true, {0, 5, 6});
+  check(neqSprql(x, I(7)), true, {0, 1, 5, 6});
+  check(andSprqlExpr(geSprql(x, I(0)), ltSprql(x, I(10))), true, {0, 1, 3});
+  check(orSprqlExpr(ltSprql(x, D(-1.0)), eqSprql(y, I(4))), true, {4, 5});
+  check(isNumericSprql(x), true, {0, 1, 3, 5, 6});
+  check(andSprqlExpr(isNumericSprql(x), gtSprql(y, I(4))), true, {5, 6});
+  check(ltSprql(x, y), false, {5, 6});
+  check(notSprqlExpr(ltSprql(x, I(2))), false, {1, 3});
+  check(andSprqlExpr(ltSprql(x, I(2)), notSprqlExpr(eqSprql(y, I(0)))), false,
+        {5, 6});
+  check(ltSprql(Variable{"?notInInput"}, I(2)), false, {});
+}
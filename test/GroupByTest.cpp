@@ -638,6 +638,77 @@ TEST_F(GroupByOptimizations, hashMapOptimizationLazyAndMaterializedInputs) {
   runTest(false);
 }
 
+// _____________________________________________________________________________
+TEST_F(GroupByOptimizations, hashMapOptimizationParallelAndSpilling) {
+  auto cleanup =
+      setRuntimeParameterForTest<&RuntimeParameters::groupByHashMapEnabled_>(
+          true);
+  /* Setup query:
+  SELECT ?x (AVG(?y) as ?avg) (MIN(?y) as ?minY) WHERE {
+    # explicitly defined subresult.
+  } GROUP BY ?x
+ */
+  // Three lazy input blocks that are large enough to be aggregated in
+  // parallel. Most of the groups of the later blocks don't occur in the first
+  // block, so they are spilled when the memory threshold is exceeded.
+  std::vector<IdTable> tables;
+  std::map<int64_t, std::pair<int64_t, int64_t>> sumAndCountPerGroup;
+  std::map<int64_t, int64_t> minPerGroup;
+  for (int64_t block = 0; block < 3; ++block) {
+    IdTable table{2, makeAllocator()};
+    for (int64_t i = 0; i < 20'000; ++i) {
+      int64_t x = block * 3'000 + (i * 31) % 5'000;
+      int64_t y = (i + block) % 13;
+      table.push_back({I(x), I(y)});
+      auto& [sum, count] = sumAndCountPerGroup[x];
+      sum += y;
+      ++count;
+      auto [it, isNew] = minPerGroup.try_emplace(x, y);
+      it->second = std::min(it->second, y);
+    }
+    tables.push_back(std::move(table));
+  }
+  IdTable expected{3, makeAllocator()};
+  for (const auto& [x, sumAndCount] : sumAndCountPerGroup) {
+    auto [sum, count] = sumAndCount;
+    expected.push_back({I(x),
+                        D(static_cast<double>(sum) / static_cast<double>(count)),
+                        I(minPerGroup.at(x))});
+  }
+
+  auto runTest = [&](size_t numThreads, ad_utility::MemorySize threshold,
+                     bool expectSpilling) {
+    auto cleanupThreads = setRuntimeParameterForTest<
+        &RuntimeParameters::groupByHashMapNumThreads_>(numThreads);
+    auto cleanupThreshold = setRuntimeParameterForTest<
+        &RuntimeParameters::groupByHashMapInMemoryThreshold_>(threshold);
+    std::vector<IdTable> input;
+    for (const auto& table : tables) {
+      input.push_back(table.clone());
+    }
+    auto subtree = ad_utility::makeExecutionTree<ValuesForTesting>(
+        qec, std::move(input),
+        std::vector<std::optional<Variable>>{Variable{"?x"}, Variable{"?y"}});
+    std::vector<Alias> aliases{Alias{makeAvgPimpl(varY), Variable{"?avg"}},
+                               Alias{makeMinPimpl(varY), Variable{"?minY"}}};
+
+    qec->getQueryTreeCache().clearAll();
+    GroupByImpl groupBy{qec, variablesOnlyX, aliases, std::move(subtree)};
+    auto result = groupBy.computeResultOnlyForTesting();
+    ASSERT_TRUE(result.isFullyMaterialized());
+    EXPECT_THAT(result.idTable(), matchesIdTable(expected));
+    EXPECT_EQ(groupBy.runtimeInfo().details_.contains("numSpilledRows"),
+              expectSpilling);
+  };
+  using namespace ad_utility::memory_literals;
+  runTest(1, 1_GB, false);
+  runTest(4, 1_GB, false);
+  // With a threshold of one byte, the rows of all the groups that are not
+  // contained in the first block are spilled.
+  runTest(1, 1_B, true);
+  runTest(4, 1_B, true);
+}
+
 // _____________________________________________________________________________
 TEST_F(GroupByOptimizations, correctResultForHashMapOptimizationForCountStar) {
   /* Setup query:
@@ -13,6 +13,8 @@
 #include "util/AllocatorTestHelpers.h"
 #include "util/IdTableHelpers.h"
 #include "util/IndexTestHelpers.h"
+#include "util/Random.h"
+#include "util/RuntimeParametersTestHelpers.h"
 
 // _____________________________________________________________________________
 TEST(IdTableUtils, countDistinct) {
@@ -43,3 +45,79 @@ TEST(IdTableUtils, countDistinct) {
                                  ::testing::HasSubstr("must be sorted"));
   }
 }
+
+// _____________________________________________________________________________
+TEST(IdTableUtils, radixSortByKey) {
+  auto alloc = ad_utility::testing::makeAllocator();
+  ad_utility::FastRandomIntGenerator<uint64_t> randomKey{
+      ad_utility::RandomSeed::make(42)};
+  // Keys with only few different bits (s.t. most of the digits are skipped),
+  // and keys with many duplicates (to check the stability).
+  std::vector<uint64_t> masks{0xFF00FF, 0x7, ~uint64_t{0}};
+  for (size_t numElements : {0UL, 17UL, 1'000UL, 300'000UL}) {
+    for (uint64_t mask : masks) {
+      for (size_t numThreads : {1, 4}) {
+        ad_utility::KeysAndRows keysAndRows(alloc);
+        for (size_t i = 0; i < numElements; ++i) {
+          keysAndRows.push_back({randomKey() & mask, i});
+        }
+        auto expected = keysAndRows;
+        ql::ranges::stable_sort(expected, std::less{},
+                                &ad_utility::KeyAndRow::key_);
+        ad_utility::radixSortByKey(keysAndRows, numThreads);
+        ASSERT_EQ(keysAndRows.size(), expected.size());
+        for (size_t i = 0; i < numElements; ++i) {
+          ASSERT_EQ(keysAndRows[i].key_, expected[i].key_);
+          ASSERT_EQ(keysAndRows[i].row_, expected[i].row_);
+        }
+      }
+    }
+  }
+}
+
+// _____________________________________________________________________________
+TEST(IdTableUtils, radixSortOfIdTable) {
+  auto I = ad_utility::testing::IntId;
+  auto V = ad_utility::testing::VocabId;
+  ad_utility::SlowRandomIntGenerator<int64_t> randomInt{
+      -50, 50, ad_utility::RandomSeed::make(42)};
+  IdTable input{3, ad_utility::testing::makeAllocator()};
+  for (size_t i = 0; i < 3 * IdTableUtils::minNumRowsForRadixSort; ++i) {
+    int64_t value = randomInt();
+    input.push_back({I(value), V(value + 50), I(static_cast<int64_t>(i))});
+  }
+
+  for (size_t numThreads : {1, 4}) {
+    auto cleanup =
+        setRuntimeParameterForTest<&RuntimeParameters::sortNumThreads_>(
+            numThreads);
+    // `IdTableUtils::sort` orders by the bits of the `Id`s.
+    std::vector<ColumnIndex> sortCols{1, 2};
+    IdTable sorted = input.clone();
+    IdTableUtils::sort(sorted, sortCols);
+    IdTable expected = input.clone();
+    std::sort(expected.begin(), expected.end(),
+              [](const auto& a, const auto& b) {
+                return std::tie(a[1], a[2]) < std::tie(b[1], b[2]);
+              });
+    EXPECT_EQ(sorted, expected);
+
+    // Sort by custom keys (here: the integers of the first column in
+    // descending order). The sort is stable, so rows with the same key stay
+    // ordered by their last column.
+    sorted = input.clone();
+    IdTableUtils::radixSort(sorted, {0}, [](Id id, size_t i) {
+      EXPECT_EQ(i, 0);
+      return ~static_cast<uint64_t>(id.getInt() + 50);
+    });
+    expected = input.clone();
+    std::sort(expected.begin(), expected.end(),
+              [](const auto& a, const auto& b) {
+                if (a[0] != b[0]) {
+                  return a[0].getInt() > b[0].getInt();
+                }
+                return a[2].getInt() < b[2].getInt();
+              });
+    EXPECT_EQ(sorted, expected);
+  }
+}
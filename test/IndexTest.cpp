@@ -958,3 +958,92 @@ TEST(IndexImpl, graphNameManagerIntegration) {
   EXPECT_THAT(graphManager.prefixWithoutBraces_,
               testing::StrEq(QLEVER_NEW_GRAPH_PREFIX));
 }
+
+// _____________________________________________________________________________
+TEST(IndexImpl, createFromShards) {
+  // All the files of the shards and of the merged indices are written to a
+  // temporary directory, which is deleted at the end of the test.
+  auto [directory, cleanup] = makeTemporaryDirectory("createFromShards");
+  std::string basename = directory + "/index";
+  auto writeSettingsFile = [&basename](std::string_view name,
+                                       std::string_view settings) {
+    std::string settingsFile = absl::StrCat(basename, ".", name, ".json");
+    std::ofstream f{settingsFile};
+    f << settings;
+    return settingsFile;
+  };
+  std::string settingsFile = writeSettingsFile("settings", "{}");
+  auto makeIndex = [&settingsFile](const std::string& onDiskBase) {
+    Index index = makeIndexWithTestSettings();
+    index.setOnDiskBase(onDiskBase);
+    index.setSettingsFile(settingsFile);
+    index.usePatterns() = false;
+    index.loadAllPermutations() = true;
+    return index;
+  };
+
+  // Both shards contain a blank node with the label `_:x`, which must become
+  // two different blank nodes, and the triple `<a> <p> <b>`, which must only
+  // be contained once in the final index.
+  std::vector<std::string> shardInputs{
+      "<a> <p> <b> . _:x <p> <a> .",
+      "<b> <p> <c> . _:x <p> <b> . <a> <p> <b> ."};
+  std::vector<std::string> shardBasenames;
+  for (size_t i = 0; i < shardInputs.size(); ++i) {
+    std::string shardBasename = absl::StrCat(basename, ".shard", i);
+    std::string inputFile = shardBasename + ".nt";
+    {
+      std::ofstream f{inputFile};
+      f << shardInputs.at(i);
+    }
+    Index shard = makeIndex(shardBasename);
+    shard.createShardFromFiles(
+        {{inputFile, qlever::Filetype::Turtle, std::nullopt}}, i);
+    shardBasenames.push_back(shardBasename);
+  }
+
+  {
+    Index index = makeIndex(basename);
+    index.createFromShards(shardBasenames);
+  }
+  Index index = makeIndex(basename);
+  index.createFromOnDiskIndex(basename, false);
+  EXPECT_EQ(index.numTriples().normal, 4u);
+  EXPECT_EQ(index.numDistinctSubjects().normal, 4u);
+  EXPECT_EQ(index.numDistinctObjects().normal, 3u);
+
+  // The shard files are not modified, so the shards can be merged again.
+  {
+    Index secondIndex = makeIndex(basename + ".second");
+    secondIndex.createFromShards(shardBasenames);
+  }
+
+  // Merging requires at least one shard.
+  EXPECT_ANY_THROW(makeIndex(basename).createFromShards({}));
+
+  // The shard indices must be different.
+  AD_EXPECT_THROW_WITH_MESSAGE(
+      makeIndex(basename + ".third")
+          .createFromShards({shardBasenames.at(0), shardBasenames.at(0)}),
+      ::testing::HasSubstr("have the same shard index 0"));
+
+  // The settings that affect the IDs or the sort order must be the same for
+  // the shards and the merge.
+  settingsFile = writeSettingsFile(
+      "otherLocale",
+      R"({"locale": {"language": "en", "country": "US", )"
+      R"("ignore-punctuation": true}})");
+  AD_EXPECT_THROW_WITH_MESSAGE(
+      makeIndex(basename + ".third").createFromShards(shardBasenames),
+      ::testing::HasSubstr("was built with settings that differ"));
+
+  // Files without the header of a shard are rejected.
+  std::string notAShard = basename + ".notAShard";
+  {
+    std::ofstream f{absl::StrCat(notAShard, SHARD_TRIPLES_SUFFIX)};
+    f << "This is not a shard, but long enough to contain a header.";
+  }
+  AD_EXPECT_THROW_WITH_MESSAGE(
+      makeIndex(basename + ".third").createFromShards({notAShard}),
+      ::testing::HasSubstr("is not a shard of an index build"));
+}
@@ -985,3 +985,174 @@ TEST(JoinAlgorithms, SpecialOptionalJoinComplexCombination) {
   };
   testSpecialOptionalJoinWithSplits(leftTable, rightTable, expectedResult);
 }
+
+namespace {
+// Create a sorted vector of `size` random `Id`s from the vocabulary with
+// indices in `[0, maxIndex]`, which contains duplicates if `maxIndex` is small.
+std::vector<Id> makeSortedRandomIds(std::mt19937_64& randomEngine, size_t size,
+                                    size_t maxIndex) {
+  std::uniform_int_distribution<size_t> distribution{0, maxIndex};
+  std::vector<Id> result;
+  for (size_t i = 0; i < size; ++i) {
+    result.push_back(ad_utility::testing::VocabId(distribution(randomEngine)));
+  }
+  ql::ranges::sort(result);
+  return result;
+}
+
+using PositionPairs = std::vector<std::pair<size_t, size_t>>;
+
+// Join `left` and `right` with the `joinFunction` (which is called with the
+// two spans and an action) and return the positions of the matching pairs.
+template <typename JoinFunction>
+PositionPairs joinPositions(const std::vector<Id>& left,
+                            const std::vector<Id>& right,
+                            const JoinFunction& joinFunction) {
+  ql::span<const Id> leftSpan{left};
+  ql::span<const Id> rightSpan{right};
+  PositionPairs result;
+  joinFunction(leftSpan, rightSpan, [&](auto itLeft, auto itRight) {
+    result.emplace_back(itLeft - leftSpan.begin(),
+                        itRight - rightSpan.begin());
+  });
+  return result;
+}
+}  // namespace
+
+// _____________________________________________________________________________
+TEST(JoinAlgorithms, JoinForIdsWithoutUndef) {
+  std::mt19937_64 randomEngine{4242};
+  for (auto instructionSet : {InstructionSet::Scalar, InstructionSet::Avx2,
+                              InstructionSet::Avx512}) {
+    if (!isSupported(instructionSet)) {
+      continue;
+    }
+    for (size_t i = 0; i < 200; ++i) {
+      // Cover equal-sized and very differently sized inputs, many and few
+      // matches, and many duplicates.
+      size_t sizeLeft = randomEngine() % 200;
+      size_t sizeRight = i % 2 == 0 ? randomEngine() % 200 : 20'000;
+      size_t maxIndex = std::array<size_t, 4>{5, 100, 10'000, 1'000'000}[i % 4];
+      auto left = makeSortedRandomIds(randomEngine, sizeLeft, maxIndex);
+      auto right = makeSortedRandomIds(randomEngine, sizeRight, maxIndex);
+      auto expected = joinPositions(left, right, [](auto l, auto r, auto act) {
+        zipperJoinWithUndef(l, r, std::less<>{}, act, noop, noop);
+      });
+      EXPECT_EQ(
+          joinPositions(left, right,
+                        [instructionSet](auto l, auto r, auto act) {
+                          zipperJoinForIdsWithoutUndef(l, r, act, noop,
+                                                       instructionSet);
+                        }),
+          expected);
+      EXPECT_EQ(
+          joinPositions(left, right,
+                        [instructionSet](auto l, auto r, auto act) {
+                          gallopingJoinForIdsWithoutUndef(l, r, act, noop,
+                                                          instructionSet);
+                        }),
+          expected);
+    }
+  }
+}
+
+// _____________________________________________________________________________
+TEST(JoinAlgorithms, GallopingLowerBound) {
+  using ad_utility::testing::VocabId;
+  std::mt19937_64 randomEngine{2424};
+  auto ids = makeSortedRandomIds(randomEngine, 1000, 500);
+  for (auto instructionSet : {InstructionSet::Scalar, InstructionSet::Avx2,
+                              InstructionSet::Avx512}) {
+    if (!isSupported(instructionSet)) {
+      continue;
+    }
+    for (size_t begin : {0, 1, 17, 500, 999, 1000}) {
+      for (size_t needle = 0; needle <= 501; ++needle) {
+        auto expected =
+            std::lower_bound(ids.begin() + begin, ids.end(), VocabId(needle)) -
+            ids.begin();
+        EXPECT_EQ(simdJoin::gallopingLowerBound(ids, begin, VocabId(needle),
+                                                instructionSet),
+                  expected);
+      }
+    }
+  }
+  EXPECT_TRUE(isSupported(simdJoin::bestSupportedInstructionSet()));
+  EXPECT_TRUE(isSupported(InstructionSet::Scalar));
+}
+
+// _____________________________________________________________________________
+TEST(JoinAlgorithms, PartitionForParallelJoin) {
+  using P = JoinPartition;
+  std::vector<size_t> left{1, 2, 2, 2, 3, 5, 7, 8};
+  std::vector<size_t> right{2, 2, 4, 5, 5, 6, 8, 9};
+  auto partition = [&](size_t numPartitions) {
+    return partitionForParallelJoin(left, right, std::less<>{}, numPartitions);
+  };
+  EXPECT_THAT(partition(1), ::testing::ElementsAre(P{0, 8, 0, 8}));
+  EXPECT_THAT(partition(0), ::testing::ElementsAre(P{0, 8, 0, 8}));
+  // The splitters are 2 and 5 (the 6th and the 11th smallest element of the
+  // merged inputs). The first partition only contains the `1` from `left`, so
+  // it is omitted.
+  EXPECT_THAT(partition(3),
+              ::testing::ElementsAre(P{1, 5, 0, 3}, P{5, 8, 3, 8}));
+  EXPECT_THAT(partition(4), ::testing::ElementsAre(
+                                P{1, 5, 0, 3}, P{5, 6, 3, 6}, P{6, 8, 6, 8}));
+  // Partitions where one side is empty are omitted.
+  EXPECT_THAT(partitionForParallelJoin(left, std::vector<size_t>{},
+                                       std::less<>{}, 4),
+              ::testing::IsEmpty());
+
+  // Randomized test: The partitions are consecutive, contain at least one
+  // element on both sides, no value is split between two partitions, and
+  // joining the partitions yields the same result as joining the whole
+  // inputs.
+  std::mt19937_64 randomEngine{1234};
+  auto countMatches = [](const auto& l, const auto& r, size_t beginLeft,
+                         size_t endLeft, size_t beginRight, size_t endRight) {
+    size_t count = 0;
+    for (size_t i = beginLeft; i < endLeft; ++i) {
+      for (size_t j = beginRight; j < endRight; ++j) {
+        count += l[i] == r[j];
+      }
+    }
+    return count;
+  };
+  for (size_t i = 0; i < 500; ++i) {
+    size_t maxValue = 1 + randomEngine() % 100;
+    auto makeInput = [&]() {
+      std::vector<size_t> input(randomEngine() % 100);
+      for (auto& value : input) {
+        value = randomEngine() % maxValue;
+      }
+      ql::ranges::sort(input);
+      return input;
+    };
+    auto l = makeInput();
+    auto r = makeInput();
+    size_t numPartitions = 1 + randomEngine() % 10;
+    auto partitions =
+        partitionForParallelJoin(l, r, std::less<>{}, numPartitions);
+    EXPECT_LE(partitions.size(), numPartitions);
+    size_t numMatches = 0;
+    size_t previousEndLeft = 0;
+    size_t previousEndRight = 0;
+    for (const auto& p : partitions) {
+      EXPECT_LE(previousEndLeft, p.beginLeft_);
+      EXPECT_LE(previousEndRight, p.beginRight_);
+      EXPECT_LT(p.beginLeft_, p.endLeft_);
+      EXPECT_LT(p.beginRight_, p.endRight_);
+      if (p.beginLeft_ > 0) {
+        EXPECT_NE(l[p.beginLeft_ - 1], l[p.beginLeft_]);
+      }
+      if (p.beginRight_ > 0) {
+        EXPECT_NE(r[p.beginRight_ - 1], r[p.beginRight_]);
+      }
+      numMatches += countMatches(l, r, p.beginLeft_, p.endLeft_, p.beginRight_,
+                                 p.endRight_);
+      previousEndLeft = p.endLeft_;
+      previousEndRight = p.endRight_;
+    }
+    EXPECT_EQ(numMatches, countMatches(l, r, 0, l.size(), 0, r.size()));
+  }
+}
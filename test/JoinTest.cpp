@@ -20,14 +20,18 @@
 #include "engine/IndexScan.h"
 #include "engine/Join.h"
 #include "engine/JoinHelpers.h"
+#include "engine/MaterializedViews.h"
+#include "engine/NamedResultCache.h"
 #include "engine/NeutralOptional.h"
 #include "engine/QueryExecutionTree.h"
+#include "engine/Sort.h"
 #include "engine/Values.h"
 #include "engine/ValuesForTesting.h"
 #include "engine/idTable/IdTable.h"
 #include "index/IdTableUtils.h"
 #include "util/Forward.h"
 #include "util/IndexTestHelpers.h"
+#include "util/RuntimeParametersTestHelpers.h"
 #include "util/OperationTestHelpers.h"
 #include "util/Random.h"
 #include "util/RuntimeParametersTestHelpers.h"
@@ -229,6 +233,39 @@ TEST(JoinTest, joinTest) {
   runTestCasesForAllJoinAlgorithms(createJoinTestSet());
 };
 
+// _____________________________________________________________________________
+TEST(JoinTest, parallelJoin) {
+  // Split even the small inputs of the test cases into partitions that are
+  // joined in parallel.
+  auto cleanupNumThreads =
+      setRuntimeParameterForTest<&RuntimeParameters::joinMaxNumThreads_>(4);
+  auto cleanupMinNumRows =
+      setRuntimeParameterForTest<&RuntimeParameters::joinParallelMinNumRows_>(
+          0);
+  runTestCasesForAllJoinAlgorithms(createJoinTestSet());
+
+  // A larger join with many matches and duplicates on both sides.
+  VectorTable left;
+  VectorTable right;
+  VectorTable expected;
+  for (int64_t i = 0; i < 10'000; ++i) {
+    left.push_back({i / 3, i});
+    right.push_back({i / 2, i + 10'000});
+  }
+  for (int64_t i = 0; i < 10'000; ++i) {
+    for (int64_t j = i / 3 * 2; j < std::min(i / 3 * 2 + 2, int64_t{10'000});
+         ++j) {
+      expected.push_back({i / 3, i, j + 10'000});
+    }
+  }
+  IdTable a = makeIdTableFromVector(left);
+  IdTable b = makeIdTableFromVector(right);
+  auto result = useJoinFunctionOnIdTables(IdTableAndJoinColumn{a.clone(), 0},
+                                          IdTableAndJoinColumn{b.clone(), 0},
+                                          makeJoinLambda());
+  EXPECT_EQ(result, makeIdTableFromVector(expected));
+}
+
 // Several helpers for the test cases below.
 namespace {
 
@@ -643,6 +680,76 @@ TEST_P(JoinTestParametrized, joinTwoScansWithSubjectInMultipleBlocks) {
   testJoinOperation(joinSwitched, expectedColumns, true, true);
 }
 
+// _____________________________________________________________________________
+TEST(JoinTest, joinScanWithLocalVocabEntriesFromDeltaTriples) {
+  // The result of an index scan has an empty local vocab, even if it contains
+  // `Id`s from the local vocab of the delta triples. These are ordered by their
+  // string, not by their bits, so the SIMD join algorithms must not be used.
+  auto index = std::make_shared<Index>(ad_utility::testing::makeTestIndex(
+      "joinScanWithLocalVocabEntriesFromDeltaTriples",
+      "<a> <p> <c> . <c> <q> <z> ."));
+  auto id = ad_utility::testing::makeGetId(*index);
+  auto cancellationHandle =
+      std::make_shared<ad_utility::SharedCancellationHandle::element_type>();
+  index->deltaTriplesManager().modify<void>([&](DeltaTriples& deltaTriples) {
+    auto b = TripleComponent{iri("<b>")}.toValueId(index->getImpl(),
+                                                   deltaTriples.localVocab());
+    auto g = TripleComponent{iri(DEFAULT_GRAPH_IRI)}.toValueId(*index).value();
+    deltaTriples.insertTriples(
+        cancellationHandle,
+        {IdTriple<0>{std::array{id("<a>"), id("<p>"), b, g}}});
+  });
+
+  QueryResultCache cache;
+  NamedResultCache namedCache;
+  QueryExecutionContext qec{
+      index, &cache, makeAllocator(ad_utility::MemorySize::megabytes(100)),
+      SortPerformanceEstimator{}, &namedCache,
+      std::make_shared<MaterializedViewsManager>()};
+  auto cleanup = setRuntimeParameterForTest<
+      &RuntimeParameters::lazyIndexScanMaxSizeMaterialization_>(1'000'000);
+
+  using enum Permutation::Enum;
+  auto scanLeft = ad_utility::makeExecutionTree<IndexScan>(
+      &qec, PSO, SparqlTripleSimple{iri("<a>"), iri("<p>"), Variable{"?x"}});
+  auto scanRight = ad_utility::makeExecutionTree<IndexScan>(
+      &qec, PSO,
+      SparqlTripleSimple{Variable{"?x"}, iri("<q>"), Variable{"?y"}});
+  Join join{&qec, scanLeft, scanRight, 0, 0};
+  auto result = join.getResult();
+  ASSERT_TRUE(result->isFullyMaterialized());
+  EXPECT_EQ(result->idTable(), makeIdTableFromVector({{id("<c>"), id("<z>")}}));
+}
+
+// _____________________________________________________________________________
+TEST(JoinTest, passJoinColumnSummaryOfMaterializedLeftChild) {
+  // Make sure that none of the children is considered small, s.t. the left
+  // child is only materialized by the generic `getResult` call.
+  auto cleanup = setRuntimeParameterForTest<
+      &RuntimeParameters::lazyIndexScanMaxSizeMaterialization_>(0);
+  auto qec = ad_utility::testing::getQec(
+      "<a> <p> <A> . <b> <p> <B> . <c> <p> <C> . <d> <p> <D> . ");
+  qec->getQueryTreeCache().clearAll();
+  auto id = ad_utility::testing::makeGetId(qec->getIndex());
+
+  auto left = ad_utility::makeExecutionTree<ValuesForTesting>(
+      qec, makeIdTableFromVector({{id("<c>")}}), Vars{Variable{"?s"}}, false,
+      std::vector<ColumnIndex>{0}, LocalVocab{}, std::nullopt, true);
+  // The summary is not passed to an `IndexScan` child directly (it is
+  // prefiltered by the join itself), but to the `Sort` above it.
+  auto scan = ad_utility::makeExecutionTree<IndexScan>(
+      qec, Permutation::Enum::PSO,
+      SparqlTripleSimple{Variable{"?s"}, iri("<p>"), Variable{"?o"}});
+  auto right = ad_utility::makeExecutionTree<Sort>(qec, scan,
+                                                   std::vector<ColumnIndex>{0});
+  Join join{qec, left, right, 0, 0, true, false};
+  auto result = join.getResult();
+  EXPECT_EQ(result->idTable(), makeIdTableFromVector({{id("<c>"), id("<C>")}}));
+  EXPECT_EQ(join.runtimeInfo().details_["num-ranges-of-join-column-summary"],
+            1);
+  EXPECT_FALSE(scan->getRootOperation()->canResultBeCached());
+}
+
 // _____________________________________________________________________________
 TEST(JoinTest, invalidJoinVariable) {
   auto qec = ad_utility::testing::getQec(
@@ -16,6 +16,7 @@
 #include "util/IdTestHelpers.h"
 #include "util/IndexTestHelpers.h"
 #include "util/OperationTestHelpers.h"
+#include "util/RuntimeParametersTestHelpers.h"
 
 using ad_utility::testing::makeAllocator;
 namespace {
@@ -81,6 +82,38 @@ TEST(EngineTest, multiColumnJoinTest) {
   ASSERT_EQ(wantedRes[3], vres[3]);
 }
 
+// _____________________________________________________________________________
+TEST(MultiColumnJoin, parallelJoin) {
+  auto* qec = ad_utility::testing::getQec();
+  // The join columns are (1, 2) on the left and (2, 1) on the right, both
+  // inputs are sorted by them and contain duplicates.
+  VectorTable leftRows;
+  VectorTable rightRows;
+  for (int64_t i = 0; i < 3'000; ++i) {
+    leftRows.push_back({i, i / 10, (i % 10) / 3});
+    rightRows.push_back({i, (i % 6) / 2, i / 6});
+  }
+  IdTable left = makeIdTableFromVector(leftRows);
+  IdTable right = makeIdTableFromVector(rightRows);
+  std::vector<std::array<ColumnIndex, 2>> joinColumns{{1, 2}, {2, 1}};
+  auto join = [&]() {
+    IdTable result{4, makeAllocator()};
+    MultiColumnJoin{qec, idTableToExecutionTree(qec, left),
+                    idTableToExecutionTree(qec, right)}
+        .computeMultiColumnJoin(left, right, joinColumns, &result);
+    return result;
+  };
+  auto expected = join();
+  ASSERT_FALSE(expected.empty());
+
+  auto cleanupNumThreads =
+      setRuntimeParameterForTest<&RuntimeParameters::joinMaxNumThreads_>(7);
+  auto cleanupMinNumRows =
+      setRuntimeParameterForTest<&RuntimeParameters::joinParallelMinNumRows_>(
+          0);
+  EXPECT_EQ(join(), expected);
+}
+
 // _____________________________________________________________________________
 TEST(MultiColumnJoin, clone) {
   auto* qec = ad_utility::testing::getQec();
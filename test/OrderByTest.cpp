@@ -10,8 +10,10 @@
 #include "engine/OrderBy.h"
 #include "engine/ValuesForTesting.h"
 #include "global/ValueIdComparators.h"
+#include "index/IdTableUtils.h"
 #include "util/IndexTestHelpers.h"
 #include "util/OperationTestHelpers.h"
+#include "util/Random.h"
 
 using namespace std::string_literals;
 using namespace std::chrono_literals;
@@ -198,6 +200,68 @@ TEST(OrderBy, mixedDatatypes) {
               {true});
 }
 
+// _____________________________________________________________________________
+TEST(OrderBy, largeInputsWithRadixSort) {
+  auto I = ad_utility::testing::IntId;
+  auto V = ad_utility::testing::VocabId;
+  auto D = ad_utility::testing::DoubleId;
+  auto U = Id::makeUndefined();
+  ad_utility::SlowRandomIntGenerator<int64_t> randomInt{
+      -100, 100, ad_utility::RandomSeed::make(42)};
+  ad_utility::RandomDoubleGenerator randomDouble{
+      -1e6, 1e6, ad_utility::RandomSeed::make(43)};
+
+  // The first column contains only integers and undefined values, the second
+  // one doubles and vocab indices, so the radix sort is used. The third column
+  // contains integers and doubles, which have to be compared by their numeric
+  // values, so with this column the comparison-based sort is used.
+  IdTable input{3, ad_utility::testing::makeAllocator()};
+  for (size_t i = 0; i < 2 * IdTableUtils::minNumRowsForRadixSort; ++i) {
+    int64_t value = randomInt();
+    input.push_back({value % 7 == 0 ? U : I(value),
+                     value % 2 == 0 ? D(randomDouble() / 1e3) : V(value + 100),
+                     value % 3 == 0 ? D(value + 0.5) : I(value)});
+  }
+  auto lessThan = [](Id a, Id b) {
+    return toBoolNotUndef(valueIdComparators::compareIds<
+                          valueIdComparators::ComparisonForIncompatibleTypes::
+                              CompareByType>(
+        a, b, valueIdComparators::Comparison::LT));
+  };
+  // Return `input` sorted by the given columns using `lessThan`.
+  auto sortExpected = [&input, &lessThan](std::vector<ColumnIndex> columns,
+                                          std::vector<bool> isDescending) {
+    IdTable result{columns.size(), ad_utility::testing::makeAllocator()};
+    for (const auto& row : input) {
+      result.emplace_back();
+      for (size_t i = 0; i < columns.size(); ++i) {
+        result.back()[i] = row[columns[i]];
+      }
+    }
+    std::sort(result.begin(), result.end(),
+              [&](const auto& row1, const auto& row2) {
+                for (size_t i = 0; i < columns.size(); ++i) {
+                  if (row1[i] != row2[i]) {
+                    return lessThan(row1[i], row2[i]) != isDescending[i];
+                  }
+                }
+                return false;
+              });
+    return result;
+  };
+  auto getColumns = [&input](std::vector<ColumnIndex> columns) {
+    return input.asColumnSubsetView(columns).clone();
+  };
+
+  for (const auto& isDescending : std::vector<std::vector<bool>>{
+           {false, false}, {true, false}, {false, true}}) {
+    testOrderBy(getColumns({0, 1}), sortExpected({0, 1}, isDescending),
+                isDescending);
+    testOrderBy(getColumns({1, 2}), sortExpected({1, 2}, isDescending),
+                isDescending);
+  }
+}
+
 // _____________________________________________________________________________
 TEST(OrderBy, simpleMemberFunctions) {
   {
@@ -1230,6 +1230,52 @@ TEST_F(PrefilterExpressionOnMetadataTest, testWithFewBlockMetadataValues) {
             std::vector<CompressedBlockMetadata>{});
 }
 
+//______________________________________________________________________________
+// Test the prefiltering on the (unsorted) column 2 via the column statistics of
+// the blocks.
+TEST_F(PrefilterExpressionOnMetadataTest, testEvaluateWithColumnStatistics) {
+  using Statistics = CompressedBlockMetadata::ColumnStatistics;
+  auto makeBlockWithStatistics = [](const std::vector<Id>& col2,
+                                    size_t blockIndex) {
+    CompressedBlockMetadata block{};
+    block.blockIndex_ = blockIndex;
+    block.columnStatistics_ = std::array{
+        Statistics{VocabId10}, Statistics{DoubleId33}, Statistics::compute(col2)};
+    return block;
+  };
+  auto s0 = makeBlockWithStatistics({IntId(5), IntId(1), IntId(3)}, 0);
+  // The `Id`s of the negative integers come after the positive ones.
+  auto s1 = makeBlockWithStatistics({IntId(20), IntId(-4)}, 1);
+  auto s2 = makeBlockWithStatistics({DoubleId(2.5), IntId(100)}, 2);
+  auto s3 = makeBlockWithStatistics({referenceDate2, referenceDate1}, 3);
+  auto s4 = makeBlockWithStatistics({IntId(7), BlankNodeId(3)}, 4);
+  // A block without statistics is always relevant.
+  CompressedBlockMetadata s5{};
+  s5.blockIndex_ = 5;
+  std::vector<CompressedBlockMetadata> input{s0, s1, s2, s3, s4, s5};
+  using Blocks = std::vector<CompressedBlockMetadata>;
+
+  EXPECT_EQ(s2.columnStatistics_.value()[2].min_, IntId(100));
+  EXPECT_EQ(s2.columnStatistics_.value()[2].max_, DoubleId(2.5));
+  EXPECT_TRUE(
+      s2.columnStatistics_.value()[2].containsDatatype(Datatype::Double));
+  EXPECT_FALSE(s2.columnStatistics_.value()[2].containsDatatype(Datatype::Date));
+
+  auto evaluate = [this, &input](const auto& expr) {
+    return toVec(expr->evaluateWithColumnStatistics(lvc, input, 2));
+  };
+  EXPECT_EQ(evaluate(gt(IntId(10))), (Blocks{s1, s2, s4, s5}));
+  EXPECT_EQ(evaluate(eq(IntId(6))), (Blocks{s5}));
+  EXPECT_EQ(evaluate(lt(IntId(0))), (Blocks{s1, s2, s4, s5}));
+  EXPECT_EQ(evaluate(andExpr(ge(IntId(2)), le(DoubleId(4.0)))),
+            (Blocks{s0, s2, s5}));
+  EXPECT_EQ(evaluate(ge(referenceDate2)), (Blocks{s3, s5}));
+  EXPECT_EQ(evaluate(isNum()), (Blocks{s0, s1, s2, s4, s5}));
+  // The block `s2` contains different datatypes, but only numeric ones.
+  EXPECT_EQ(evaluate(notExpr(isNum())), (Blocks{s3, s4, s5}));
+  EXPECT_EQ(evaluate(isBlank()), (Blocks{s4, s5}));
+}
+
 //______________________________________________________________________________
 // Test method clone. clone() creates a copy of the complete PrefilterExpression
 // tree.
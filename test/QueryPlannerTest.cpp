@@ -2857,6 +2857,78 @@ TEST(QueryPlanner, testDistributiveJoinInUnion) {
       qec, {4, 16, 64'000'000});
 }
 
+// _____________________________________________________________________________
+TEST(QueryPlanner, HashJoin) {
+  // Two unsorted `VALUES` clauses with 10 rows each, the first row of which
+  // is `firstValue`.
+  auto values = [](int firstValue) {
+    std::string query = "VALUES (?x ?y) {";
+    std::string cacheKey = "VALUES (?x\t?y) {";
+    for (int i = firstValue; i < firstValue + 10; ++i) {
+      int x = (i * 7) % 10;
+      absl::StrAppend(&query, " (", x, " ", i, ")");
+      absl::StrAppend(&cacheKey, " (", x, " ", i, ")");
+    }
+    return std::pair{absl::StrCat(query, " }"), absl::StrCat(cacheKey, " }")};
+  };
+  auto [query1, cacheKey1] = values(0);
+  auto [query2, cacheKey2] = values(5);
+  std::string query = absl::StrCat("SELECT * { ", query1, " ", query2, " }");
+
+  // By default, a hash join is only considered for large inputs.
+  h::expect(query,
+            h::MultiColumnJoin(h::Sort(h::ValuesClause(cacheKey1)),
+                               h::Sort(h::ValuesClause(cacheKey2))));
+
+  // Sorting the inputs is more expensive than hashing them.
+  auto cleanup =
+      setRuntimeParameterForTest<&RuntimeParameters::hashJoinMinNumRowsToSort_>(
+          0);
+  h::expect(query, h::HashJoin(h::ValuesClause(cacheKey1),
+                               h::ValuesClause(cacheKey2)));
+}
+
+// _____________________________________________________________________________
+TEST(QueryPlanner, HashDistinct) {
+  std::string query =
+      "SELECT DISTINCT ?y { VALUES (?x ?y) { (1 3) (2 1) (3 3) (4 2) (5 1) "
+      "(6 4) (7 2) (8 3) } }";
+  std::string cacheKey =
+      "VALUES (?x\t?y) { (1 3) (2 1) (3 3) (4 2) (5 1) (6 4) (7 2) (8 3) }";
+
+  // By default, a hash-based distinct is only considered for large inputs.
+  h::expect(query, h::Distinct({1}, h::Sort(h::ValuesClause(cacheKey))));
+
+  // Sorting the input is more expensive than hashing it.
+  auto cleanup = setRuntimeParameterForTest<
+      &RuntimeParameters::hashDistinctMinNumRowsToSort_>(0);
+  h::expect(query, h::HashDistinct({1}, h::ValuesClause(cacheKey)));
+
+  // An input that is already sorted doesn't need a hash-based distinct.
+  h::expect("SELECT DISTINCT ?x { ?x <p> ?y }",
+            h::Distinct({0}, h::IndexScanFromStrings("?x", "<p>", "?y")));
+}
+
+// _____________________________________________________________________________
+TEST(QueryPlanner, TopK) {
+  using enum ::OrderBy::AscOrDesc;
+  auto scan = h::IndexScanFromStrings("?x", "<is-a>", "?y");
+  ::OrderBy::SortedVariables sortedVariables{{Variable{"?y"}, Desc},
+                                             {Variable{"?x"}, Asc}};
+  std::string query =
+      "SELECT * { ?x <is-a> ?y } ORDER BY DESC(?y) ?x LIMIT 10 OFFSET 5";
+
+  // With a small `LIMIT`, only the first `LIMIT + OFFSET` rows are computed.
+  h::expect(query, h::TopK(15, sortedVariables, scan));
+
+  // Without a `LIMIT` or with a large `LIMIT`, the complete input is sorted.
+  h::expect("SELECT * { ?x <is-a> ?y } ORDER BY DESC(?y) ?x",
+            h::OrderBy(sortedVariables, scan));
+  auto cleanup =
+      setRuntimeParameterForTest<&RuntimeParameters::topKMaxNumRows_>(14);
+  h::expect(query, h::OrderBy(sortedVariables, scan));
+}
+
 // _____________________________________________________________________________
 TEST(QueryPlanner, testDistributiveJoinInUnionDoesntExplode) {
   // Make sure that this is enabled for this test to actually test something.
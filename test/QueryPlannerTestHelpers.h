@@ -22,6 +22,8 @@
 #include "engine/ExplicitIdTableOperation.h"
 #include "engine/Filter.h"
 #include "engine/GroupBy.h"
+#include "engine/HashDistinct.h"
+#include "engine/HashJoin.h"
 #include "engine/IndexScan.h"
 #include "engine/Join.h"
 #include "engine/MaterializedViews.h"
@@ -39,6 +41,7 @@
 #include "engine/TextIndexScanForEntity.h"
 #include "engine/TextIndexScanForWord.h"
 #include "engine/TextLimit.h"
+#include "engine/TopK.h"
 #include "engine/TransitivePathBase.h"
 #include "engine/Union.h"
 #include "engine/Values.h"
@@ -313,6 +316,7 @@ inline auto IndexScanFromStrings =
 // important.
 inline auto MultiColumnJoin = MatchTypeAndUnorderedChildren<::MultiColumnJoin>;
 inline auto Join = MatchTypeAndUnorderedChildren<::Join>;
+inline auto HashJoin = MatchTypeAndUnorderedChildren<::HashJoin>;
 
 constexpr auto OptionalJoin = MatchTypeAndOrderedChildren<::OptionalJoin>;
 
@@ -330,12 +334,13 @@ inline auto UnorderedJoins = [](auto&&... children) -> QetMatcher {
     const Operation* operation = tree.getRootOperation().get();
     auto join = dynamic_cast<const ::Join*>(operation);
     auto multiColJoin = dynamic_cast<const ::MultiColumnJoin*>(operation);
+    auto hashJoin = dynamic_cast<const ::HashJoin*>(operation);
     // Also allow the INTERNAL SORT BY operations that are needed for the
     // joins.
     // TODO<joka921> is this the right place to also check that those have
     // the correct columns?
     auto sort = dynamic_cast<const ::Sort*>(operation);
-    if (!join && !sort && !multiColJoin) {
+    if (!join && !sort && !multiColJoin && !hashJoin) {
       children.push_back(tree);
     } else {
       for (const auto& child : operation->getChildren()) {
@@ -489,6 +494,15 @@ constexpr auto OrderBy = [](const ::OrderBy::SortedVariables& sortedVariables,
             AD_PROPERTY(::OrderBy, getSortedVariables, Eq(sortedVariables))));
 };
 
+// Match a `TopK` operation.
+constexpr auto TopK = [](size_t numRows,
+                         const ::OrderBy::SortedVariables& sortedVariables,
+                         const QetMatcher& childMatcher) {
+  return RootOperation<::TopK>(
+      AllOf(children(childMatcher), AD_PROPERTY(::TopK, getNumRows, numRows),
+            AD_PROPERTY(::TopK, getSortedVariables, Eq(sortedVariables))));
+};
+
 // Match a `UNION` operation.
 constexpr auto Union = MatchTypeAndOrderedChildren<::Union>;
 
@@ -501,6 +515,16 @@ constexpr auto Distinct = [](const std::vector<ColumnIndex>& distinctColumns,
                         UnorderedElementsAreArray(distinctColumns))));
 };
 
+// Match a `HashDistinct` operation.
+constexpr auto HashDistinct =
+    [](const std::vector<ColumnIndex>& distinctColumns,
+       const QetMatcher& childMatcher) {
+      return RootOperation<::HashDistinct>(
+          AllOf(children(childMatcher),
+                AD_PROPERTY(::HashDistinct, getDistinctColumns,
+                            UnorderedElementsAreArray(distinctColumns))));
+    };
+
 // Match a `DESCRIBE` operation
 inline QetMatcher Describe(
     const Matcher<const parsedQuery::Describe&>& describeMatcher,
@@ -19,6 +19,7 @@
 #include "index/ConstantsIndexBuilding.h"
 #include "parser/ParallelBuffer.h"
 #include "parser/RdfParser.h"
+#include "parser/SimdScanner.h"
 #include "parser/Tokenizer.h"
 #include "parser/TokenizerCtre.h"
 #include "parser/TripleComponent.h"
@@ -881,6 +882,69 @@ TEST(RdfParserTest, iriref) {
   runTestsForParser(ctreParser());
 }
 
+// Test the vectorized scan for the end of an IRI reference against the scalar
+// implementation for all supported instruction sets.
+TEST(RdfParserTest, findFirstNonIrirefCharacter) {
+  using namespace ad_utility::simdScanner;
+  using ad_utility::InstructionSet;
+  using ad_utility::isSupported;
+  EXPECT_TRUE(isSupported(InstructionSet::Scalar));
+  EXPECT_TRUE(isSupported(bestSupportedInstructionSet()));
+  std::string allowed = "http://example.org/\xC3\xA4" "bc_0123456789-";
+  std::string special = "<>\"{}|^`\\ \n\t";
+  special.push_back('\0');
+  for (auto instructionSet :
+       {InstructionSet::Scalar, InstructionSet::Sse2, InstructionSet::Avx2}) {
+    if (!isSupported(instructionSet)) {
+      continue;
+    }
+    auto find = [instructionSet](std::string_view input) {
+      return findFirstNonIrirefCharacter(input, instructionSet);
+    };
+    EXPECT_EQ(find(""), 0u);
+    // Test all positions and lengths that are relevant for the blocks of 16
+    // and 32 bytes.
+    for (size_t length = 0; length < 100; ++length) {
+      std::string input;
+      for (size_t i = 0; i < length; ++i) {
+        input.push_back(allowed[i % allowed.size()]);
+      }
+      EXPECT_EQ(find(input), length);
+      for (size_t pos = 0; pos < length; ++pos) {
+        char c = special[(pos + length) % special.size()];
+        std::string withSpecial = input;
+        withSpecial[pos] = c;
+        EXPECT_EQ(find(withSpecial), pos) << length << ' ' << int(c);
+        // Only the first special character is found.
+        withSpecial.back() = '>';
+        EXPECT_EQ(find(withSpecial), pos);
+      }
+    }
+  }
+}
+
+// Test IRI references that are handled by the fast path in
+// `TurtleParser::iriref` and those that require the regex.
+TEST(RdfParserTest, irirefFastPathAndRegex) {
+  auto runTestsForParser = [](auto parser) {
+    std::string longIri =
+        "<http://example.org/a/very/long/iri/with/an/\xC3\xA4/in/it>";
+    parser.setInputStream(longIri + " <next>");
+    ASSERT_TRUE(parser.iriref());
+    EXPECT_EQ(parser.lastParseResult_, iri(longIri));
+    ASSERT_TRUE(parser.iriref());
+    EXPECT_EQ(parser.lastParseResult_, iri("<next>"));
+
+    // Escape sequences are not handled by the fast path.
+    parser.setInputStream("<http://example.org/\\u0041> .");
+    ASSERT_TRUE(parser.iriref());
+    EXPECT_TRUE(parser.lastParseResult_.isIri());
+    EXPECT_EQ(parser.getPosition(), 27u);
+  };
+  runTestsForParser(re2Parser());
+  runTestsForParser(ctreParser());
+}
+
 // Parse the file at `filename` using a parser of type `Parser` and return the
 // sorted result. Iff `useBatchInterface` then the `getBatch()` function is used
 // for parsing, else `getLine()` is used. The default size for the parse buffer
@@ -10,6 +10,7 @@
 #include "./SparqlExpressionTestHelpers.h"
 #include "./util/GTestHelpers.h"
 #include "./util/TripleComponentTestHelpers.h"
+#include "engine/sparqlExpressions/DistinctValueCachingExpression.h"
 #include "engine/sparqlExpressions/LiteralExpression.h"
 #include "engine/sparqlExpressions/NaryExpression.h"
 #include "engine/sparqlExpressions/RegexExpression.h"
@@ -202,6 +203,71 @@ TEST(RegexExpression, nonPrefixRegex) {
                         {T, F, T, T, T, U}, false);
 }
 
+// Test that a regex with a constant pattern is only evaluated once per distinct
+// value of the variable.
+TEST(RegexExpression, distinctValueCaching) {
+  auto isCaching = [](const SparqlExpression::Ptr& expression) {
+    return dynamic_cast<const DistinctValueCachingExpression*>(
+        expression.get());
+  };
+  auto expr = makeRegexExpression("?vocab", "ph");
+  const auto* cachingExpr = isCaching(expr);
+  ASSERT_NE(cachingExpr, nullptr);
+  EXPECT_EQ(cachingExpr->numCachedResults(), 0);
+  testWithExplicitResult(*expr, {F, T, T});
+  EXPECT_EQ(cachingExpr->numCachedResults(), 3);
+  // The second evaluation reads the results from the cache.
+  testWithExplicitResult(*expr, {F, T, T});
+  testWithExplicitResult(*expr, {F, T}, 2);
+  EXPECT_EQ(cachingExpr->numCachedResults(), 3);
+
+  // Repeated values in the input.
+  {
+    TestContext ctx;
+    auto rows = ctx.table.clone();
+    for (size_t i = 0; i < 2; ++i) {
+      for (const auto& row : rows) {
+        ctx.table.push_back(row);
+      }
+    }
+    ctx.context._endIndex = ctx.table.size();
+    auto result = makeRegexExpression("?vocab", "l.h")->evaluate(&ctx.context);
+    EXPECT_THAT(std::get<VectorWithMemoryLimit<Id>>(result),
+                ::testing::ElementsAre(F, T, T, F, T, T, F, T, T));
+  }
+
+  // The results for entries of the local vocab are not cached across
+  // evaluations.
+  auto localVocabExpr = makeRegexExpression("?localVocab", "InV");
+  testWithExplicitResult(*localVocabExpr, {T, T, U});
+  ASSERT_TRUE(isCaching(localVocabExpr));
+  EXPECT_EQ(isCaching(localVocabExpr)->numCachedResults(), 0);
+
+  // Only expressions with a constant pattern are wrapped.
+  EXPECT_FALSE(
+      isCaching(makeTestRegexExpression(variable("?vocab"), variable("?a"))));
+  EXPECT_TRUE(isCaching(makeRegexExpression("?vocab", "ph", std::nullopt,
+                                            true)));
+  EXPECT_FALSE(isCaching(makeTestRegexExpression(
+      variable("?vocab"), literal("\"ph\""), variable("?a"))));
+
+  // Constant flags are merged into the constant pattern, also if the variable
+  // is wrapped in `STR()`.
+  auto withFlags = makeRegexExpression("?vocab", "PH", "i");
+  ASSERT_TRUE(isCaching(withFlags));
+  testWithExplicitResult(*withFlags, {F, T, T});
+  EXPECT_EQ(isCaching(withFlags)->numCachedResults(), 3);
+  auto withFlagsAndStr = makeRegexExpression("?vocab", "^ALP", "i", true);
+  ASSERT_TRUE(isCaching(withFlagsAndStr));
+  testWithExplicitResult(*withFlagsAndStr, {F, T, F});
+  EXPECT_TRUE(isCaching(
+      makeContainsExpression(variable("?vocab"), literal("\"ph\""))));
+  EXPECT_TRUE(isCaching(
+      makeStrEndsExpression(variable("?vocab"), literal("\"ph\""))));
+  EXPECT_FALSE(isCaching(
+      makeContainsExpression(literal("\"ph\""), variable("?vocab"))));
+}
+
 // Test where the expression is not simply a variable.
 TEST(RegexExpression, inputNotVariable) {
   auto* qec = ad_utility::testing::getQec();
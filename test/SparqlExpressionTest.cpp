@@ -603,6 +603,75 @@ TEST(SparqlExpression, arithmeticOperators) {
   testDivide(nanAndInf, divByZeroInputsInt, D(0));
 }
 
+// _____________________________________________________________________________
+TEST(SparqlExpression, batchEvaluationOnColumns) {
+  // Numeric, relational, and boolean expressions on operands that only contain
+  // `Int`s, only `Double`s, or only `Bool`s are evaluated on all rows at once.
+  // The results must be the same as for the row-by-row evaluation.
+  TestContext ctx;
+  auto var = [](std::string_view name) -> SparqlExpression::Ptr {
+    return std::make_unique<VariableExpression>(Variable{std::string{name}});
+  };
+  auto id = [](Id value) -> SparqlExpression::Ptr {
+    return std::make_unique<IdExpression>(value);
+  };
+  auto greaterThanZero = [&id](SparqlExpression::Ptr child) {
+    return std::make_unique<GreaterThanExpression>(
+        std::array<SparqlExpression::Ptr, 2>{std::move(child), id(I(0))});
+  };
+  auto expectResult = [&ctx](const SparqlExpression::Ptr& expression,
+                             Ids expected,
+                             source_location l = AD_CURRENT_SOURCE_LOC()) {
+    auto t = generateLocationTrace(l);
+    EXPECT_THAT(expression->evaluate(&ctx.context),
+                ::testing::VariantWith<V<Id>>(sparqlExpressionResultMatcher(
+                    toExpressionResult(std::move(expected)))));
+  };
+
+  // The columns are `?ints = {1, 0, -1}`, `?doubles = {0.1, -0.1, 2.8}`, and
+  // `?numeric = {1, -0.1, 3.4}` (an `Int` and two `Double`s).
+  expectResult(makeAddExpression(var("?ints"), var("?doubles")),
+               {D(1.1), D(-0.1), D(1.8)});
+  expectResult(makeMultiplyExpression(var("?ints"), id(I(3))),
+               {I(3), I(0), I(-3)});
+  expectResult(makeUnaryMinusExpression(var("?doubles")),
+               {D(-0.1), D(0.1), D(-2.8)});
+  expectResult(makeDivideExpression(var("?ints"), id(I(0))), {U, U, U});
+  expectResult(makeSubtractExpression(var("?ints"), var("?numeric")),
+               {I(0), D(0.1), D(-4.4)});
+  expectResult(std::make_unique<LessThanExpression>(
+                   std::array{var("?doubles"), var("?ints")}),
+               {B(true), B(true), B(false)});
+  expectResult(std::make_unique<LessThanExpression>(
+                   std::array{var("?numeric"), id(D(0.5))}),
+               {B(false), B(true), B(false)});
+  expectResult(makeAndExpression(greaterThanZero(var("?ints")),
+                                 greaterThanZero(var("?doubles"))),
+               {B(true), B(false), B(false)});
+  expectResult(makeUnaryNegateExpression(greaterThanZero(var("?ints"))),
+               {B(false), B(true), B(true)});
+
+  // If one of the operands has a datatype that is not supported by the batch
+  // evaluation (here `Bool`s for a numeric or `Int`s for a boolean
+  // expression), the generic evaluation is used, which converts the values.
+  expectResult(makeAddExpression(var("?ints"), greaterThanZero(var("?ints"))),
+               {I(2), I(0), I(-1)});
+  expectResult(makeAddExpression(greaterThanZero(var("?ints")), var("?ints")),
+               {I(2), I(0), I(-1)});
+  expectResult(makeOrExpression(greaterThanZero(var("?ints")), var("?ints")),
+               {B(true), B(false), B(true)});
+  expectResult(makeAndExpression(var("?ints"), greaterThanZero(var("?ints"))),
+               {B(true), B(false), B(false)});
+
+  // Only the rows of the current range are evaluated.
+  ctx.context._beginIndex = 1;
+  expectResult(makeAddExpression(var("?ints"), var("?doubles")),
+               {D(-0.1), D(1.8)});
+  expectResult(std::make_unique<LessThanExpression>(
+                   std::array{var("?doubles"), var("?ints")}),
+               {B(true), B(false)});
+}
+
 // Test that the unary expression that is specified by the `makeFunction` yields
 // the `expected` result when being given the `operand`.
 template <auto makeFunction>
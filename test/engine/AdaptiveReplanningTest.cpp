@@ -0,0 +1,141 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#include <gmock/gmock.h>
+
+#include "../util/IdTableHelpers.h"
+#include "../util/IndexTestHelpers.h"
+#include "engine/AdaptiveReplanning.h"
+#include "engine/Join.h"
+#include "engine/ValuesForTesting.h"
+
+using namespace ad_utility::testing;
+using namespace qlever::adaptiveReplanning;
+
+namespace {
+// Return a `ValuesForTesting` with `numRows` rows that all bind `?x` to `value`
+// and a multiplicity of 1, s.t. the size estimate of a join of two of them is
+// far too small.
+std::shared_ptr<QueryExecutionTree> makeValues(QueryExecutionContext* qec,
+                                               size_t numRows, int64_t value) {
+  VectorTable rows(numRows, {value});
+  return ad_utility::makeExecutionTree<ValuesForTesting>(
+      qec, makeIdTableFromVector(rows),
+      std::vector<std::optional<Variable>>{Variable{"?x"}}, false,
+      std::vector<ColumnIndex>{0}, LocalVocab{}, 1.0f);
+}
+
+// Return the tree `(a JOIN b) JOIN c`, where the inner join has 40'000 rows.
+QueryExecutionTree makeTree(QueryExecutionContext* qec) {
+  auto inner = ad_utility::makeExecutionTree<Join>(
+      qec, makeValues(qec, 200, 1), makeValues(qec, 200, 1), 0, 0);
+  return QueryExecutionTree{
+      qec, std::make_shared<Join>(qec, inner, makeValues(qec, 1, 1), 0, 0)};
+}
+}  // namespace
+
+// _____________________________________________________________________________
+TEST(AdaptiveReplanning, isEstimateOff) {
+  EXPECT_FALSE(isEstimateOff(100, 100, 10.0));
+  EXPECT_FALSE(isEstimateOff(100, 999, 10.0));
+  EXPECT_TRUE(isEstimateOff(100, 2000, 10.0));
+  EXPECT_FALSE(isEstimateOff(100, 20, 10.0));
+  EXPECT_TRUE(isEstimateOff(100, 0, 10.0));
+  EXPECT_FALSE(isEstimateOff(0, 0, 10.0));
+  EXPECT_FALSE(isEstimateOff(0, 5, 10.0));
+  EXPECT_TRUE(isEstimateOff(0, 50, 10.0));
+}
+
+// _____________________________________________________________________________
+TEST(AdaptiveReplanning, getLowestJoins) {
+  auto* qec = getQec();
+  auto qet = makeTree(qec);
+  auto lowestJoins = getLowestJoins(qet);
+  ASSERT_EQ(lowestJoins.size(), 1u);
+  EXPECT_EQ(lowestJoins.at(0), qet.getRootOperation()->getChildren().at(0));
+
+  // The root itself is never returned.
+  auto* inner = lowestJoins.at(0);
+  EXPECT_TRUE(getLowestJoins(*inner).empty());
+}
+
+// _____________________________________________________________________________
+TEST(AdaptiveReplanning, computeLowestJoinsAndObserveSizes) {
+  auto* qec = getQec();
+  qec->observedResultSizes().clear();
+  auto qet = makeTree(qec);
+  ad_utility::HashSet<std::string> checkedCacheKeys;
+
+  // With a very large threshold, the sizes are not stored.
+  EXPECT_FALSE(
+      computeLowestJoinsAndObserveSizes(qet, *qec, 1e9, checkedCacheKeys));
+  EXPECT_EQ(checkedCacheKeys.size(), 1u);
+  EXPECT_TRUE(qec->observedResultSizes().empty());
+
+  // Joins are only checked once.
+  EXPECT_FALSE(
+      computeLowestJoinsAndObserveSizes(qet, *qec, 10.0, checkedCacheKeys));
+  EXPECT_TRUE(qec->observedResultSizes().empty());
+
+  checkedCacheKeys.clear();
+  EXPECT_TRUE(
+      computeLowestJoinsAndObserveSizes(qet, *qec, 10.0, checkedCacheKeys));
+  const auto& innerKey = getLowestJoins(qet).at(0)->getCacheKey();
+  ASSERT_TRUE(qec->observedResultSizes().contains(innerKey));
+  EXPECT_EQ(qec->observedResultSizes().at(innerKey), 40'000u);
+  qec->observedResultSizes().clear();
+}
+
+// _____________________________________________________________________________
+TEST(AdaptiveReplanning, createExecutionTreeWithAdaptiveReplanning) {
+  auto* qec = getQec();
+  qec->observedResultSizes().clear();
+  size_t numPlans = 0;
+  auto createExecutionTree = [&numPlans, qec]() {
+    ++numPlans;
+    return makeTree(qec);
+  };
+  size_t numPrepared = 0;
+  auto prepare = [&numPrepared](QueryExecutionTree&) { ++numPrepared; };
+
+  // Adaptive re-planning is disabled.
+  createExecutionTreeWithAdaptiveReplanning(*qec, createExecutionTree, prepare,
+                                            0, 10.0);
+  EXPECT_EQ(numPlans, 1u);
+  EXPECT_EQ(numPrepared, 0u);
+
+  // The size of the inner join is off, so the query is planned again, after
+  // which the observed size is used as the estimate.
+  numPlans = 0;
+  auto qet = createExecutionTreeWithAdaptiveReplanning(
+      *qec, createExecutionTree, prepare, 5, 10.0);
+  EXPECT_EQ(numPlans, 2u);
+  EXPECT_EQ(numPrepared, 2u);
+  EXPECT_EQ(getLowestJoins(qet).at(0)->getSizeEstimate(), 40'000u);
+  qec->observedResultSizes().clear();
+}
+
+// _____________________________________________________________________________
+TEST(AdaptiveReplanning, observeResultSize) {
+  auto* qec = getQec();
+
+  // A fully materialized result is computed completely.
+  auto materialized = ad_utility::makeExecutionTree<ValuesForTesting>(
+      qec, makeIdTableFromVector(VectorTable(200, {1})),
+      std::vector<std::optional<Variable>>{Variable{"?x"}}, false,
+      std::vector<ColumnIndex>{0}, LocalVocab{}, std::nullopt, true);
+  EXPECT_EQ(observeResultSize(*materialized, 1, 10.0), 200u);
+
+  // A lazy result is only counted until the size is known to be off.
+  std::vector<IdTable> tables;
+  for (size_t i = 0; i < 10; ++i) {
+    tables.push_back(makeIdTableFromVector(VectorTable(10, {1})));
+  }
+  auto lazy = ad_utility::makeExecutionTree<ValuesForTesting>(
+      qec, std::move(tables),
+      std::vector<std::optional<Variable>>{Variable{"?x"}});
+  EXPECT_EQ(observeResultSize(*lazy, 2, 10.0), 30u);
+  EXPECT_EQ(observeResultSize(*lazy, 10, 10.0), 100u);
+  // A size that is smaller than the estimate is computed completely.
+  EXPECT_EQ(observeResultSize(*lazy, 100'000, 10.0), 100u);
+}
@@ -0,0 +1,163 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#include <gmock/gmock.h>
+
+#include <set>
+
+#include "../util/GTestHelpers.h"
+#include "../util/IdTableHelpers.h"
+#include "../util/IndexTestHelpers.h"
+#include "../util/RuntimeParametersTestHelpers.h"
+#include "engine/Distinct.h"
+#include "engine/HashDistinct.h"
+#include "engine/QueryExecutionTree.h"
+#include "engine/ValuesForTesting.h"
+#include "index/IdTableUtils.h"
+
+using namespace ad_utility::testing;
+
+namespace {
+auto I = IntId;
+using Vars = std::vector<std::optional<Variable>>;
+
+// Return a `QueryExecutionTree` with a `ValuesForTesting` operation with the
+// given `blocks`. A single block is always fully materialized, more blocks are
+// yielded lazily.
+std::shared_ptr<QueryExecutionTree> makeTree(std::vector<IdTable> blocks) {
+  Vars variables;
+  for (size_t i = 0; i < blocks.at(0).numColumns(); ++i) {
+    variables.emplace_back(Variable{absl::StrCat("?", i)});
+  }
+  if (blocks.size() == 1) {
+    return ad_utility::makeExecutionTree<ValuesForTesting>(
+        getQec(), std::move(blocks.at(0)), std::move(variables), false,
+        std::vector<ColumnIndex>{}, LocalVocab{}, std::nullopt, true);
+  }
+  return ad_utility::makeExecutionTree<ValuesForTesting>(
+      getQec(), std::move(blocks), std::move(variables));
+}
+
+// Compute the result of `distinct` (lazily if `requestLaziness` is true and
+// the input is lazy) and return it as a single `IdTable`.
+IdTable computeDistinct(HashDistinct& distinct, bool requestLaziness) {
+  getQec()->getQueryTreeCache().clearAll();
+  auto result = distinct.computeResultOnlyForTesting(requestLaziness);
+  if (result.isFullyMaterialized()) {
+    return result.idTable().clone();
+  }
+  IdTable table{distinct.getResultWidth(), makeAllocator()};
+  for (const auto& [block, localVocab] : result.idTables()) {
+    EXPECT_FALSE(block.empty());
+    table.insertAtEnd(block);
+  }
+  return table;
+}
+}  // namespace
+
+// _____________________________________________________________________________
+TEST(HashDistinct, properties) {
+  std::vector<IdTable> input;
+  input.push_back(makeIdTableFromVector({{1, 2}, {1, 3}}, I));
+  auto tree = makeTree(std::move(input));
+  HashDistinct distinct{getQec(), tree, {0}};
+  HashDistinct distinct2{getQec(), tree, {0, 1}};
+  Distinct sortedDistinct{getQec(), tree, {0}};
+  EXPECT_NE(distinct.getCacheKey(), distinct2.getCacheKey());
+  EXPECT_NE(distinct.getCacheKey(), sortedDistinct.getCacheKey());
+  EXPECT_EQ(distinct.getDescriptor(), "HashDistinct");
+  EXPECT_EQ(distinct.getResultWidth(), 2);
+  EXPECT_TRUE(distinct.resultSortedOn().empty());
+  EXPECT_EQ(distinct.getVariableColumns(), tree->getVariableColumns());
+  EXPECT_THAT(distinct.getDistinctColumns(), ::testing::ElementsAre(0));
+  EXPECT_THAT(distinct.getChildren(), ::testing::ElementsAre(tree.get()));
+  // The input doesn't have to be sorted, so the child is not changed.
+  EXPECT_EQ(distinct.clone()->getCacheKey(), distinct.getCacheKey());
+}
+
+// _____________________________________________________________________________
+TEST(HashDistinct, materializedAndLazyInput) {
+  VectorTable input{{1, 1, 3, 7}, {6, 1, 3, 6}, {2, 2, 3, 5},
+                    {3, 6, 5, 4}, {1, 6, 5, 1}, {4, 2, 3, 0},
+                    {5, 7, 5, 2}, {3, 1, 3, 8}};
+  // The first occurrences of the distinct values of the columns 1 and 2, in
+  // the order of the input.
+  VectorTable expected{{1, 1, 3, 7}, {2, 2, 3, 5}, {3, 6, 5, 4}, {5, 7, 5, 2}};
+  for (size_t numBlocks : {1, 2, 3, 8}) {
+    std::vector<IdTable> blocks;
+    for (size_t i = 0; i < numBlocks; ++i) {
+      blocks.push_back(makeIdTableFromVector(
+          VectorTable(input.begin() + i * input.size() / numBlocks,
+                      input.begin() + (i + 1) * input.size() / numBlocks),
+          I));
+    }
+    HashDistinct distinct{getQec(), makeTree(std::move(blocks)), {2, 1}};
+    for (bool requestLaziness : {false, true}) {
+      EXPECT_THAT(computeDistinct(distinct, requestLaziness),
+                  matchesIdTableFromVector(expected, I));
+      EXPECT_FALSE(distinct.runtimeInfo().details_.contains("numSpilledRows"));
+    }
+  }
+}
+
+// _____________________________________________________________________________
+TEST(HashDistinct, spilling) {
+  // Three blocks, most of the values of which don't occur in the previous
+  // blocks.
+  std::vector<IdTable> blocks;
+  std::set<std::pair<int64_t, int64_t>> distinctKeys;
+  IdTable expectedInOrder{3, makeAllocator()};
+  for (int64_t block = 0; block < 3; ++block) {
+    IdTable table{3, makeAllocator()};
+    for (int64_t i = 0; i < 20'000; ++i) {
+      int64_t x = block * 3'000 + (i * 31) % 5'000;
+      int64_t y = x % 7;
+      table.push_back({I(i), I(x), I(y)});
+      if (distinctKeys.emplace(x, y).second) {
+        expectedInOrder.push_back({I(i), I(x), I(y)});
+      }
+    }
+    blocks.push_back(std::move(table));
+  }
+
+  auto runTest = [&](ad_utility::MemorySize threshold, bool expectSpilling,
+                     ad_utility::source_location l = AD_CURRENT_SOURCE_LOC()) {
+    auto trace = generateLocationTrace(l);
+    auto cleanup = setRuntimeParameterForTest<
+        &RuntimeParameters::hashDistinctInMemoryThreshold_>(threshold);
+    for (bool lazyInput : {false, true}) {
+      std::vector<IdTable> input;
+      for (const auto& table : blocks) {
+        input.push_back(table.clone());
+      }
+      if (!lazyInput) {
+        IdTable merged{3, makeAllocator()};
+        for (const auto& table : input) {
+          merged.insertAtEnd(table);
+        }
+        input.clear();
+        input.push_back(std::move(merged));
+      }
+      HashDistinct distinct{getQec(), makeTree(std::move(input)), {1, 2}};
+      for (bool requestLaziness : {false, true}) {
+        IdTable result = computeDistinct(distinct, requestLaziness);
+        EXPECT_EQ(distinct.runtimeInfo().details_.contains("numSpilledRows"),
+                  expectSpilling);
+        if (!expectSpilling) {
+          // Without spilling, the rows are in the order of the input.
+          EXPECT_THAT(result, matchesIdTable(expectedInOrder));
+          continue;
+        }
+        IdTable expected = expectedInOrder.clone();
+        IdTableUtils::sort(result, {1, 2});
+        IdTableUtils::sort(expected, {1, 2});
+        EXPECT_THAT(result, matchesIdTable(expected));
+      }
+    }
+  };
+  using namespace ad_utility::memory_literals;
+  runTest(1_GB, false);
+  // With a threshold of one byte, only the keys of the first rows are kept in
+  // the hash set and all the others are deduplicated via the spill files.
+  runTest(1_B, true);
+}
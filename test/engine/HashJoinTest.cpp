@@ -0,0 +1,249 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#include <gmock/gmock.h>
+
+#include <array>
+#include <bit>
+
+#include "../util/AllocatorTestHelpers.h"
+#include "../util/GTestHelpers.h"
+#include "../util/IdTableHelpers.h"
+#include "../util/IndexTestHelpers.h"
+#include "../util/RuntimeParametersTestHelpers.h"
+#include "engine/HashJoin.h"
+#include "engine/JoinHashTable.h"
+#include "engine/QueryExecutionTree.h"
+#include "engine/ValuesForTesting.h"
+
+using namespace ad_utility::testing;
+
+namespace {
+auto I = IntId;
+using Vars = std::vector<std::optional<Variable>>;
+
+// Return the indices of the rows of the build side of `hashTable` that match
+// the `probeRow`-th row of `probeKeys`.
+std::vector<size_t> getMatches(const JoinHashTable& hashTable,
+                               const IdTable& probeKeys, size_t probeRow) {
+  std::vector<size_t> matches;
+  hashTable.forEachMatch(probeKeys.asStaticView<0>(), probeRow,
+                         [&matches](size_t row) { matches.push_back(row); });
+  return matches;
+}
+
+// Return a `JoinHashTable` for the given `keys` that is built by `numThreads`
+// threads.
+JoinHashTable makeHashTable(
+    const IdTable& keys, size_t numThreads,
+    ad_utility::AllocatorWithLimit<Id> allocator = makeAllocator()) {
+  return JoinHashTable{keys.asStaticView<0>(), numThreads, allocator,
+                       std::make_shared<ad_utility::CancellationHandle<>>()};
+}
+
+// Compute the `HashJoin` of the `left` and `right` tree (without swapping
+// them) and check that the result is equal to `expected` (including the order
+// of the rows).
+void testHashJoin(std::shared_ptr<QueryExecutionTree> left,
+                  std::shared_ptr<QueryExecutionTree> right,
+                  const VectorTable& expected, bool expectBuildSideIsLeft,
+                  ad_utility::source_location l = AD_CURRENT_SOURCE_LOC()) {
+  auto trace = generateLocationTrace(l);
+  HashJoin join{getQec(), std::move(left), std::move(right), false};
+  EXPECT_EQ(join.buildSideIsLeft(), expectBuildSideIsLeft);
+  for (bool requestLaziness : {false, true}) {
+    auto result = join.computeResultOnlyForTesting(requestLaziness);
+    IdTable table{join.getResultWidth(), makeAllocator()};
+    if (result.isFullyMaterialized()) {
+      table = result.idTable().clone();
+    } else {
+      for (const auto& [block, localVocab] : result.idTables()) {
+        table.insertAtEnd(block);
+      }
+    }
+    EXPECT_THAT(table, matchesIdTableFromVector(expected, I));
+  }
+}
+
+// Return a `QueryExecutionTree` with a `ValuesForTesting` operation with the
+// given `content` and `variables`. If `numBlocks` is greater than one, the
+// result is split into that many blocks and yielded lazily.
+std::shared_ptr<QueryExecutionTree> makeTree(const VectorTable& content,
+                                             Vars variables,
+                                             size_t numBlocks = 1) {
+  if (numBlocks <= 1) {
+    return ad_utility::makeExecutionTree<ValuesForTesting>(
+        getQec(), makeIdTableFromVector(content, I), std::move(variables));
+  }
+  std::vector<VectorTable> blocks(numBlocks);
+  for (size_t i = 0; i < content.size(); ++i) {
+    blocks.at(i * numBlocks / content.size()).push_back(content.at(i));
+  }
+  return ad_utility::makeExecutionTree<ValuesForTesting>(
+      getQec(), createLazyIdTables(blocks), std::move(variables));
+}
+}  // namespace
+
+// _____________________________________________________________________________
+TEST(JoinHashTable, singleColumn) {
+  auto keys = makeIdTableFromVector({{3}, {1}, {3}, {2}, {3}, {7}}, I);
+  auto probe = makeIdTableFromVector({{3}, {1}, {4}, {7}, {2}}, I);
+  for (size_t numThreads : {1, 2, 3, 8}) {
+    auto hashTable = makeHashTable(keys, numThreads);
+    EXPECT_EQ(hashTable.numRows(), 6);
+    EXPECT_EQ(hashTable.numPartitions(), std::bit_ceil(numThreads));
+    EXPECT_THAT(getMatches(hashTable, probe, 0),
+                ::testing::ElementsAre(0, 2, 4));
+    EXPECT_THAT(getMatches(hashTable, probe, 1), ::testing::ElementsAre(1));
+    EXPECT_THAT(getMatches(hashTable, probe, 2), ::testing::ElementsAre());
+    EXPECT_THAT(getMatches(hashTable, probe, 3), ::testing::ElementsAre(5));
+    EXPECT_THAT(getMatches(hashTable, probe, 4), ::testing::ElementsAre(3));
+  }
+}
+
+// _____________________________________________________________________________
+TEST(JoinHashTable, multipleColumns) {
+  auto keys =
+      makeIdTableFromVector({{1, 2}, {2, 1}, {1, 2}, {1, 3}, {2, 1}}, I);
+  auto probe = makeIdTableFromVector({{2, 1}, {1, 2}, {3, 1}, {1, 1}}, I);
+  for (size_t numThreads : {1, 4}) {
+    auto hashTable = makeHashTable(keys, numThreads);
+    EXPECT_THAT(getMatches(hashTable, probe, 0), ::testing::ElementsAre(1, 4));
+    EXPECT_THAT(getMatches(hashTable, probe, 1), ::testing::ElementsAre(0, 2));
+    EXPECT_THAT(getMatches(hashTable, probe, 2), ::testing::ElementsAre());
+    EXPECT_THAT(getMatches(hashTable, probe, 3), ::testing::ElementsAre());
+  }
+}
+
+// _____________________________________________________________________________
+TEST(JoinHashTable, manyRows) {
+  // Many rows with few distinct keys, such that there are long chains and
+  // collisions in all the partitions.
+  VectorTable keysVector;
+  for (int64_t i = 0; i < 10'000; ++i) {
+    keysVector.push_back({i % 97});
+  }
+  auto keys = makeIdTableFromVector(keysVector, I);
+  auto probe = makeIdTableFromVector({{0}, {42}, {96}, {97}}, I);
+  auto singleThreaded = makeHashTable(keys, 1);
+  auto multiThreaded = makeHashTable(keys, 4);
+  for (size_t row = 0; row < probe.numRows(); ++row) {
+    auto matches = getMatches(singleThreaded, probe, row);
+    EXPECT_EQ(matches, getMatches(multiThreaded, probe, row));
+    EXPECT_TRUE(ql::ranges::is_sorted(matches));
+    // The key 0 occurs 104 times, 42 and 96 occur 103 times, 97 never.
+    EXPECT_EQ(matches.size(), std::array<size_t, 4>{104, 103, 103, 0}[row]);
+  }
+}
+
+// _____________________________________________________________________________
+TEST(JoinHashTable, memoryLimit) {
+  using namespace ad_utility::memory_literals;
+  VectorTable keysVector;
+  for (int64_t i = 0; i < 1'000; ++i) {
+    keysVector.push_back({i});
+  }
+  auto keys = makeIdTableFromVector(keysVector, I);
+  EXPECT_THROW(makeHashTable(keys, 1, makeAllocator(1_kB)),
+               ad_utility::detail::AllocationExceedsLimitException);
+}
+
+// _____________________________________________________________________________
+TEST(HashJoin, singleJoinColumn) {
+  auto small = [] {
+    return makeTree({{1, 10}, {2, 20}, {2, 21}, {3, 30}, {5, 50}},
+                    {Variable{"?x"}, Variable{"?a"}});
+  };
+  auto large = [](size_t numBlocks = 1) {
+    return makeTree({{200, 2},
+                     {300, 3},
+                     {301, 3},
+                     {400, 4},
+                     {201, 2},
+                     {600, 6},
+                     {500, 5}},
+                    {Variable{"?b"}, Variable{"?x"}}, numBlocks);
+  };
+  // The smaller child is the build side, the result is in the order of the
+  // (possibly lazy) larger child and the matching rows of the build side are
+  // added in their original order.
+  VectorTable expected{{2, 20, 200}, {2, 21, 200}, {3, 30, 300},
+                       {3, 30, 301}, {2, 20, 201}, {2, 21, 201},
+                       {5, 50, 500}};
+  testHashJoin(small(), large(), expected, true);
+  testHashJoin(small(), large(3), expected, true);
+
+  VectorTable expectedSwapped{{200, 2, 20}, {200, 2, 21}, {300, 3, 30},
+                              {301, 3, 30}, {201, 2, 20}, {201, 2, 21},
+                              {500, 5, 50}};
+  testHashJoin(large(), small(), expectedSwapped, false);
+  testHashJoin(large(3), small(), expectedSwapped, false);
+}
+
+// _____________________________________________________________________________
+TEST(HashJoin, multipleJoinColumnsInParallel) {
+  auto cleanupMinNumRows =
+      setRuntimeParameterForTest<&RuntimeParameters::joinParallelMinNumRows_>(
+          0);
+  auto cleanupNumThreads =
+      setRuntimeParameterForTest<&RuntimeParameters::joinMaxNumThreads_>(4);
+  VectorTable build;
+  for (int64_t i = 0; i < 20; ++i) {
+    build.push_back({i % 5, i % 2, i});
+  }
+  VectorTable probe;
+  VectorTable expected;
+  for (int64_t i = 0; i < 1'000; ++i) {
+    int64_t x = (i * 7) % 6;
+    int64_t y = i % 3;
+    probe.push_back({y, i, x});
+    for (const auto& row : build) {
+      if (std::get<int64_t>(row[0]) == x && std::get<int64_t>(row[1]) == y) {
+        expected.push_back({y, i, x, row[2]});
+      }
+    }
+  }
+  // The probe side is fully materialized and split into chunks that are
+  // probed in parallel, and lazy.
+  for (size_t numBlocks : {1, 7}) {
+    testHashJoin(
+        makeTree(probe, {Variable{"?y"}, Variable{"?p"}, Variable{"?x"}},
+                 numBlocks),
+        makeTree(build, {Variable{"?x"}, Variable{"?y"}, Variable{"?a"}}),
+        expected, false);
+  }
+}
+
+// _____________________________________________________________________________
+TEST(HashJoin, resultSortedOn) {
+  auto* qec = getQec();
+  auto build = makeTree({{1, 10}, {2, 20}}, {Variable{"?x"}, Variable{"?a"}});
+  auto makeProbe = [qec](std::vector<ColumnIndex> sortedColumns) {
+    return ad_utility::makeExecutionTree<ValuesForTesting>(
+        qec, makeIdTableFromVector({{100, 1}, {200, 2}, {300, 3}}, I),
+        Vars{Variable{"?b"}, Variable{"?x"}}, false, std::move(sortedColumns));
+  };
+  // The probe side is the right child, so its join column is mapped to the
+  // join column of the left child and its other column is appended.
+  HashJoin join{qec, build, makeProbe({1, 0}), false};
+  ASSERT_TRUE(join.buildSideIsLeft());
+  EXPECT_THAT(join.resultSortedOn(), ::testing::ElementsAre(0, 2));
+  EXPECT_EQ(join.getDescriptor(), "HashJoin on ?x ");
+
+  // The probe side is the left child.
+  HashJoin swapped{qec, makeProbe({0}), build, false};
+  ASSERT_FALSE(swapped.buildSideIsLeft());
+  EXPECT_THAT(swapped.resultSortedOn(), ::testing::ElementsAre(0));
+}
+
+// _____________________________________________________________________________
+TEST(HashJoin, emptyBuildSide) {
+  auto* qec = getQec();
+  auto empty = ad_utility::makeExecutionTree<ValuesForTesting>(
+      qec, IdTable{1, makeAllocator()}, Vars{Variable{"?x"}});
+  HashJoin join{qec, empty, makeTree({{1}, {2}}, {Variable{"?x"}}), false};
+  ASSERT_TRUE(join.buildSideIsLeft());
+  auto result = join.computeResultOnlyForTesting();
+  EXPECT_EQ(result.idTable().numColumns(), 1);
+  EXPECT_TRUE(result.idTable().empty());
+}
@@ -13,6 +13,7 @@
 #include "../util/TripleComponentTestHelpers.h"
 #include "./LazyJoinTestHelpers.h"
 #include "engine/IndexScan.h"
+#include "engine/JoinColumnSummary.h"
 #include "engine/MaterializedViews.h"
 #include "engine/NamedResultCache.h"
 #include "index/IndexImpl.h"
@@ -55,7 +56,9 @@ void testLazyScan(
   }
 
   if (limitOffset.isUnconstrained()) {
-    EXPECT_EQ(numBlocks, partialLazyScanResult.details().numBlocksRead_);
+    // Note: For a join with a column, a block might be read without being
+    // yielded if none of its rows matches the column.
+    EXPECT_LE(numBlocks, partialLazyScanResult.details().numBlocksRead_);
     // The number of read elements might be a bit larger than the final result
     // size, because the first and/or last block might be incomplete, meaning
     // that they have to be completely read, but only partially contribute to
@@ -365,15 +368,15 @@ TEST(IndexScan, lazyScanForJoinOfColumnWithScanTwoVariables) {
   }
   {
     std::vector<TripleComponent> column{iri("<b>"), iri("<q>"), iri("<xb>")};
-    // The first block only contains <a> which doesn't appear in the first
-    // block.
-    testLazyScanForJoinWithColumn(kg, xpy, column, {{2, 5}});
+    // The first block only contains <a> which doesn't appear in the column.
+    // The second block has to be read, but only its rows with <b> are yielded.
+    testLazyScanForJoinWithColumn(kg, xpy, column, {{3, 5}});
   }
   {
     std::vector<TripleComponent> column{iri("<a>"), iri("<q>"), iri("<xb>")};
-    // The first block only contains <a> which only appears in the first two
-    // blocks.
-    testLazyScanForJoinWithColumn(kg, xpy, column, {{0, 4}});
+    // The column only contains <a> which only appears in the first two
+    // blocks. Only the rows with <a> are yielded.
+    testLazyScanForJoinWithColumn(kg, xpy, column, {{0, 3}});
   }
   {
     std::vector<TripleComponent> column{iri("<a>"), iri("<q>"), iri("<xb>")};
@@ -395,11 +398,47 @@ TEST(IndexScan, lazyScanForJoinOfColumnWithScanOneVariable) {
     // The subject (<b>) and predicate (<b>) are fixed, so the object is the
     // join column
     std::vector<TripleComponent> column{iri("<s0>"), iri("<s7>"), iri("<s99>")};
-    // We don't need to scan the middle block that only has <s2> and <s3>
-    testLazyScanForJoinWithColumn(kg, bpy, column, {{0, 1}, {3, 5}});
+    // We don't need to scan the middle block that only has <s2> and <s3>. The
+    // last block (<s6> and <s9>) has to be read, but doesn't contain a match.
+    testLazyScanForJoinWithColumn(kg, bpy, column, {{0, 1}});
   }
 }
 
+// Test that for the complete blocks in the middle of a scan for a join with a
+// column, only the first column is decompressed for blocks without matches,
+// and only the matching rows are yielded for the other blocks.
+TEST(IndexScan, lazyScanForJoinOfColumnWithScanLateMaterialization) {
+  // Two triples per block, so the objects of `<b> <p> ?x` are in the blocks
+  // {<s00>, <s02>}, {<s04>, <s06>}, ..., {<s20>, <s22>}. The triples with
+  // `<q>` only make sure that the other IRIs are part of the vocabulary.
+  std::string kg = "<c> <q> <s05> . <c> <q> <s09> . <c> <q> <s13> . ";
+  for (size_t i = 0; i <= 22; i += 2) {
+    kg += absl::StrCat("<b> <p> <s", absl::Dec(i, absl::kZeroPad2), "> . ");
+  }
+  SparqlTripleSimple bpx{Tc{iri("<b>")}, iri("<p>"), Tc{Var{"?x"}}};
+  auto qec = getQec(kg);
+  IndexScan scan{qec, Permutation::PSO, bpx};
+  std::vector<Id> column;
+  for (std::string_view entry :
+       {"<s00>", "<s05>", "<s09>", "<s13>", "<s14>", "<s22>"}) {
+    column.push_back(iri(entry).toValueId(qec->getIndex()).value());
+  }
+
+  // The block {<s16>, <s18>} is skipped by looking at the block metadata
+  // alone. The blocks {<s04>, <s06>} and {<s08>, <s10>} have to be read,
+  // but their remaining columns are never decompressed.
+  auto lazyScan = scan.lazyScanForJoinOfColumnWithScan(column);
+  testLazyScan(std::move(lazyScan), scan, {{0, 1}, {7, 8}, {11, 12}});
+
+  auto lazyScan2 = scan.lazyScanForJoinOfColumnWithScan(column);
+  size_t numRows = 0;
+  for (const auto& block : lazyScan2) {
+    numRows += block.numRows();
+  }
+  EXPECT_EQ(numRows, 3);
+  EXPECT_EQ(lazyScan2.details().numBlocksSkippedBecauseOfJoin_, 2);
+}
+
 TEST(IndexScan, lazyScanForJoinOfColumnWithScanCornerCases) {
   SparqlTripleSimple threeVars{Tc{Var{"?x"}}, Var{"?b"}, Tc{Var{"?y"}}};
   std::string kg =
@@ -800,12 +839,22 @@ TEST(IndexScan, verifyThatPrefilteredIndexScanResultIsNotCacheable) {
   EXPECT_TRUE(updatedQet.has_value());
   EXPECT_FALSE(updatedQet.value()->getRootOperation()->canResultBeCached());
 
-  // Assert that we don't set a <PrefilterExpression, ColumnIndex> pair for the
-  // second Variable.
+  // The second variable ?z (at ColumnIndex 2) is not sorted, but the
+  // `PrefilterExpression` for it can still be applied via the column
+  // statistics of the blocks.
   prefilterPairs = makePrefilterVec(pr(lt(IntId(10)), V{"?a"}),
                                     pr(gt(DoubleId(22)), V{"?z"}),
                                     pr(gt(IntId(10)), V{"?b"}));
   EXPECT_TRUE(qet->getRootOperation()->canResultBeCached());
+  updatedQet = qet->getUpdatedQueryExecutionTreeWithPrefilterApplied(
+      std::move(prefilterPairs));
+  EXPECT_TRUE(updatedQet.has_value());
+  EXPECT_FALSE(updatedQet.value()->getRootOperation()->canResultBeCached());
+
+  // Assert that we don't set a <PrefilterExpression, ColumnIndex> pair for
+  // variables that are not part of the scan.
+  prefilterPairs = makePrefilterVec(pr(lt(IntId(10)), V{"?a"}),
+                                    pr(gt(IntId(10)), V{"?b"}));
   updatedQet = qet->getUpdatedQueryExecutionTreeWithPrefilterApplied(
       std::move(prefilterPairs));
   // No `PrefilterExpression` should be applied for this `IndexScan`, we don't
@@ -880,15 +929,18 @@ TEST(IndexScan, checkEvaluationWithPrefiltering) {
 
   // For the following tests, the first sorted column given the permutation
   // doesn't match with the corresponding column for the Variable of the
-  // <PrefilterExpression, Variable> pair. We expect that the provided prefilter
-  // is not applicable (and can't be set).
+  // <PrefilterExpression, Variable> pair. The prefilter is then applied via the
+  // column statistics of the blocks, which here exclude all the blocks.
   testSetAndMakeScanWithPrefilterExpr(
       kg, triple, Permutation::PSO,
-      pr(andExpr(gt(DoubleId(12.00)), le(IntId(174))), Variable{"?price"}), {},
-      false);
+      pr(orExpr(gt(IntId(194)), lt(DoubleId(9.5))), Variable{"?price"}), {},
+      true);
   testSetAndMakeScanWithPrefilterExpr(
-      kg, triple, Permutation::POS,
-      pr(andExpr(gt(VocabId(0)), lt(VocabId(100))), Variable{"?x"}), {}, false);
+      kg, triple, Permutation::PSO,
+      pr(isIri(), Variable{"?price"}), {}, true);
+  testSetAndMakeScanWithPrefilterExpr(kg, triple, Permutation::POS,
+                                      pr(lt(VocabId(0)), Variable{"?x"}), {},
+                                      true);
 
   // This knowledge graph yields an incomplete first and last block.
   std::string kgFirstAndLastIncomplete =
@@ -2142,3 +2194,47 @@ TEST(IndexScan, additionalVariablesInDescriptor) {
           Var{"?s"}, Var{"?p"}, Var{"?o"}, {std::pair{3, Var{"?g"}}}}};
   EXPECT_EQ(scan2.getDescriptor(), "IndexScan PSO ?s ?p ?o ?g");
 }
+
+// _____________________________________________________________________________
+TEST(IndexScan, applyJoinColumnSummary) {
+  TestIndexConfig config;
+  // a and b are supposed to share one block and c and d.
+  config.turtleInput =
+      "<a> <p> <A> . <b> <p> <B> . <c> <p> <C> . <d> <p> <D> . ";
+  config.blocksizePermutations = 16_B;
+  auto* qec = getQec(std::move(config));
+  auto getId = makeGetId(qec->getIndex());
+  SparqlTripleSimple triple{Var{"?s"}, iri("<p>"), Var{"?o"}};
+
+  auto summaryOf = [](std::vector<Id> ids) {
+    return JoinColumnSummary::fromSortedColumn(ids, 10).value();
+  };
+  auto c = summaryOf({getId("<c>")});
+
+  // The summary can only be applied to the first (sorted) column of the scan.
+  {
+    IndexScan scan{qec, Permutation::PSO, triple};
+    EXPECT_FALSE(scan.applyJoinColumnSummary(Var{"?o"}, c));
+    EXPECT_FALSE(scan.applyJoinColumnSummary(Var{"?x"}, c));
+    EXPECT_TRUE(scan.canResultBeCached());
+  }
+
+  // If no block can be skipped, the summary is not applied.
+  {
+    IndexScan scan{qec, Permutation::PSO, triple};
+    EXPECT_FALSE(scan.applyJoinColumnSummary(
+        Var{"?s"}, summaryOf({getId("<a>"), getId("<d>")})));
+    EXPECT_TRUE(scan.canResultBeCached());
+  }
+
+  // The block with `<a>` and `<b>` is skipped.
+  {
+    IndexScan scan{qec, Permutation::PSO, triple};
+    EXPECT_TRUE(scan.applyJoinColumnSummary(Var{"?s"}, c));
+    EXPECT_FALSE(scan.canResultBeCached());
+    auto result = scan.computeResultOnlyForTesting(false);
+    EXPECT_EQ(result.idTable(),
+              makeIdTableFromVector({{getId("<c>"), getId("<C>")},
+                                     {getId("<d>"), getId("<D>")}}));
+  }
+}
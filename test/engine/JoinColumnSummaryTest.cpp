@@ -0,0 +1,65 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#include <gmock/gmock.h>
+
+#include "../util/IdTestHelpers.h"
+#include "engine/JoinColumnSummary.h"
+
+using ad_utility::testing::IntId;
+using ad_utility::testing::UndefId;
+
+namespace {
+using Ranges = std::vector<std::pair<Id, Id>>;
+}  // namespace
+
+// _____________________________________________________________________________
+TEST(JoinColumnSummary, fromSortedColumn) {
+  std::vector<Id> column{IntId(1), IntId(1), IntId(3), IntId(5),
+                         IntId(5), IntId(8), IntId(9)};
+
+  // Few distinct values, every value is its own range.
+  auto exact = JoinColumnSummary::fromSortedColumn(column, 10);
+  ASSERT_TRUE(exact.has_value());
+  EXPECT_EQ(exact->ranges(), (Ranges{{IntId(1), IntId(1)},
+                                     {IntId(3), IntId(3)},
+                                     {IntId(5), IntId(5)},
+                                     {IntId(8), IntId(8)},
+                                     {IntId(9), IntId(9)}}));
+
+  // Adjacent distinct values are combined into ranges.
+  auto coarse = JoinColumnSummary::fromSortedColumn(column, 2);
+  ASSERT_TRUE(coarse.has_value());
+  EXPECT_EQ(coarse->ranges(),
+            (Ranges{{IntId(1), IntId(3)}, {IntId(5), IntId(9)}}));
+
+  auto single = JoinColumnSummary::fromSortedColumn(column, 1);
+  ASSERT_TRUE(single.has_value());
+  EXPECT_EQ(single->ranges(), (Ranges{{IntId(1), IntId(9)}}));
+
+  // An empty column has an empty summary.
+  auto empty = JoinColumnSummary::fromSortedColumn({}, 10);
+  ASSERT_TRUE(empty.has_value());
+  EXPECT_TRUE(empty->ranges().empty());
+
+  // UNDEF matches every value, and with zero ranges there is no summary.
+  std::vector<Id> withUndef{UndefId(), IntId(3)};
+  EXPECT_FALSE(JoinColumnSummary::fromSortedColumn(withUndef, 10).has_value());
+  EXPECT_FALSE(JoinColumnSummary::fromSortedColumn(column, 0).has_value());
+}
+
+// _____________________________________________________________________________
+TEST(JoinColumnSummary, mayContainValueBetween) {
+  std::vector<Id> column{IntId(1), IntId(3), IntId(5), IntId(8), IntId(9)};
+  auto summary = JoinColumnSummary::fromSortedColumn(column, 2).value();
+  // The ranges are [1, 3] and [5, 9].
+  EXPECT_TRUE(summary.mayContainValueBetween(IntId(0), IntId(1)));
+  EXPECT_TRUE(summary.mayContainValueBetween(IntId(2), IntId(2)));
+  EXPECT_FALSE(summary.mayContainValueBetween(IntId(4), IntId(4)));
+  EXPECT_TRUE(summary.mayContainValueBetween(IntId(4), IntId(5)));
+  EXPECT_TRUE(summary.mayContainValueBetween(IntId(0), IntId(20)));
+  EXPECT_FALSE(summary.mayContainValueBetween(IntId(10), IntId(20)));
+
+  auto empty = JoinColumnSummary::fromSortedColumn({}, 2).value();
+  EXPECT_FALSE(empty.mayContainValueBetween(IntId(0), IntId(20)));
+}
@@ -0,0 +1,131 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#include <gmock/gmock.h>
+
+#include "../util/GTestHelpers.h"
+#include "../util/IdTableHelpers.h"
+#include "../util/IndexTestHelpers.h"
+#include "engine/OrderBy.h"
+#include "engine/QueryExecutionTree.h"
+#include "engine/TopK.h"
+#include "engine/ValuesForTesting.h"
+#include "util/Random.h"
+
+using namespace ad_utility::testing;
+
+namespace {
+using Vars = std::vector<std::optional<Variable>>;
+
+// Return a `QueryExecutionTree` with a `ValuesForTesting` operation with the
+// given `blocks`. A single block is fully materialized, more blocks are
+// yielded lazily.
+std::shared_ptr<QueryExecutionTree> makeTree(std::vector<IdTable> blocks) {
+  Vars variables;
+  for (size_t i = 0; i < blocks.at(0).numColumns(); ++i) {
+    variables.emplace_back(Variable{absl::StrCat("?", i)});
+  }
+  if (blocks.size() == 1) {
+    return ad_utility::makeExecutionTree<ValuesForTesting>(
+        getQec(), std::move(blocks.at(0)), std::move(variables), false,
+        std::vector<ColumnIndex>{}, LocalVocab{}, std::nullopt, true);
+  }
+  return ad_utility::makeExecutionTree<ValuesForTesting>(
+      getQec(), std::move(blocks), std::move(variables));
+}
+
+// Split the `input` into `numBlocks` blocks of (almost) equal size.
+std::vector<IdTable> splitIntoBlocks(const IdTable& input, size_t numBlocks) {
+  std::vector<IdTable> blocks;
+  for (size_t i = 0; i < numBlocks; ++i) {
+    IdTable block{input.numColumns(), makeAllocator()};
+    for (size_t row = i * input.numRows() / numBlocks;
+         row < (i + 1) * input.numRows() / numBlocks; ++row) {
+      block.push_back(input[row]);
+    }
+    blocks.push_back(std::move(block));
+  }
+  return blocks;
+}
+
+// Check that the `TopK` of the `input` for all the given values of `numRows`
+// is the prefix of the `input` sorted by an `OrderBy` with the same
+// `sortIndices`. The order of the `input` must be total, i.e. no two rows must
+// be equal wrt the `sortIndices`.
+void testTopK(const IdTable& input, const OrderBy::SortIndices& sortIndices,
+              const std::vector<size_t>& numRowsValues,
+              ad_utility::source_location l = AD_CURRENT_SOURCE_LOC()) {
+  auto trace = generateLocationTrace(l);
+  OrderBy orderBy{getQec(), makeTree(splitIntoBlocks(input, 1)), sortIndices};
+  auto sorted = orderBy.computeResultOnlyForTesting();
+  for (size_t numRows : numRowsValues) {
+    IdTable expected = sorted.idTable().clone();
+    expected.resize(std::min(numRows, expected.numRows()));
+    for (size_t numBlocks : {1, 2, 7}) {
+      TopK topK{getQec(), makeTree(splitIntoBlocks(input, numBlocks)),
+                sortIndices, numRows};
+      getQec()->getQueryTreeCache().clearAll();
+      auto result = topK.computeResultOnlyForTesting();
+      ASSERT_TRUE(result.isFullyMaterialized());
+      EXPECT_THAT(result.idTable(), matchesIdTable(expected))
+          << "numRows: " << numRows << ", numBlocks: " << numBlocks;
+    }
+  }
+}
+}  // namespace
+
+// _____________________________________________________________________________
+TEST(TopK, properties) {
+  auto tree = makeTree(
+      splitIntoBlocks(makeIdTableFromVector({{1, 2}, {3, 4}, {5, 6}}), 1));
+  TopK topK{getQec(), tree, {{1, true}}, 2};
+  TopK topK2{getQec(), tree, {{1, true}}, 3};
+  TopK topK3{getQec(), tree, {{1, false}}, 2};
+  OrderBy orderBy{getQec(), tree, {{1, true}}};
+  EXPECT_NE(topK.getCacheKey(), topK2.getCacheKey());
+  EXPECT_NE(topK.getCacheKey(), topK3.getCacheKey());
+  EXPECT_NE(topK.getCacheKey(), orderBy.getCacheKey());
+  EXPECT_EQ(topK.getDescriptor(), "TopK 2 on DESC(?1)");
+  EXPECT_EQ(topK.getNumRows(), 2);
+  EXPECT_EQ(topK.getResultWidth(), 2);
+  EXPECT_TRUE(topK.resultSortedOn().empty());
+  EXPECT_EQ(topK.getSizeEstimate(), 2);
+  EXPECT_EQ(topK2.getSizeEstimate(), 3);
+  EXPECT_EQ(topK.getVariableColumns(), tree->getVariableColumns());
+  EXPECT_EQ(topK.getSortedVariables(),
+            (OrderBy::SortedVariables{
+                {Variable{"?1"}, OrderBy::AscOrDesc::Desc}}));
+  EXPECT_EQ(topK.clone()->getCacheKey(), topK.getCacheKey());
+
+  // A `TopK` of zero rows is empty.
+  TopK empty{getQec(), tree, {{1, true}}, 0};
+  EXPECT_TRUE(empty.knownEmptyResult());
+  EXPECT_TRUE(empty.computeResultOnlyForTesting().idTable().empty());
+}
+
+// _____________________________________________________________________________
+TEST(TopK, randomInput) {
+  // The first column has many duplicates, the second column is unique.
+  ad_utility::SlowRandomIntGenerator<int64_t> randomInt{-50, 50};
+  IdTable input{2, makeAllocator()};
+  for (int64_t i = 0; i < 5'000; ++i) {
+    input.push_back(
+        {Id::makeFromInt(randomInt()), Id::makeFromInt(i * 7'919 % 5'003)});
+  }
+  std::vector<size_t> numRowsValues{1, 10, 999, 1'000, 1'001, 2'500, 10'000};
+  testTopK(input, {{0, false}, {1, false}}, numRowsValues);
+  testTopK(input, {{0, true}, {1, false}}, numRowsValues);
+  testTopK(input, {{1, true}}, numRowsValues);
+}
+
+// _____________________________________________________________________________
+TEST(TopK, mixedDatatypes) {
+  // Integers and doubles are compared by their numeric value.
+  IdTable input{1, makeAllocator()};
+  for (int64_t i = 0; i < 3'000; ++i) {
+    input.push_back({i % 2 == 0 ? Id::makeFromInt(i - 1'500)
+                                : Id::makeFromDouble(1'500.5 - i)});
+  }
+  testTopK(input, {{0, false}}, {1, 7, 2'000});
+  testTopK(input, {{0, true}}, {1, 7, 2'000});
+}
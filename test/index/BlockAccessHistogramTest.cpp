@@ -0,0 +1,132 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#include <gmock/gmock.h>
+
+#include <numeric>
+
+#include "../util/IndexTestHelpers.h"
+#include "index/BlockAccessHistogram.h"
+#include "index/IndexImpl.h"
+#include "index/ScanSpecification.h"
+#include "util/File.h"
+#include "util/jthread.h"
+
+using ::testing::ElementsAre;
+
+// _____________________________________________________________________________
+TEST(BlockAccessHistogram, recordAccess) {
+  BlockAccessHistogram histogram{3, "blockAccessHistogramRecord.dat"};
+  EXPECT_EQ(histogram.numBlocks(), 3);
+  EXPECT_THAT(histogram.getCounts(), ElementsAre(0, 0, 0));
+  histogram.recordAccess(0);
+  histogram.recordAccess(2);
+  histogram.recordAccess(2);
+  // Out of range, ignored.
+  histogram.recordAccess(3);
+  EXPECT_THAT(histogram.getCounts(), ElementsAre(1, 0, 2));
+  EXPECT_EQ(histogram.getCount(2), 2);
+  EXPECT_ANY_THROW(histogram.getCount(3));
+  histogram.clear();
+  EXPECT_THAT(histogram.getCounts(), ElementsAre(0, 0, 0));
+}
+
+// _____________________________________________________________________________
+TEST(BlockAccessHistogram, concurrentAccesses) {
+  BlockAccessHistogram histogram{2, "blockAccessHistogramConcurrent.dat"};
+  {
+    std::vector<ad_utility::JThread> threads;
+    for (size_t i = 0; i < 4; ++i) {
+      threads.emplace_back([&histogram]() {
+        for (size_t j = 0; j < 10'000; ++j) {
+          histogram.recordAccess(j % 2);
+        }
+      });
+    }
+  }
+  EXPECT_THAT(histogram.getCounts(), ElementsAre(20'000, 20'000));
+}
+
+// _____________________________________________________________________________
+TEST(BlockAccessHistogram, writeAndRead) {
+  std::string filename = "blockAccessHistogramWriteAndRead.dat";
+  {
+    BlockAccessHistogram histogram{3, filename};
+    histogram.recordAccess(1);
+    histogram.recordAccess(1);
+    histogram.recordAccess(2);
+    histogram.writeToFile();
+  }
+  // The counts are read from the file by the constructor.
+  {
+    BlockAccessHistogram histogram{3, filename};
+    EXPECT_THAT(histogram.getCounts(), ElementsAre(0, 2, 1));
+    histogram.recordAccess(0);
+    histogram.writeToFile();
+  }
+  {
+    BlockAccessHistogram histogram{3, filename};
+    EXPECT_THAT(histogram.getCounts(), ElementsAre(1, 2, 1));
+  }
+
+  // A histogram with a different number of blocks is ignored.
+  {
+    BlockAccessHistogram histogram{4, filename};
+    EXPECT_THAT(histogram.getCounts(), ElementsAre(0, 0, 0, 0));
+    EXPECT_FALSE(histogram.readFromFile());
+  }
+
+  // So is a file with a different format.
+  {
+    ad_utility::File file{filename, "w"};
+    file.write("garbage garbage", 15);
+  }
+  {
+    BlockAccessHistogram histogram{3, filename};
+    EXPECT_THAT(histogram.getCounts(), ElementsAre(0, 0, 0));
+  }
+  ad_utility::deleteFile(filename);
+}
+
+// _____________________________________________________________________________
+TEST(BlockAccessHistogram, getStatistics) {
+  auto* qec = ad_utility::testing::getQec();
+  const auto& index = qec->getIndex().getImpl();
+  for (auto permutationEnum : Permutation::ALL) {
+    const auto& permutation = index.getPermutation(permutationEnum);
+    ASSERT_NE(permutation.reader().blockAccessHistogram(), nullptr);
+  }
+  const auto& pso = index.getPermutation(Permutation::PSO);
+  const auto& histogram = *pso.reader().blockAccessHistogram();
+  EXPECT_EQ(histogram.numBlocks(), pso.metaData().blockData().size());
+
+  // Scanning the permutation records accesses.
+  auto countsBefore = histogram.getCounts();
+  auto locatedTriplesState = qec->locatedTriplesState();
+  auto scanSpec =
+      ScanSpecificationAsTripleComponent{
+          TripleComponent::Iri::fromIriref("<label>"), std::nullopt,
+          std::nullopt}
+          .toScanSpecification(index);
+  auto result = pso.scan(
+      pso.getScanSpecAndBlocks(scanSpec, locatedTriplesState), {},
+      std::make_shared<ad_utility::CancellationHandle<>>(),
+      locatedTriplesState);
+  EXPECT_EQ(result.numRows(), 6);
+  auto countsAfter = histogram.getCounts();
+  EXPECT_GT(std::accumulate(countsAfter.begin(), countsAfter.end(), 0UL),
+            std::accumulate(countsBefore.begin(), countsBefore.end(), 0UL));
+
+  auto statistics = BlockAccessHistogram::getStatistics(index, 1);
+  ASSERT_TRUE(statistics.contains("PSO"));
+  const auto& psoStatistics = statistics["PSO"];
+  EXPECT_EQ(psoStatistics["num-blocks"], histogram.numBlocks());
+  EXPECT_GE(psoStatistics["num-accesses"].get<uint64_t>(), 1);
+  EXPECT_GE(psoStatistics["num-blocks-accessed"].get<uint64_t>(), 1);
+  ASSERT_EQ(psoStatistics["hottest-blocks"].size(), 1);
+  const auto& hottestBlock = psoStatistics["hottest-blocks"][0];
+  auto blockIndex = hottestBlock["block-index"].get<size_t>();
+  EXPECT_EQ(hottestBlock["num-accesses"], countsAfter.at(blockIndex));
+  EXPECT_EQ(hottestBlock["num-rows"],
+            pso.metaData().blockData().at(blockIndex).numRows_);
+}
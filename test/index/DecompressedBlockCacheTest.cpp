@@ -0,0 +1,97 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#include <gmock/gmock.h>
+
+#include "index/DecompressedBlockCache.h"
+
+using namespace ad_utility::memory_literals;
+
+namespace {
+auto I = &Id::makeFromInt;
+
+std::vector<Id> makeColumn(size_t size, int64_t offset = 0) {
+  std::vector<Id> result;
+  for (size_t i = 0; i < size; ++i) {
+    result.push_back(I(static_cast<int64_t>(i) + offset));
+  }
+  return result;
+}
+}  // namespace
+
+// _____________________________________________________________________________
+TEST(DecompressedBlockCache, insertAndGet) {
+  DecompressedBlockCache cache{1_kB};
+  DecompressedBlockCache::Key key{3, 42};
+  EXPECT_EQ(cache.get(key), nullptr);
+  auto column = makeColumn(10);
+  cache.insert(key, column);
+  auto result = cache.get(key);
+  ASSERT_NE(result, nullptr);
+  EXPECT_THAT(*result, ::testing::ElementsAreArray(column));
+  // A different reader or offset is a different key.
+  EXPECT_EQ(cache.get({4, 42}), nullptr);
+  EXPECT_EQ(cache.get({3, 43}), nullptr);
+
+  // Inserting the same key twice is allowed, the first value is kept.
+  cache.insert(key, makeColumn(10, 100));
+  EXPECT_THAT(*cache.get(key), ::testing::ElementsAreArray(column));
+
+  auto stats = cache.getStatistics();
+  EXPECT_EQ(stats.numHits_, 2);
+  EXPECT_EQ(stats.numMisses_, 3);
+  EXPECT_EQ(stats.numEntries_, 1);
+  EXPECT_EQ(stats.size_, 80_B);
+  EXPECT_EQ(stats.maxSize_, 1_kB);
+
+  cache.clear();
+  stats = cache.getStatistics();
+  EXPECT_EQ(stats.numHits_, 0);
+  EXPECT_EQ(stats.numEntries_, 0);
+  EXPECT_EQ(cache.get(key), nullptr);
+}
+
+// _____________________________________________________________________________
+TEST(DecompressedBlockCache, leastRecentlyUsedEntriesAreEvicted) {
+  // Space for exactly two columns of 10 `Id`s.
+  DecompressedBlockCache cache{160_B};
+  cache.insert({0, 0}, makeColumn(10));
+  cache.insert({0, 1}, makeColumn(10));
+  // Access the first entry, s.t. the second one is evicted next.
+  EXPECT_NE(cache.get({0, 0}), nullptr);
+  cache.insert({0, 2}, makeColumn(10));
+  EXPECT_NE(cache.get({0, 0}), nullptr);
+  EXPECT_EQ(cache.get({0, 1}), nullptr);
+  EXPECT_NE(cache.get({0, 2}), nullptr);
+
+  // Columns that are larger than the cache are not inserted.
+  cache.insert({0, 3}, makeColumn(21));
+  EXPECT_EQ(cache.get({0, 3}), nullptr);
+  EXPECT_EQ(cache.getStatistics().numEntries_, 2);
+}
+
+// _____________________________________________________________________________
+TEST(DecompressedBlockCache, disabling) {
+  DecompressedBlockCache cache{1_kB};
+  cache.insert({0, 0}, makeColumn(10));
+  EXPECT_NE(cache.get({0, 0}), nullptr);
+
+  // Disabling the cache removes all entries.
+  cache.setMaxSize(0_B);
+  EXPECT_EQ(cache.get({0, 0}), nullptr);
+  EXPECT_EQ(cache.getStatistics().numEntries_, 0);
+  EXPECT_EQ(cache.getStatistics().size_, 0_B);
+  cache.insert({0, 0}, makeColumn(10));
+  EXPECT_EQ(cache.getStatistics().numEntries_, 0);
+
+  cache.setMaxSize(1_kB);
+  cache.insert({0, 0}, makeColumn(10));
+  EXPECT_NE(cache.get({0, 0}), nullptr);
+}
+
+// _____________________________________________________________________________
+TEST(DecompressedBlockCache, uniqueReaderIds) {
+  auto a = DecompressedBlockCache::getUniqueReaderId();
+  auto b = DecompressedBlockCache::getUniqueReaderId();
+  EXPECT_NE(a, b);
+}
@@ -22,6 +22,8 @@
 #include "index/IndexRebuilder.h"
 #include "index/IndexRebuilderImpl.h"
 #include "index/vocabulary/VocabularyType.h"
+#include "util/Conversions.h"
+#include "util/File.h"
 
 using namespace qlever::indexRebuilder;
 using namespace std::string_literals;
@@ -443,6 +445,51 @@ TEST(IndexRebuilder, createPermutationWriterTask) {
   }
 }
 
+// _____________________________________________________________________________
+TEST(IndexRebuilder, mergeSortedTriples) {
+  auto U = Id::makeUndefined();
+  auto I = ad_utility::testing::IntId;
+  auto toRange = [](const std::vector<VectorTable>& blocks) {
+    std::vector<IdTableStatic<0>> tables;
+    for (const auto& block : blocks) {
+      tables.emplace_back(makeIdTableFromVector(block));
+    }
+    return ad_utility::InputRangeTypeErased{std::move(tables)};
+  };
+  auto merge = [&toRange](const std::vector<VectorTable>& existing,
+                          const std::vector<VectorTable>& appended) {
+    auto range = mergeSortedTriples(toRange(existing), toRange(appended), 5);
+    return ::ranges::to<std::vector>(ql::views::transform(
+        range, ad_utility::staticCast<IdTableStatic<0>&&>));
+  };
+  auto row = [](size_t subject, Id payload) {
+    return std::vector<IntOrId>{V(subject), V(1), V(1), V(0), payload};
+  };
+  auto appendedRow = [](size_t subject) {
+    return std::vector<IntOrId>{V(subject), V(1), V(1), V(0)};
+  };
+
+  // Appended triples are inserted at the correct positions, duplicates (of
+  // existing and of appended triples) are written only once, and the
+  // additional column is undefined for them. Existing rows after the last
+  // appended row of a block are passed on as a separate block.
+  auto result =
+      merge({{row(1, I(7)), row(3, I(8))}, {row(5, I(9))}},
+            {{appendedRow(0), appendedRow(1), appendedRow(2)},
+             {appendedRow(2), appendedRow(6)}});
+  ASSERT_EQ(result.size(), 4);
+  EXPECT_EQ(result.at(0), makeIdTableFromVector(
+                              {row(0, U), row(1, I(7)), row(2, U)}));
+  EXPECT_EQ(result.at(1), makeIdTableFromVector({row(3, I(8))}));
+  EXPECT_EQ(result.at(2), makeIdTableFromVector({row(5, I(9))}));
+  EXPECT_EQ(result.at(3), makeIdTableFromVector({row(6, U)}));
+
+  // Without appended triples, the existing blocks are passed on unchanged.
+  result = merge({{row(1, I(7))}}, {});
+  ASSERT_EQ(result.size(), 1);
+  EXPECT_EQ(result.at(0), makeIdTableFromVector({row(1, I(7))}));
+}
+
 // _____________________________________________________________________________
 TEST(IndexRebuilder, materializeToIndex) {
   auto cancellationHandle =
@@ -553,6 +600,76 @@ TEST(IndexRebuilder, materializeToIndexWithZeroMemorySourceIndex) {
   EXPECT_EQ(newIndex.numTriples().normal, 3);
 }
 
+// _____________________________________________________________________________
+TEST(IndexRebuilder, appendToIndex) {
+  auto cancellationHandle =
+      std::make_shared<ad_utility::SharedCancellationHandle::element_type>();
+  std::string baseFolder = "/tmp/appendToIndex";
+  std::string newIndexName = baseFolder + "/index";
+  std::string logFile = newIndexName + ".log";
+  std::string inputFile = baseFolder + "/input.ttl";
+
+  ad_utility::testing::TestIndexConfig config;
+  config.turtleInput = "<a> <b> <c> . <d> <e> _:f .";
+  config.loadAllPermutations = true;
+  auto index =
+      ad_utility::testing::makeTestIndex("appendToIndex", std::move(config));
+
+  std::filesystem::create_directory(baseFolder);
+  absl::Cleanup removeIndexFiles{
+      [&baseFolder] { std::filesystem::remove_all(baseFolder); }};
+  // The blank node `_:g` occurs twice and has to become the same node, the
+  // first triple already exists. The language tag adds two internal triples.
+  ad_utility::makeOfstream(inputFile)
+      << "<a> <b> <c> . <a> <b> <x> . _:g <b> \"lit\" . _:g <e> <c> . "
+         "<a> <b> \"hi\"@en .";
+
+  qlever::InputFileSpecification file;
+  file.source_ = inputFile;
+  file.filetype_ = qlever::Filetype::Turtle;
+  qlever::appendToIndex(index.getImpl(), newIndexName, {file},
+                        cancellationHandle, logFile);
+  EXPECT_TRUE(std::filesystem::exists(logFile));
+  EXPECT_FALSE(std::filesystem::exists(newIndexName + ".append-triples.dat"));
+  // The patterns of the appended triples are not computed, so the new index
+  // has no patterns.
+  ASSERT_TRUE(index.getImpl().usePatterns());
+  EXPECT_FALSE(std::filesystem::exists(newIndexName + ".index.patterns"));
+
+  // The source index and its updates are not modified.
+  auto counts = index.deltaTriplesManager().modify<DeltaTriplesCount>(
+      std::function<DeltaTriplesCount(DeltaTriples&)>(
+          [](DeltaTriples& deltaTriples) { return deltaTriples.getCounts(); }),
+      /*writeToDiskAfterRequest=*/false,
+      /*updateMetadataAfterRequest=*/false);
+  EXPECT_EQ(counts.triplesInserted_, 0);
+  EXPECT_EQ(counts.triplesDeleted_, 0);
+
+  IndexImpl newIndex{ad_utility::makeUnlimitedAllocator<Id>()};
+  newIndex.loadAllPermutations() = true;
+  newIndex.usePatterns() = true;
+  newIndex.createFromOnDiskIndex(newIndexName, false);
+  EXPECT_FALSE(newIndex.usePatterns());
+  EXPECT_EQ(newIndex.numTriples().normal, 6);
+  EXPECT_EQ(newIndex.numTriples().internal,
+            index.getImpl().numTriples().internal + 2);
+  EXPECT_EQ(newIndex.numDistinctPredicates().normal, 2);
+  EXPECT_EQ(newIndex.numDistinctSubjects().normal, 3);
+  EXPECT_EQ(newIndex.numDistinctObjects().normal, 5);
+  for (const auto& iri :
+       {ad_utility::triple_component::Iri::fromIriref("<x>"),
+        ad_utility::convertLangtagToEntityUri("en")}) {
+    EXPECT_TRUE(TripleComponent{iri}.toValueId(newIndex).has_value())
+        << iri.toStringRepresentation();
+  }
+
+  // Appending without any input files is a contract violation.
+  AD_EXPECT_THROW_WITH_MESSAGE(
+      qlever::appendToIndex(index.getImpl(), newIndexName, {},
+                            cancellationHandle, logFile),
+      ::testing::HasSubstr("No input files"));
+}
+
 // _____________________________________________________________________________
 TEST(IndexRebuilder, materializeToIndexNoLogFileName) {
   auto cancellationHandle =
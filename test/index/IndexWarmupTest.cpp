@@ -0,0 +1,89 @@
+// Copyright 2026, University of Freiburg,
+// Chair of Algorithms and Data Structures.
+
+#include <gmock/gmock.h>
+
+#include "../util/IndexTestHelpers.h"
+#include "index/IndexWarmup.h"
+#include "util/File.h"
+
+using Block = IndexWarmup::Block;
+using namespace ad_utility::memory_literals;
+
+// _____________________________________________________________________________
+TEST(IndexWarmup, selectBlocks) {
+  std::vector<Block> candidates{{0, 0, 10, 3}, {0, 1, 10, 2}, {0, 2, 10, 1},
+                                {1, 0, 20, 3}, {1, 1, 5, 2},  {1, 2, 5, 1}};
+  // Everything fits.
+  EXPECT_THAT(IndexWarmup::selectBlocks(candidates, 1000),
+              ::testing::ElementsAreArray(candidates));
+  // Nothing fits.
+  EXPECT_THAT(IndexWarmup::selectBlocks(candidates, 4),
+              ::testing::IsEmpty());
+
+  // The blocks with priority 3 are selected first, then `{0, 1}` (which comes
+  // first in the input), then `{1, 1}` still fits, but `{0, 2}` doesn't
+  // anymore. The result is sorted by the position of the blocks.
+  EXPECT_THAT(IndexWarmup::selectBlocks(candidates, 46),
+              ::testing::ElementsAre(Block{0, 0, 10, 3}, Block{0, 1, 10, 2},
+                                     Block{1, 0, 20, 3}, Block{1, 1, 5, 2}));
+  // A block that doesn't fit is skipped, but smaller blocks with lower
+  // priority may still be selected.
+  EXPECT_THAT(IndexWarmup::selectBlocks(candidates, 18),
+              ::testing::ElementsAre(Block{0, 0, 10, 3}, Block{1, 1, 5, 2}));
+}
+
+// _____________________________________________________________________________
+TEST(IndexWarmup, getVocabularyOffsetsFiles) {
+  std::vector<std::string> filenames{
+      "warmupTest.vocabulary.internal.offsets",
+      "warmupTest.vocabulary.external.words.offsets",
+      "warmupTest.vocabulary.internal", "warmupTest.index.pso",
+      "otherIndex.vocabulary.internal.offsets"};
+  for (const auto& filename : filenames) {
+    ad_utility::File{filename, "w"};
+  }
+  EXPECT_THAT(IndexWarmup::getVocabularyOffsetsFiles("warmupTest"),
+              ::testing::ElementsAre(
+                  "./warmupTest.vocabulary.external.words.offsets",
+                  "./warmupTest.vocabulary.internal.offsets"));
+  EXPECT_THAT(IndexWarmup::getVocabularyOffsetsFiles("nonExisting/dir/base"),
+              ::testing::IsEmpty());
+  for (const auto& filename : filenames) {
+    ad_utility::deleteFile(filename);
+  }
+}
+
+// _____________________________________________________________________________
+TEST(IndexWarmup, warmUp) {
+  const auto& index = ad_utility::testing::getQec()->getIndex().getImpl();
+
+  // A budget of zero disables the warm-up.
+  auto statistics = IndexWarmup::warmUp(index, 0_B);
+  EXPECT_EQ(statistics.metadata_, 0_B);
+  EXPECT_EQ(statistics.vocabulary_, 0_B);
+  EXPECT_EQ(statistics.blocks_, 0_B);
+  EXPECT_EQ(statistics.numBlocks_, 0);
+
+  // With a large budget, all the blocks of all the permutations are
+  // prefetched.
+  size_t numBlocks = 0;
+  for (auto permutation : Permutation::ALL) {
+    const auto& metaData = index.getPermutation(permutation).metaData();
+    numBlocks += metaData.blockData().size();
+  }
+  statistics = IndexWarmup::warmUp(index, 1_GB);
+  EXPECT_GT(statistics.metadata_, 0_B);
+  EXPECT_GT(statistics.blocks_, 0_B);
+  EXPECT_EQ(statistics.numBlocks_, numBlocks);
+
+  // The budget is respected.
+  auto budget = ad_utility::MemorySize::bytes(
+      statistics.metadata_.getBytes() + statistics.vocabulary_.getBytes() +
+      statistics.blocks_.getBytes() / 2);
+  auto limited = IndexWarmup::warmUp(index, budget);
+  EXPECT_LE(limited.metadata_.getBytes() + limited.vocabulary_.getBytes() +
+                limited.blocks_.getBytes(),
+            budget.getBytes());
+  EXPECT_LT(limited.numBlocks_, numBlocks);
+}
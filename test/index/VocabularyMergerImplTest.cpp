@@ -9,17 +9,21 @@
 
 #include <absl/cleanup/cleanup.h>
 #include <absl/strings/str_cat.h>
+#include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include <filesystem>
 #include <string>
 
+#include "../util/GTestHelpers.h"
 #include "index/VocabularyMergerImpl.h"
 #include "util/Serializer/FileSerializer.h"
 #include "util/Serializer/SerializeString.h"
 
 namespace {
+using ad_utility::vocabulary_merger::PartialVocabularySample;
 using ad_utility::vocabulary_merger::writePartialVocabularyToFile;
+using namespace ad_utility::memory_literals;
 
 // Helper to conveniently create an entry for `ItemVec`.
 ItemVec::value_type makeEntry(std::string_view word, bool isExternalized,
@@ -42,7 +46,13 @@ std::vector<std::tuple<std::string, bool, uint64_t>> readBack(
 TEST(IndexVocabularyMergerImpl, writePartialVocabularyToFile) {
   std::string fileName =
       absl::StrCat(::testing::TempDir(), "/writePartialVocabularyToFile.tmp");
-  absl::Cleanup cleanup{[&fileName]() { ad_utility::deleteFile(fileName); }};
+  absl::Cleanup cleanup{[&fileName]() {
+    ad_utility::deleteFile(fileName);
+    ad_utility::deleteFile(absl::StrCat(fileName, PARTIAL_VOCAB_SAMPLES_SUFFIX));
+  }};
+  auto sampleDistance = PARTIAL_VOCAB_SAMPLE_DISTANCE().exchange(2);
+  absl::Cleanup resetSampleDistance{
+      [sampleDistance]() { PARTIAL_VOCAB_SAMPLE_DISTANCE() = sampleDistance; }};
 
   // A word large enough to cross the 16 MB flush threshold inside the function,
   // exercising the mid-loop flush in addition to the final flush.
@@ -67,8 +77,125 @@ TEST(IndexVocabularyMergerImpl, writePartialVocabularyToFile) {
             std::make_tuple(std::string{"_:blank"}, false, uint64_t{0}));
   EXPECT_EQ(roundtrip.at(3), std::make_tuple(bigWord, true, uint64_t{99}));
 
+  // Every second word is stored as a sample together with its offset.
+  std::vector<PartialVocabularySample> samples;
+  ad_utility::serialization::FileReadSerializer{
+      absl::StrCat(fileName, PARTIAL_VOCAB_SAMPLES_SUFFIX)} >>
+      samples;
+  ASSERT_EQ(samples.size(), 2u);
+  for (size_t i = 0; i < samples.size(); ++i) {
+    const auto& sample = samples.at(i);
+    EXPECT_EQ(sample.positionInFile_, 2 * i);
+    const auto& [word, isExternal, id] = roundtrip.at(2 * i);
+    EXPECT_EQ(sample.word_.iriOrLiteral(), word);
+    EXPECT_EQ(sample.word_.isExternal(), isExternal);
+    EXPECT_EQ(sample.word_.index_, id);
+    ad_utility::serialization::FileReadSerializer reader{fileName};
+    reader.setSerializationPosition(sample.byteOffset_);
+    TripleComponentWithIndex wordAtOffset;
+    reader >> wordAtOffset;
+    EXPECT_EQ(wordAtOffset.iriOrLiteral(), word);
+    EXPECT_EQ(wordAtOffset.index_, id);
+  }
+
   // Empty input: only the size header (zero) is written.
   ItemVec empty;
   writePartialVocabularyToFile(empty, fileName);
   EXPECT_TRUE(readBack(fileName).empty());
 }
+
+// _____________________________________________________________________________
+TEST(IndexVocabularyMergerImpl, mergeVocabularyInParallelRanges) {
+  std::string basename =
+      absl::StrCat(::testing::TempDir(), "/mergeVocabularyInParallelRanges");
+  constexpr size_t numFiles = 4;
+  auto sampleDistance = PARTIAL_VOCAB_SAMPLE_DISTANCE().exchange(3);
+  absl::Cleanup cleanup{[&basename, sampleDistance]() {
+    PARTIAL_VOCAB_SAMPLE_DISTANCE() = sampleDistance;
+    for (size_t i = 0; i < numFiles; ++i) {
+      auto wordsFile = absl::StrCat(basename, PARTIAL_VOCAB_WORDS_INFIX, i);
+      ad_utility::deleteFile(wordsFile);
+      ad_utility::deleteFile(
+          absl::StrCat(wordsFile, PARTIAL_VOCAB_SAMPLES_SUFFIX));
+      ad_utility::deleteFile(
+          absl::StrCat(basename, PARTIAL_VOCAB_IDMAP_INFIX, i));
+    }
+  }};
+
+  // The same word is external iff it is smaller than the same word that is
+  // not external (like in the `TripleComponentComparator`).
+  auto comparator = [](std::string_view a, bool aIsExternal,
+                       std::string_view b, bool bIsExternal) {
+    if (a != b) {
+      return a < b;
+    }
+    return aIsExternal && !bIsExternal;
+  };
+
+  // Write partial vocabularies with overlapping words. Some words occur with
+  // different values for `isExternal` in different files, and some words are
+  // blank nodes.
+  for (size_t file = 0; file < numFiles; ++file) {
+    std::vector<std::string> words;
+    std::vector<bool> isExternal;
+    for (size_t i = 0; i < 300; i += file + 1) {
+      words.push_back(absl::StrCat(i % 5 == 0 ? "_:b" : "\"w", 1000 + i));
+      isExternal.push_back(i % numFiles == file);
+    }
+    ItemVec els;
+    for (size_t i = 0; i < words.size(); ++i) {
+      els.emplace_back(
+          words.at(i), ItemVec::value_type::second_type{i, isExternal.at(i)});
+    }
+    ql::ranges::sort(els, [&comparator](const auto& a, const auto& b) {
+      return comparator(a.first, a.second.isExternal(), b.first,
+                        b.second.isExternal());
+    });
+    writePartialVocabularyToFile(
+        els, absl::StrCat(basename, PARTIAL_VOCAB_WORDS_INFIX, file));
+  }
+
+  // Merge the partial vocabularies with the given number of ranges and return
+  // the words of the merged vocabulary and the ID maps.
+  auto merge = [&](size_t numRanges) {
+    std::vector<std::pair<std::string, bool>> words;
+    auto wordCallback = [&words](std::string_view word,
+                                 bool isExternal) -> uint64_t {
+      words.emplace_back(word, isExternal);
+      return words.size() - 1;
+    };
+    auto metaData = ad_utility::vocabulary_merger::mergeVocabulary(
+        basename, numFiles, comparator, wordCallback, 1_GB, numRanges);
+    EXPECT_EQ(metaData.numWordsTotal(), words.size());
+    std::vector<IdMap> idMaps;
+    for (size_t i = 0; i < numFiles; ++i) {
+      idMaps.push_back(
+          getIdMapFromFile(absl::StrCat(basename, PARTIAL_VOCAB_IDMAP_INFIX, i)));
+    }
+    return std::pair{std::move(words), std::move(idMaps)};
+  };
+
+  auto [expectedWords, expectedIdMaps] = merge(1);
+  // 300 distinct words, 60 of which are blank nodes.
+  ASSERT_EQ(expectedWords.size(), 240u);
+  EXPECT_TRUE(ql::ranges::is_sorted(expectedWords));
+  EXPECT_EQ(expectedIdMaps.at(0).size(), 300u);
+  for (size_t numRanges : {2, 4, 7, 50}) {
+    auto [words, idMaps] = merge(numRanges);
+    EXPECT_EQ(words, expectedWords) << numRanges;
+    EXPECT_EQ(idMaps, expectedIdMaps) << numRanges;
+  }
+
+  // If the merging fails, the temporary files of the ranges are removed.
+  auto throwingCallback = [](std::string_view, bool) -> uint64_t {
+    throw std::runtime_error{"word callback failed"};
+  };
+  AD_EXPECT_THROW_WITH_MESSAGE(
+      ad_utility::vocabulary_merger::mergeVocabulary(
+          basename, numFiles, comparator, throwingCallback, 1_GB, 4),
+      ::testing::HasSubstr("word callback failed"));
+  for (size_t rangeIndex = 0; rangeIndex < 4; ++rangeIndex) {
+    EXPECT_FALSE(std::filesystem::exists(
+        absl::StrCat(basename, MERGED_VOCAB_RANGE_INFIX, rangeIndex)));
+  }
+}
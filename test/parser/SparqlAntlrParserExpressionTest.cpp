@@ -11,6 +11,7 @@
 #include "./SparqlAntlrParserTestHelpers.h"
 #include "engine/sparqlExpressions/BlankNodeExpression.h"
 #include "engine/sparqlExpressions/CountStarExpression.h"
+#include "engine/sparqlExpressions/DistinctValueCachingExpression.h"
 #include "engine/sparqlExpressions/GroupConcatExpression.h"
 #include "engine/sparqlExpressions/NaryExpression.h"
 #include "engine/sparqlExpressions/NowDatetimeExpression.h"
@@ -152,19 +153,25 @@ TEST(SparqlParser, builtInCall) {
   auto makeRegexExpressionTwoArgs = [](auto&& arg0, auto&& arg1) {
     return makeRegexExpression(AD_FWD(arg0), AD_FWD(arg1), nullptr);
   };
+  // A regex with a constant pattern is wrapped in a
+  // `DistinctValueCachingExpression`.
+  expectBuiltInCall("regex(?x, \"ab\")",
+                    matchPtrWithChildren<DistinctValueCachingExpression>(
+                        variableExpressionMatcher(Var{"?x"}),
+                        matchLiteralExpression(lit("ab"))));
+  // Constant flags are merged into a constant pattern right away.
+  expectBuiltInCall("regex(?x, \"ab\", \"imsU\")",
+                    matchPtrWithChildren<DistinctValueCachingExpression>(
+                        variableExpressionMatcher(Var{"?x"}),
+                        matchLiteralExpression(lit("(?imsU:ab)"))));
   expectBuiltInCall(
-      "regex(?x, \"ab\")",
-      matchNaryWithChildrenMatchers(makeRegexExpressionTwoArgs,
-                                    variableExpressionMatcher(Var{"?x"}),
-                                    matchLiteralExpression(lit("ab"))));
-  expectBuiltInCall(
-      "regex(?x, \"ab\", \"imsU\")",
+      "regex(?x, \"ab\", ?f)",
       matchNaryWithChildrenMatchers(
           makeRegexExpressionTwoArgs, variableExpressionMatcher(Var{"?x"}),
           matchNaryWithChildrenMatchers(
               &makeMergeRegexPatternAndFlagsExpression,
               matchLiteralExpression(lit("ab")),
-              matchLiteralExpression(lit("imsU")))));
+              variableExpressionMatcher(Var{"?f"}))));
 
   expectBuiltInCall("MD5(?x)", matchUnary(&makeMD5Expression));
   expectBuiltInCall("SHA1(?x)", matchUnary(&makeSHA1Expression));